@@ -1,5 +1,5 @@
 from jinja2 import Environment, FileSystemLoader
-from typing import Any
+from typing import Any, Optional
 
 # Set up the Jinja2 environment
 env = Environment(loader=FileSystemLoader(searchpath="./codegen/"), autoescape=False)
@@ -8,6 +8,9 @@ template = env.get_template("generated.cpp.j2")
 
 counting_sketch_names = ["CPC", "HLL"]
 
+# Families whose sketches can be flattened into a precomputed sorted view.
+sorted_view_sketch_names = ["Quantiles", "KLL", "REQ"]
+
 logical_type_mapping = {
     "LogicalType::BOOLEAN": "bool",
     "LogicalType::TINYINT": "int8_t",
@@ -26,6 +29,16 @@ logical_type_mapping = {
 cpp_type_mapping = {value: key for key, value in logical_type_mapping.items()}
 
 
+# Quantile sketches hold DECIMAL items at one fixed width and scale, wide
+# enough for every DECIMAL(18, s).
+DECIMAL_ITEM_TYPE = "LogicalType::DECIMAL(38, 18)"
+
+
+def to_type_id(logical_type: str):
+    # LogicalType::DECIMAL(38, 18) -> LogicalTypeId::DECIMAL
+    return logical_type.split("(")[0].replace("LogicalType", "LogicalTypeId")
+
+
 def sketch_type_to_allowed_logical_types(sketch_type):
     if sketch_type in counting_sketch_names:
         return {
@@ -41,11 +54,22 @@ def sketch_type_to_allowed_logical_types(sketch_type):
             "LogicalType::UBIGINT": "uint64_t",
             "LogicalType::VARCHAR": "string_t",
             "LogicalType::BLOB": "string_t",
+            # Hashed by their canonical encoding, see distinct_hash.hpp.
+            "LogicalType::DATE": "int32_t",
+            "LogicalType::TIME": "int64_t",
+            "LogicalType::TIMESTAMP": "int64_t",
+            "LogicalType::TIMESTAMP_TZ": "int64_t",
+            "LogicalType::HUGEINT": "hugeint_t",
+            "LogicalType::UHUGEINT": "uhugeint_t",
+            "LogicalType::UUID": "DSUuid",
         }
 
     if sketch_type == "TDigest":
         return {"LogicalType::FLOAT": "float", "LogicalType::DOUBLE": "double"}
 
+    # Temporal types are sketched as their physical integer, so they keep
+    # their exact value and order without a cast per row.  DECIMAL is cast to
+    # DECIMAL_ITEM_TYPE, the one DECIMAL a sketch type can name.
     return {
         "LogicalType::TINYINT": "int8_t",
         "LogicalType::SMALLINT": "int16_t",
@@ -57,13 +81,143 @@ def sketch_type_to_allowed_logical_types(sketch_type):
         "LogicalType::USMALLINT": "uint16_t",
         "LogicalType::UINTEGER": "uint32_t",
         "LogicalType::UBIGINT": "uint64_t",
+        "LogicalType::DATE": "int32_t",
+        "LogicalType::TIME": "int64_t",
+        "LogicalType::TIMESTAMP": "int64_t",
+        "LogicalType::TIMESTAMP_TZ": "int64_t",
+        "LogicalType::HUGEINT": "hugeint_t",
+        DECIMAL_ITEM_TYPE: "hugeint_t",
+        "LogicalType::VARCHAR": "string_t",
+    }
+
+
+def sorted_view_logical_types(sketch_type):
+    # Sorted views store items at a fixed width, so variable length items
+    # are left out.
+    return {
+        logical_type: cpp_type
+        for logical_type, cpp_type in sketch_type_to_allowed_logical_types(sketch_type).items()
+        if cpp_type != "string_t"
     }
 
 
 def get_sketch_class_name(sketch_type: str):
+    # Aliases declared in the template that bind the tracking allocator.
+    return f"DS{sketch_type}Sketch"
+
+
+def list_argument(name: str, element_duckdb_type: Optional[str], element_cpp_type: str):
+    # A LIST argument whose children are read through a unified format so
+    # that each row can index them via its list_entry_t.  When no DuckDB
+    # element type is given the element type follows the sketch's item type.
+    return {
+        "cpp_type": "list_entry_t",
+        "duckdb_type": lambda contained_type: f"LogicalType::LIST({element_duckdb_type or contained_type})",
+        "name": name,
+        "pre_executor": f"""
+                    auto &{name}_list_children = ListVector::GetEntry({name}_vector);
+                    UnifiedVectorFormat {name}_children_unified;
+                    {name}_list_children.ToUnifiedFormat(ListVector::GetListSize({name}_vector), {name}_children_unified);
+                    const {element_cpp_type} *{name}_list_children_data = UnifiedVectorFormat::GetData<{element_cpp_type}>({name}_children_unified);
+                    """,
+    }
+
+
+def batch_query_method(sketch_type: str, list_name: str, result_cpp_type: str, query: str) -> str:
+    # Answers every point of a list argument against a single sorted view
+    # of the sketch, so the sort and weight accumulation happen once per row.
+    return f"""
+                if (sketch.is_empty())
+                {{
+                    throw InvalidInputException("Cannot query an empty {sketch_type} sketch");
+                }}
+                auto sorted_view = sketch.get_sorted_view();
+
+                auto current_size = ListVector::GetListSize(result);
+                auto new_size = current_size + {list_name}_data.length;
+                if (ListVector::GetListCapacity(result) < new_size)
+                {{
+                    ListVector::Reserve(result, new_size);
+                }}
+
+                auto &child_entry = ListVector::GetEntry(result);
+                auto child_vals = FlatVector::GetData<{result_cpp_type}>(child_entry);
+                for (idx_t i = 0; i < {list_name}_data.length; i++)
+                {{
+                    auto point_idx = {list_name}_children_unified.sel->get_index({list_name}_data.offset + i);
+                    if (!{list_name}_children_unified.validity.RowIsValid(point_idx))
+                    {{
+                        throw InvalidInputException("{list_name} cannot contain NULL values");
+                    }}
+                    const auto &point = {list_name}_list_children_data[point_idx];
+                    {query}
+                }}
+                ListVector::SetListSize(result, new_size);
+                return list_entry_t{{current_size, {list_name}_data.length}};
+                """
+
+
+def summary_field(name: str, duckdb_type: Optional[str], cpp_type: str, value: str, null_when_empty=False):
+    # A duckdb_type of None means the field has the sketch's item type.
+    return {
+        "name": name,
+        "duckdb_type": duckdb_type,
+        "cpp_type": cpp_type,
+        "value": value,
+        "null_when_empty": null_when_empty,
+    }
+
+
+def summary_fields_per_sketch_type(sketch_type: str):
+    if sketch_type == "HLL":
+        return [
+            summary_field("lg_config_k", "LogicalType::UTINYINT", "uint8_t", "sketch.get_lg_config_k()"),
+            summary_field("is_empty", "LogicalType::BOOLEAN", "bool", "sketch.is_empty()"),
+            summary_field("is_compact", "LogicalType::BOOLEAN", "bool", "sketch.is_compact()"),
+            summary_field("estimate", "LogicalType::DOUBLE", "double", "sketch.get_estimate()"),
+            summary_field("lower_bound", "LogicalType::DOUBLE", "double", "sketch.get_lower_bound(2)"),
+            summary_field("upper_bound", "LogicalType::DOUBLE", "double", "sketch.get_upper_bound(2)"),
+        ]
+
+    if sketch_type == "CPC":
+        return [
+            summary_field("lg_k", "LogicalType::UTINYINT", "uint8_t", "sketch.get_lg_k()"),
+            summary_field("is_empty", "LogicalType::BOOLEAN", "bool", "sketch.is_empty()"),
+            summary_field("estimate", "LogicalType::DOUBLE", "double", "sketch.get_estimate()"),
+            summary_field("lower_bound", "LogicalType::DOUBLE", "double", "sketch.get_lower_bound(2)"),
+            summary_field("upper_bound", "LogicalType::DOUBLE", "double", "sketch.get_upper_bound(2)"),
+        ]
+
     if sketch_type == "TDigest":
-        return "datasketches::tdigest"
-    return f"datasketches::{sketch_type.lower()}_sketch"
+        return [
+            summary_field("k", "LogicalType::USMALLINT", "uint16_t", "sketch.get_k()"),
+            summary_field("is_empty", "LogicalType::BOOLEAN", "bool", "sketch.is_empty()"),
+            summary_field("total_weight", "LogicalType::UBIGINT", "uint64_t", "sketch.get_total_weight()"),
+            summary_field("min_item", None, "T", "sketch.get_min_value()", null_when_empty=True),
+            summary_field("max_item", None, "T", "sketch.get_max_value()", null_when_empty=True),
+        ]
+
+    fields = [
+        summary_field("k", "LogicalType::USMALLINT", "uint16_t", "sketch.get_k()"),
+        summary_field("n", "LogicalType::UBIGINT", "uint64_t", "sketch.get_n()"),
+        summary_field("is_empty", "LogicalType::BOOLEAN", "bool", "sketch.is_empty()"),
+        summary_field("is_estimation_mode", "LogicalType::BOOLEAN", "bool", "sketch.is_estimation_mode()"),
+        summary_field("num_retained", "LogicalType::UBIGINT", "uint64_t", "sketch.get_num_retained()"),
+        summary_field("min_item", None, "T", "sketch.get_min_item()", null_when_empty=True),
+        summary_field("max_item", None, "T", "sketch.get_max_item()", null_when_empty=True),
+    ]
+    if sketch_type != "REQ":
+        fields.extend(
+            [
+                summary_field(
+                    "normalized_rank_error", "LogicalType::DOUBLE", "double", "sketch.get_normalized_rank_error(false)"
+                ),
+                summary_field(
+                    "normalized_rank_error_pmf", "LogicalType::DOUBLE", "double", "sketch.get_normalized_rank_error(true)"
+                ),
+            ]
+        )
+    return fields
 
 
 def unary_functions_per_sketch_type(sketch_type: str):
@@ -96,39 +250,65 @@ def unary_functions_per_sketch_type(sketch_type: str):
     else:
         sketch_argument = {
             "cpp_type": "string_t",
-            "duckdb_type": lambda contained_type: f"sketch_map_types[{contained_type.replace('LogicalType', 'LogicalTypeId')}]",
+            "duckdb_type": lambda contained_type: f"sketch_map_types[{to_type_id(contained_type)}]",
             "name": "sketch",
             "process": deserialize_sketch,
         }
 
+    # Split points are almost always a constant list literal, so in that case
+    # they are converted and validated once per chunk.  Otherwise each row
+    # points straight into the list's child vector, only falling back to a
+    # scratch buffer when the children are not flat.
     cdf_points_argument = {
         "cpp_type": "list_entry_t",
         "duckdb_type": lambda contained_type: f"LogicalType::LIST({contained_type})",
         "name": "split_points",
         "pre_executor": """
-                    UnifiedVectorFormat unified_split_points;
-                    split_points_vector.ToUnifiedFormat(args.size(), unified_split_points);
-
-                    // auto split_points_list_entries = UnifiedVectorFormat::GetData<list_entry_t>(unified_split_points);
-                    //         auto split_points_validitiy = FlatVector::Validity(split_points_vector);
-
                     auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
-
                     UnifiedVectorFormat split_points_children_unified;
-                    split_points_list_children.ToUnifiedFormat(args.size(), split_points_children_unified);
-
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
                     const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
+
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
                     """,
         "process": """
-                    std::vector<T> passing_points(split_points_data.length);
-                    for (idx_t i = 0; i < split_points_data.length; i++)
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
                     {
-                        passing_points[i] = split_points_list_children_data[i + split_points_data.offset];
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
+                    {
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
                     }
                     """,
     }
     pmf_points_argument = cdf_points_argument
 
+    ranks_argument = list_argument("ranks", "LogicalType::DOUBLE", "double")
+    items_argument = list_argument("items", None, "T")
+
     result = [
         {
             "method": "return sketch.is_empty();",
@@ -155,14 +335,15 @@ def unary_functions_per_sketch_type(sketch_type: str):
                 },
                 {
                     "name": "cdf",
+                    "statistics": "DSUnitIntervalListStatistics",
                     "description": "Return the Cumulative Distribution Function (CDF) of the sketch for a series of points",
                     "example": f"datasketch_{sketch_type.lower()}_cdf(sketch, points, inclusive)"
                     if sketch_type != "TDigest"
                     else f"datasketch_{sketch_type.lower()}_cdf(sketch, points)",
                     "method": (
-                        "auto cdf_result = sketch.get_CDF(passing_points.data(), split_points_data.length, inclusive_data);"
+                        "auto cdf_result = sketch.get_CDF(split_points_ptr, split_points_data.length, inclusive_data);"
                         if sketch_type != "TDigest"
-                        else "auto cdf_result = sketch.get_CDF(passing_points.data(), split_points_data.length);"
+                        else "auto cdf_result = sketch.get_CDF(split_points_ptr, split_points_data.length);"
                     )
                     + """
                 auto current_size = ListVector::GetListSize(result);
@@ -173,7 +354,7 @@ def unary_functions_per_sketch_type(sketch_type: str):
                 }
 
                 auto &child_entry = ListVector::GetEntry(result);
-                auto child_vals = FlatVector::GetData<T>(child_entry);
+                auto child_vals = FlatVector::GetData<double>(child_entry);
                 //auto &child_validity = FlatVector::Validity(child_entry);
                 for (idx_t i = 0; i < cdf_result.size(); i++)
                 {
@@ -192,18 +373,19 @@ def unary_functions_per_sketch_type(sketch_type: str):
                     ]
                     if sketch_type != "TDigest"
                     else [sketch_argument, cdf_points_argument],
-                    "return_type_dynamic_list": True,
+                    "return_type_list": "LogicalType::DOUBLE",
                 },
                 {
                     "name": "pmf",
+                    "statistics": "DSUnitIntervalListStatistics",
                     "description": "Return the Probability Mass Function (PMF) of the sketch for a series of points",
                     "example": f"datasketch_{sketch_type.lower()}_pmf(sketch, points, inclusive)"
                     if sketch_type != "TDigest"
                     else f"datasketch_{sketch_type.lower()}_pmf(sketch, points)",
                     "method": (
-                        "auto pmf_result = sketch.get_PMF(passing_points.data(), split_points_data.length, inclusive_data);"
+                        "auto pmf_result = sketch.get_PMF(split_points_ptr, split_points_data.length, inclusive_data);"
                         if sketch_type != "TDigest"
-                        else "auto pmf_result = sketch.get_PMF(passing_points.data(), split_points_data.length);"
+                        else "auto pmf_result = sketch.get_PMF(split_points_ptr, split_points_data.length);"
                     )
                     + """
                 auto current_size = ListVector::GetListSize(result);
@@ -233,7 +415,7 @@ def unary_functions_per_sketch_type(sketch_type: str):
                     ]
                     if sketch_type != "TDigest"
                     else [sketch_argument, pmf_points_argument],
-                    "return_type_dynamic_list": True,
+                    "return_type_list": "LogicalType::DOUBLE",
                 },
             ]
         )
@@ -267,6 +449,7 @@ def unary_functions_per_sketch_type(sketch_type: str):
                         sketch_argument,
                     ],
                     "name": "lg_config_k",
+                    "statistics": "DSHLLLgConfigKStatistics",
                     "return_type": "LogicalType::UTINYINT",
                 },
                 {
@@ -279,6 +462,44 @@ def unary_functions_per_sketch_type(sketch_type: str):
                     "name": "is_compact",
                     "return_type": "LogicalType::BOOLEAN",
                 },
+                {
+                    "method": """switch (sketch.get_target_type())
+                    {
+                    case datasketches::target_hll_type::HLL_4:
+                        return StringVector::AddString(result, "HLL_4");
+                    case datasketches::target_hll_type::HLL_6:
+                        return StringVector::AddString(result, "HLL_6");
+                    default:
+                        return StringVector::AddString(result, "HLL_8");
+                    }""",
+                    "description": "Return the target type of the sketch: HLL_4, HLL_6 or HLL_8",
+                    "example": f"datasketch_{sketch_type.lower()}_target_type(sketch)",
+                    "arguments": [
+                        sketch_argument,
+                    ],
+                    "name": "target_type",
+                    "return_type": "LogicalType::VARCHAR",
+                },
+                {
+                    "method": """DSHLLSketch converted(sketch, DSHLLTargetType(type_data.GetString()));
+                    auto serialized = compact_data ? converted.serialize_compact() : converted.serialize_updatable();
+                    return StringVector::AddStringOrBlob(result, std::string(serialized.begin(), serialized.end()));""",
+                    "description": "Convert the sketch to a target type (HLL_4, HLL_6 or HLL_8) and serialize it in compact or updatable form",
+                    "example": f"datasketch_{sketch_type.lower()}_convert(sketch, 'HLL_8', true)",
+                    "arguments": [
+                        sketch_argument,
+                        {
+                            "cpp_type": "string_t",
+                            "name": "type",
+                        },
+                        {
+                            "cpp_type": "bool",
+                            "name": "compact",
+                        },
+                    ],
+                    "name": "convert",
+                    "return_type_sketch": True,
+                },
             ]
         )
 
@@ -307,6 +528,7 @@ def unary_functions_per_sketch_type(sketch_type: str):
                         sketch_argument,
                     ],
                     "name": "estimate",
+                    "statistics": "DSNonNegativeStatistics",
                     "return_type": "LogicalType::DOUBLE",
                 },
                 {
@@ -321,6 +543,7 @@ def unary_functions_per_sketch_type(sketch_type: str):
                         },
                     ],
                     "name": "lower_bound",
+                    "statistics": "DSNonNegativeStatistics",
                     "return_type": "LogicalType::DOUBLE",
                 },
                 {
@@ -335,6 +558,7 @@ def unary_functions_per_sketch_type(sketch_type: str):
                         },
                     ],
                     "name": "upper_bound",
+                    "statistics": "DSNonNegativeStatistics",
                     "return_type": "LogicalType::DOUBLE",
                 },
             ]
@@ -362,6 +586,7 @@ def unary_functions_per_sketch_type(sketch_type: str):
                     "example": f"datasketch_{sketch_type.lower()}_rank(sketch, item)",
                     "method": "return sketch.get_rank(item_data);",
                     "name": "rank",
+                    "statistics": "DSUnitIntervalStatistics",
                     "arguments": [
                         sketch_argument,
                         {
@@ -406,6 +631,7 @@ def unary_functions_per_sketch_type(sketch_type: str):
                     "example": f"datasketch_{sketch_type.lower()}_normalized_rank_error(sketch, is_pmf)",
                     "method": "return sketch.get_normalized_rank_error(is_pmf_data);",
                     "name": "normalized_rank_error",
+                    "statistics": "DSNonNegativeStatistics",
                     "arguments": [
                         sketch_argument,
                         {
@@ -442,8 +668,9 @@ def unary_functions_per_sketch_type(sketch_type: str):
                 {
                     "description": "Return the rank of an item in the sketch",
                     "example": f"datasketch_{sketch_type.lower()}_rank(sketch, item, inclusive)",
-                    "method": "return sketch.get_rank(item_data, inclusive_data);",
+                    "method": "return sketch.get_rank(DSQuantileItem<T>::FromDuckDB(item_data), inclusive_data);",
                     "name": "rank",
+                    "statistics": "DSUnitIntervalStatistics",
                     "arguments": [
                         sketch_argument,
                         {
@@ -460,7 +687,7 @@ def unary_functions_per_sketch_type(sketch_type: str):
                 {
                     "description": "Return the quantile of a rank in the sketch",
                     "example": f"datasketch_{sketch_type.lower()}_rank(sketch, rank, inclusive)",
-                    "method": "return sketch.get_quantile(rank_data, inclusive_data);",
+                    "method": "return DSQuantileItem<T>::ToDuckDB(result, sketch.get_quantile(rank_data, inclusive_data));",
                     "name": "quantile",
                     "arguments": [
                         sketch_argument,
@@ -475,6 +702,51 @@ def unary_functions_per_sketch_type(sketch_type: str):
                     ],
                     "dynamic_return_type": True,
                 },
+                {
+                    "description": "Return the quantiles of a list of ranks in the sketch, computed from a single sorted view",
+                    "example": f"datasketch_{sketch_type.lower()}_quantiles(sketch, ranks, inclusive)",
+                    "method": batch_query_method(
+                        sketch_type,
+                        "ranks",
+                        "T",
+                        """if (!(point >= 0.0 && point <= 1.0))
+                    {
+                        throw InvalidInputException("Normalized rank must be between 0 and 1, got: %f", point);
+                    }
+                    child_vals[current_size + i] = DSQuantileItem<T>::ToDuckDB(child_entry, sorted_view.get_quantile(point, inclusive_data));""",
+                    ),
+                    "name": "quantiles",
+                    "arguments": [
+                        sketch_argument,
+                        ranks_argument,
+                        {
+                            "cpp_type": "bool",
+                            "name": "inclusive",
+                        },
+                    ],
+                    "return_type_dynamic_list": True,
+                },
+                {
+                    "description": "Return the ranks of a list of items in the sketch, computed from a single sorted view",
+                    "example": f"datasketch_{sketch_type.lower()}_ranks(sketch, items, inclusive)",
+                    "method": batch_query_method(
+                        sketch_type,
+                        "items",
+                        "double",
+                        "child_vals[current_size + i] = sorted_view.get_rank(DSQuantileItem<T>::FromDuckDB(point), inclusive_data);",
+                    ),
+                    "name": "ranks",
+                    "statistics": "DSUnitIntervalListStatistics",
+                    "arguments": [
+                        sketch_argument,
+                        items_argument,
+                        {
+                            "cpp_type": "bool",
+                            "name": "inclusive",
+                        },
+                    ],
+                    "return_type_list": "LogicalType::DOUBLE",
+                },
                 {
                     "description": "Return the number of items contained in the sketch",
                     "example": f"datasketch_{sketch_type.lower()}_rank(sketch)",
@@ -508,7 +780,7 @@ def unary_functions_per_sketch_type(sketch_type: str):
                 {
                     "description": "Return the minimum item in the sketch",
                     "example": f"datasketch_{sketch_type.lower()}_min_item(sketch)",
-                    "method": "return sketch.get_min_item();",
+                    "method": "return DSQuantileItem<T>::ToDuckDB(result, sketch.get_min_item());",
                     "name": "min_item",
                     "arguments": [
                         sketch_argument,
@@ -518,13 +790,118 @@ def unary_functions_per_sketch_type(sketch_type: str):
                 {
                     "description": "Return the maxium item in the sketch",
                     "example": f"datasketch_{sketch_type.lower()}_max_item(sketch)",
-                    "method": "return sketch.get_max_item();",
+                    "method": "return DSQuantileItem<T>::ToDuckDB(result, sketch.get_max_item());",
                     "name": "max_item",
                     "arguments": [sketch_argument],
                     "dynamic_return_type": True,
                 },
             ]
         )
+
+    if sketch_type in sorted_view_sketch_names:
+        add_sorted_view_functions(sketch_type, result, sketch_argument, cdf_points_argument)
+
+    result.append(
+        {
+            "description": "Return a struct of the metadata and estimates of the sketch from a single deserialization",
+            "example": f"datasketch_{sketch_type.lower()}_summary(sketch)",
+            "name": "summary",
+            "arguments": [sketch_argument],
+            "struct_fields": summary_fields_per_sketch_type(sketch_type),
+        }
+    )
+    return result
+
+
+def add_sorted_view_functions(sketch_type: str, functions: list, sketch_argument: Any, cdf_points_argument: Any):
+    # A sorted view is the sketch flattened into sorted items and cumulative
+    # weights.  It is built once by to_sorted_view and then answers
+    # quantile, rank and cdf queries by binary search directly over the blob.
+    sorted_view_argument = {
+        "cpp_type": "string_t",
+        "duckdb_type": lambda contained_type: f"sorted_view_map_types[{to_type_id(contained_type)}]",
+        "name": "sorted_view",
+        "process": "DSSortedView<T> sorted_view(sorted_view_data);",
+    }
+    inclusive_argument = {
+        "cpp_type": "bool",
+        "name": "inclusive",
+    }
+
+    functions.append(
+        {
+            "description": "Return a precomputed sorted view of the sketch that answers quantile, rank and cdf queries without deserializing",
+            "example": f"datasketch_{sketch_type.lower()}_to_sorted_view(sketch)",
+            "method": "return DSSortedView<T>::Serialize(result, sketch);",
+            "name": "to_sorted_view",
+            "sorted_view": True,
+            "arguments": [sketch_argument],
+            "return_type_sorted_view": True,
+        }
+    )
+
+    overloads = {
+        "quantile": {
+            "method": "return sorted_view.GetQuantile(rank_data, inclusive_data);",
+            "name": "quantile_sorted_view",
+            "arguments": [
+                sorted_view_argument,
+                {
+                    "cpp_type": "double",
+                    "name": "rank",
+                },
+                inclusive_argument,
+            ],
+            "dynamic_return_type": True,
+        },
+        "rank": {
+            "method": "return sorted_view.GetRank(item_data, inclusive_data);",
+            "name": "rank_sorted_view",
+            "statistics": "DSUnitIntervalStatistics",
+            "arguments": [
+                sorted_view_argument,
+                {
+                    "cpp_type_dynamic": True,
+                    "name": "item",
+                },
+                inclusive_argument,
+            ],
+            "return_type": "LogicalType::DOUBLE",
+        },
+        "cdf": {
+            "method": """
+                auto current_size = ListVector::GetListSize(result);
+                auto new_size = current_size + split_points_data.length + 1;
+                if (ListVector::GetListCapacity(result) < new_size)
+                {
+                    ListVector::Reserve(result, new_size);
+                }
+
+                auto &child_entry = ListVector::GetEntry(result);
+                auto child_vals = FlatVector::GetData<double>(child_entry);
+                sorted_view.GetCDF(split_points_ptr, split_points_data.length, inclusive_data, child_vals + current_size);
+                ListVector::SetListSize(result, new_size);
+                return list_entry_t{current_size, split_points_data.length + 1};
+                """,
+            "name": "cdf_sorted_view",
+            "statistics": "DSUnitIntervalListStatistics",
+            "arguments": [sorted_view_argument, cdf_points_argument, inclusive_argument],
+            "return_type_list": "LogicalType::DOUBLE",
+        },
+    }
+
+    for function_info in functions:
+        if function_info["name"] in overloads:
+            function_info["overloads"] = [overloads[function_info["name"]]]
+
+
+def function_bodies_per_sketch_type(sketch_type: str):
+    # Overloads are registered under their parent's SQL name but still need
+    # their own C++ implementation.
+    result = []
+    for function_info in unary_functions_per_sketch_type(sketch_type):
+        result.append(function_info)
+        result.extend(function_info.get("overloads", []))
     return result
 
 
@@ -559,13 +936,82 @@ def get_scalar_function_args(
         all_args.append(logical_type)
     elif function_info.get("return_type_dynamic_list"):
         all_args.append(f"LogicalType::LIST({logical_type})")
+    elif function_info.get("return_type_list"):
+        all_args.append(f"LogicalType::LIST({function_info['return_type_list']})")
+    elif function_info.get("return_type_sorted_view"):
+        all_args.append(f"sorted_view_map_types[{to_type_id(logical_type)}]")
+    elif function_info.get("return_type_sketch"):
+        all_args.append("sketch_type")
+    elif function_info.get("struct_fields"):
+        struct_children = ",".join(
+            f'{{"{field["name"]}", {field["duckdb_type"] or logical_type}}}' for field in function_info["struct_fields"]
+        )
+        all_args.append(f"LogicalType::STRUCT(child_list_t<LogicalType>{{{struct_children}}})")
     else:
         all_args.append(function_info["return_type"])
 
     return ",".join(all_args)
 
 
+def get_struct_function_block(function_info: Any) -> str:
+    # Struct results cannot go through the Unary/Binary executors, so walk
+    # the sketch vector directly and fill every child vector from one
+    # deserialized sketch per row.
+    (sketch_argument,) = function_info["arguments"]
+
+    field_lines = []
+    for field_index, field in enumerate(function_info["struct_fields"]):
+        value = field["value"]
+        if field["duckdb_type"] is None:
+            value = f"DSQuantileItem<T>::ToDuckDB(*struct_entries[{field_index}], {value})"
+        assignment = f"FlatVector::GetData<{field['cpp_type']}>(*struct_entries[{field_index}])[row] = {value};"
+        if field["null_when_empty"]:
+            field_lines.append(
+                f"""
+            if (sketch.is_empty())
+            {{
+                FlatVector::SetNull(*struct_entries[{field_index}], row, true);
+            }}
+            else
+            {{
+                {assignment}
+            }}"""
+            )
+        else:
+            field_lines.append(f"""
+            {assignment}""")
+
+    fields_body = "".join(field_lines)
+
+    return f"""
+        UnifiedVectorFormat sketch_unified;
+        sketch_vector.ToUnifiedFormat(args.size(), sketch_unified);
+        auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_unified);
+        auto &struct_entries = StructVector::GetEntries(result);
+
+        for (idx_t row = 0; row < args.size(); row++)
+        {{
+            auto sketch_idx = sketch_unified.sel->get_index(row);
+            if (!sketch_unified.validity.RowIsValid(sketch_idx))
+            {{
+                FlatVector::SetNull(result, row, true);
+                continue;
+            }}
+            auto sketch_data = sketch_entries[sketch_idx];
+            {sketch_argument["process"]}
+            {fields_body}
+        }}
+
+        if (args.AllConstant())
+        {{
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        }}"""
+
+
 def get_function_block(function_info: Any) -> str:
+    if function_info.get("struct_fields"):
+        return get_struct_function_block(function_info)
+
     cpp_types = []
     for value in function_info["arguments"]:
         if value.get("cpp_type_dynamic"):
@@ -573,10 +1019,12 @@ def get_function_block(function_info: Any) -> str:
         else:
             cpp_types.append(value["cpp_type"])
 
-    if function_info.get("return_type_dynamic_list"):
+    if function_info.get("return_type_dynamic_list") or function_info.get("return_type_list"):
         cpp_types.append("list_entry_t")
     elif function_info.get("dynamic_return_type"):
         cpp_types.append("T")
+    elif function_info.get("return_type_sorted_view") or function_info.get("return_type_sketch"):
+        cpp_types.append("string_t")
     else:
         cpp_types.append(logical_type_mapping[function_info["return_type"]])
 
@@ -630,14 +1078,18 @@ def get_function_block(function_info: Any) -> str:
 data = {
     "sketch_class_name": get_sketch_class_name,
     "counting_sketch_names": counting_sketch_names,
+    "sorted_view_sketch_names": sorted_view_sketch_names,
     #    "function_names_per_sketch": get_sketch_function_names,
     "sketch_types": ["Quantiles", "KLL", "REQ", "TDigest", "HLL", "CPC"],
     "logical_type_to_cplusplus_type": sketch_type_to_allowed_logical_types,
+    "sorted_view_logical_types": sorted_view_logical_types,
     "functions_per_sketch_type": unary_functions_per_sketch_type,
+    "function_bodies_per_sketch_type": function_bodies_per_sketch_type,
     "get_function_block": get_function_block,
     "get_scalar_function_args": get_scalar_function_args,
     "logical_type_mapping": logical_type_mapping,
-    "to_type_id": lambda v: v.replace("LogicalType", "LogicalTypeId"),
+    "to_type_id": to_type_id,
+    "decimal_item_type": DECIMAL_ITEM_TYPE,
     "sketch_k_cpp_type": {
         "Quantiles": "int32_t",
         "KLL": "int32_t",
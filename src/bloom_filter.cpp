@@ -0,0 +1,488 @@
+#include "datasketches_extension.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_aggregate_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_type_info.hpp"
+#include "duckdb/parser/parsed_data/create_macro_info.hpp"
+#include "duckdb/catalog/default/default_table_functions.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+#include <DataSketches/bloom_filter.hpp>
+#include <type_traits>
+
+#include "item_hash.hpp"
+#include "sketch_memory.hpp"
+#include "distinct_update.hpp"
+
+namespace duckdb
+{
+    namespace
+    {
+        // Filters held in aggregate states allocate through the tracking allocator.
+        using BloomStateFilter = datasketches::bloom_filter_alloc<DSTrackingAllocator<uint8_t>>;
+        using BloomFilter = datasketches::bloom_filter;
+
+        // A Bloom filter answers "may this key be in the set?" with no false
+        // negatives.  Filters are built with a fixed seed rather than the
+        // library's random default, so that filters built by different
+        // aggregate states and queries can be combined.
+        static constexpr uint64_t BLOOM_SEED = datasketches::DEFAULT_SEED;
+
+        // ============================================================
+        // 1. Helpers & Bind Data
+        // ============================================================
+        struct DSBloomBindData : public DSSketchBindData
+        {
+            DSBloomBindData(uint64_t num_items, double fpp) : num_items(num_items), fpp(fpp) {}
+            unique_ptr<FunctionData> Copy() const override { return make_uniq<DSBloomBindData>(*this); }
+            bool Equals(const FunctionData &other_p) const override
+            {
+                auto &other = other_p.Cast<DSBloomBindData>();
+                return num_items == other.num_items && fpp == other.fpp;
+            }
+            // 0 for the union and intersection aggregates, whose filters carry their size.
+            uint64_t num_items;
+            double fpp;
+        };
+
+        static Value DSBloomConstantArgument(ClientContext &context, Expression &expr, const char *name)
+        {
+            if (expr.HasParameter())
+                throw ParameterNotResolvedException();
+            if (!expr.IsFoldable())
+                throw BinderException("Bloom filter %s must be constant", name);
+            Value val = ExpressionExecutor::EvaluateScalar(context, expr);
+            if (val.IsNull())
+                throw BinderException("Bloom filter %s cannot be NULL", name);
+            return val;
+        }
+
+        unique_ptr<FunctionData> DSBloomBind(ClientContext &context, AggregateFunction &function,
+                                             vector<unique_ptr<Expression>> &arguments)
+        {
+            auto num_items = DSBloomConstantArgument(context, *arguments[0], "num_items").GetValue<int64_t>();
+            auto fpp = DSBloomConstantArgument(context, *arguments[1], "fpp").GetValue<double>();
+            if (num_items <= 0)
+                throw InvalidInputException("Bloom filter num_items must be positive, got: %d", num_items);
+            if (!(fpp > 0 && fpp < 1))
+                throw InvalidInputException("Bloom filter fpp must be between 0 and 1 exclusive, got: %f", fpp);
+            Function::EraseArgument(function, arguments, 1);
+            Function::EraseArgument(function, arguments, 0);
+            return make_uniq<DSBloomBindData>((uint64_t)num_items, fpp);
+        }
+
+        unique_ptr<FunctionData> DSBloomSetOperationBind(ClientContext &context, AggregateFunction &function,
+                                                         vector<unique_ptr<Expression>> &arguments)
+        {
+            return make_uniq<DSBloomBindData>(0, 0);
+        }
+
+        // A read-only view over the serialized filter, without copying its bits.
+        static const BloomFilter DSBloomWrap(const string_t &blob)
+        {
+            try
+            {
+                return BloomFilter::wrap(blob.GetDataUnsafe(), blob.GetSize());
+            }
+            catch (const std::exception &e)
+            {
+                throw InvalidInputException("Failed to deserialize Bloom filter: %s", e.what());
+            }
+        }
+
+        // ============================================================
+        // 2. State & Operations
+        // ============================================================
+        enum class DSBloomSetOperation : uint8_t
+        {
+            UNION,
+            INTERSECT
+        };
+
+        struct DSBloomState
+        {
+            BloomStateFilter *filter = nullptr;
+
+            ~DSBloomState()
+            {
+                if (filter)
+                    delete filter;
+            }
+
+            void Create(const DSBloomBindData &bind_data)
+            {
+                if (filter)
+                    return;
+                try
+                {
+                    filter = new BloomStateFilter(BloomStateFilter::builder::create_by_accuracy(
+                        bind_data.num_items, bind_data.fpp, BLOOM_SEED));
+                }
+                catch (const std::exception &e)
+                {
+                    throw InvalidInputException("Failed to create Bloom filter: %s", e.what());
+                }
+            }
+
+            void Combine(const BloomStateFilter &other, DSBloomSetOperation operation)
+            {
+                if (!filter)
+                {
+                    filter = new BloomStateFilter(other);
+                    return;
+                }
+                if (!filter->is_compatible(other))
+                {
+                    throw InvalidInputException("Bloom filters must have the same size, number of hashes and seed to be combined");
+                }
+                if (operation == DSBloomSetOperation::UNION)
+                    filter->union_with(other);
+                else
+                    filter->intersect(other);
+            }
+        };
+
+        struct DSBloomOperationBase
+        {
+            template <class STATE>
+            static void Initialize(STATE &state)
+            {
+                state.filter = nullptr;
+            }
+            template <class STATE>
+            static void Destroy(STATE &state, AggregateInputData &)
+            {
+                if (state.filter)
+                    delete state.filter;
+            }
+            static bool IgnoreNull() { return true; }
+
+            template <class T, class STATE>
+            static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data)
+            {
+                if (!state.filter)
+                {
+                    auto &bind_data = finalize_data.input.bind_data->template Cast<DSBloomBindData>();
+                    if (!bind_data.num_items)
+                    {
+                        // Combining no filters: the size is unknown.
+                        finalize_data.ReturnNull();
+                        return;
+                    }
+                    state.Create(bind_data);
+                }
+                auto serialized = state.filter->serialize();
+                target = StringVector::AddStringOrBlob(finalize_data.result, std::string(serialized.begin(), serialized.end()));
+            }
+        };
+
+        // Operation for RAW KEYS (all supported types)
+        struct DSBloomOperation : DSBloomOperationBase
+        {
+            // Inserting a key twice changes nothing.
+            static constexpr bool IDEMPOTENT = true;
+
+            template <class A_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &input, AggregateUnaryInput &idata)
+            {
+                auto &bind_data = idata.input.bind_data->template Cast<DSBloomBindData>();
+                state.Create(bind_data);
+                DSWithItemBytes(input, [&](const void *data, size_t size)
+                               { state.filter->update(data, size); });
+            }
+
+            template <class INPUT_TYPE, class STATE, class OP>
+            static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t count)
+            {
+                Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+            }
+
+            template <class STATE, class OP>
+            static void Combine(const STATE &source, STATE &target, AggregateInputData &)
+            {
+                if (source.filter)
+                    target.Combine(*source.filter, DSBloomSetOperation::UNION);
+            }
+        };
+
+        // Operation for COMBINING FILTERS (sketch_bloom_filter / BLOB)
+        template <DSBloomSetOperation OPERATION>
+        struct DSBloomSetOperationOp : DSBloomOperationBase
+        {
+            template <class A_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &input, AggregateUnaryInput &)
+            {
+                auto filter = [&]()
+                {
+                    try
+                    {
+                        return BloomStateFilter::deserialize(input.GetDataUnsafe(), input.GetSize());
+                    }
+                    catch (const std::exception &e)
+                    {
+                        throw InvalidInputException("Failed to deserialize Bloom filter: %s", e.what());
+                    }
+                }();
+                state.Combine(filter, OPERATION);
+            }
+
+            template <class INPUT_TYPE, class STATE, class OP>
+            static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t count)
+            {
+                // Union and intersection with itself are no-ops.
+                Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+            }
+
+            template <class STATE, class OP>
+            static void Combine(const STATE &source, STATE &target, AggregateInputData &)
+            {
+                if (source.filter)
+                    target.Combine(*source.filter, OPERATION);
+            }
+        };
+
+        // ============================================================
+        // 3. Scalar Functions
+        // ============================================================
+
+        // Probes are usually a whole column of keys against one filter, so a
+        // constant filter is wrapped once per vector, without copying its
+        // bits, and the keys are probed in one pass.
+        template <class T>
+        static void DSBloomContains(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            auto &filter_vector = args.data[0];
+            if (filter_vector.GetVectorType() == VectorType::CONSTANT_VECTOR)
+            {
+                if (ConstantVector::IsNull(filter_vector))
+                {
+                    result.SetVectorType(VectorType::CONSTANT_VECTOR);
+                    ConstantVector::SetNull(result, true);
+                    return;
+                }
+                const auto filter = DSBloomWrap(*ConstantVector::GetData<string_t>(filter_vector));
+                UnaryExecutor::Execute<T, bool>(args.data[1], result, args.size(),
+                                                [&](T key)
+                                                {
+                                                    return DSWithItemBytes(key, [&](const void *data, size_t size)
+                                                                          { return filter.query(data, size); });
+                                                });
+                return;
+            }
+            BinaryExecutor::Execute<string_t, T, bool>(filter_vector, args.data[1], result, args.size(),
+                                                       [&](string_t filter_blob, T key)
+                                                       {
+                                                           const auto filter = DSBloomWrap(filter_blob);
+                                                           return DSWithItemBytes(key, [&](const void *data, size_t size)
+                                                                                 { return filter.query(data, size); });
+                                                       });
+        }
+
+        static void DSBloomIsEmpty(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            UnaryExecutor::Execute<string_t, bool>(args.data[0], result, args.size(),
+                                                   [&](string_t filter_blob)
+                                                   {
+                                                       return DSBloomWrap(filter_blob).is_empty();
+                                                   });
+        }
+
+        static void DSBloomSummary(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat filter_data;
+            args.data[0].ToUnifiedFormat(count, filter_data);
+            auto filter_entries = UnifiedVectorFormat::GetData<string_t>(filter_data);
+            auto &struct_entries = StructVector::GetEntries(result);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t filter_idx = filter_data.sel->get_index(i);
+                if (!filter_data.validity.RowIsValid(filter_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+
+                const auto filter = DSBloomWrap(filter_entries[filter_idx]);
+                FlatVector::GetData<bool>(*struct_entries[0])[i] = filter.is_empty();
+                FlatVector::GetData<int64_t>(*struct_entries[1])[i] = (int64_t)filter.get_capacity();
+                FlatVector::GetData<int64_t>(*struct_entries[2])[i] = (int64_t)filter.get_bits_used();
+                FlatVector::GetData<int32_t>(*struct_entries[3])[i] = (int32_t)filter.get_num_hashes();
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
+        // ============================================================
+        // 4. Registration Helpers
+        // ============================================================
+        static LogicalType CreateBloomFilterType(ExtensionLoader &loader)
+        {
+            auto new_type = LogicalType(LogicalTypeId::BLOB);
+            auto new_type_name = "sketch_bloom_filter";
+
+            auto type_info = CreateTypeInfo(new_type_name, LogicalType::BLOB);
+            type_info.temporary = false;
+            type_info.internal = true;
+            type_info.comment = "Sketch type for Bloom Filter";
+            new_type.SetAlias(new_type_name);
+
+            auto &system_catalog = Catalog::GetSystemCatalog(loader.GetDatabaseInstance());
+            auto data = CatalogTransaction::GetSystemTransaction(loader.GetDatabaseInstance());
+            system_catalog.CreateType(data, type_info);
+
+            loader.RegisterCastFunction(LogicalType::BLOB, new_type, DefaultCasts::ReinterpretCast, 1);
+            loader.RegisterCastFunction(new_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast, 1);
+
+            return new_type;
+        }
+
+        template <typename T>
+        void RegisterBloom(AggregateFunctionSet &set, ScalarFunctionSet &contains, const LogicalType &input_type,
+                           const LogicalType &filter_type)
+        {
+            auto fun = AggregateFunction::UnaryAggregateDestructor<DSBloomState, T, string_t, DSBloomOperation, AggregateDestructorType::LEGACY>(
+                input_type, filter_type);
+            DSUseDistinctUpdate<DSBloomState, T, DSBloomOperation>(fun);
+            fun.bind = DSTrackedBind<DSBloomBind>;
+            fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            fun.arguments = {LogicalType::BIGINT, LogicalType::DOUBLE, input_type};
+            set.AddFunction(fun);
+
+            contains.AddFunction(ScalarFunction({filter_type, input_type}, LogicalType::BOOLEAN, DSBloomContains<T>));
+        }
+
+        // datasketch_bloom_filter_scan(table_name, column_name, filter)
+        //
+        // A table macro rather than a table function, so that the probe is an
+        // ordinary filter on the base table: the optimizer pushes it into the
+        // table scan, which drops rows before they are projected or reach a
+        // join.  A constant empty filter folds the predicate to false and the
+        // scan is removed altogether.
+        static const DefaultTableMacro BLOOM_FILTER_SCAN_MACRO = {
+            DEFAULT_SCHEMA,
+            "datasketch_bloom_filter_scan",
+            {"table_name", "column_name", "filter", nullptr},
+            {{nullptr, nullptr}},
+            R"(SELECT * FROM query_table(table_name::VARCHAR)
+WHERE NOT datasketch_bloom_is_empty(filter)
+  AND datasketch_bloom_contains(filter, COLUMNS(c -> c = column_name)))"};
+
+        template <DSBloomSetOperation OPERATION>
+        static AggregateFunction BloomSetOperationAggregate(const LogicalType &filter_type)
+        {
+            using OP = DSBloomSetOperationOp<OPERATION>;
+            auto fun = AggregateFunction::UnaryAggregateDestructor<DSBloomState, string_t, string_t, OP, AggregateDestructorType::LEGACY>(
+                filter_type, filter_type);
+            fun.bind = DSTrackedBind<DSBloomSetOperationBind>;
+            fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            return fun;
+        }
+    }
+
+    // ============================================================
+    // 5. Main Loader
+    // ============================================================
+    void LoadBloomFilter(ExtensionLoader &loader)
+    {
+        auto filter_type = CreateBloomFilterType(loader);
+
+        AggregateFunctionSet bloom_agg("datasketch_bloom");
+        ScalarFunctionSet contains("datasketch_bloom_contains");
+
+        // NOTE: Not for BLOB - it would conflict with the filter type.
+        RegisterBloom<int8_t>(bloom_agg, contains, LogicalType::TINYINT, filter_type);
+        RegisterBloom<int16_t>(bloom_agg, contains, LogicalType::SMALLINT, filter_type);
+        RegisterBloom<int32_t>(bloom_agg, contains, LogicalType::INTEGER, filter_type);
+        RegisterBloom<int64_t>(bloom_agg, contains, LogicalType::BIGINT, filter_type);
+        RegisterBloom<uint8_t>(bloom_agg, contains, LogicalType::UTINYINT, filter_type);
+        RegisterBloom<uint16_t>(bloom_agg, contains, LogicalType::USMALLINT, filter_type);
+        RegisterBloom<uint32_t>(bloom_agg, contains, LogicalType::UINTEGER, filter_type);
+        RegisterBloom<uint64_t>(bloom_agg, contains, LogicalType::UBIGINT, filter_type);
+        RegisterBloom<float>(bloom_agg, contains, LogicalType::FLOAT, filter_type);
+        RegisterBloom<double>(bloom_agg, contains, LogicalType::DOUBLE, filter_type);
+        RegisterBloom<string_t>(bloom_agg, contains, LogicalType::VARCHAR, filter_type);
+
+        {
+            CreateAggregateFunctionInfo info(bloom_agg);
+            FunctionDescription desc;
+            desc.description = "Creates a Bloom filter sized for num_items distinct keys at the given false positive probability";
+            desc.examples.push_back("datasketch_bloom(1000000, 0.01, customer_id)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            AggregateFunctionSet set("datasketch_bloom_union");
+            set.AddFunction(BloomSetOperationAggregate<DSBloomSetOperation::UNION>(filter_type));
+            CreateAggregateFunctionInfo info(set);
+            FunctionDescription desc;
+            desc.description = "Combines Bloom filters into one that contains the keys of any of them";
+            desc.examples.push_back("datasketch_bloom_union(filter)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            AggregateFunctionSet set("datasketch_bloom_intersect");
+            set.AddFunction(BloomSetOperationAggregate<DSBloomSetOperation::INTERSECT>(filter_type));
+            CreateAggregateFunctionInfo info(set);
+            FunctionDescription desc;
+            desc.description = "Combines Bloom filters into one that contains the keys of all of them";
+            desc.examples.push_back("datasketch_bloom_intersect(filter)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+
+        // --- SCALAR FUNCTIONS ---
+        {
+            CreateScalarFunctionInfo info(std::move(contains));
+            FunctionDescription desc;
+            desc.description = "Returns false if the key is certainly not in the filter, true if it may be";
+            desc.examples.push_back("datasketch_bloom_contains(filter, customer_id)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_bloom_is_empty",
+                                                         {filter_type}, LogicalType::BOOLEAN, DSBloomIsEmpty));
+            FunctionDescription desc;
+            desc.description = "Returns true if no key has been added to the filter";
+            desc.examples.push_back("datasketch_bloom_is_empty(filter)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            child_list_t<LogicalType> struct_fields;
+            struct_fields.push_back({"is_empty", LogicalType::BOOLEAN});
+            struct_fields.push_back({"capacity_bits", LogicalType::BIGINT});
+            struct_fields.push_back({"bits_used", LogicalType::BIGINT});
+            struct_fields.push_back({"num_hashes", LogicalType::INTEGER});
+
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_bloom_summary",
+                                                         {filter_type}, LogicalType::STRUCT(struct_fields), DSBloomSummary));
+            FunctionDescription desc;
+            desc.description = "Returns a struct of the size, bits set and number of hashes of the filter";
+            desc.examples.push_back("datasketch_bloom_summary(filter)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+
+        // --- TABLE MACRO ---
+        {
+            auto info = DefaultTableFunctionGenerator::CreateTableMacroInfo(BLOOM_FILTER_SCAN_MACRO);
+            FunctionDescription desc;
+            desc.description = "Scans a table, keeping only the rows whose key column may be in the Bloom filter";
+            desc.examples.push_back("datasketch_bloom_filter_scan('orders', 'customer_id', getvariable('active_customers'))");
+            info->descriptions.push_back(desc);
+
+            auto &system_catalog = Catalog::GetSystemCatalog(loader.GetDatabaseInstance());
+            auto data = CatalogTransaction::GetSystemTransaction(loader.GetDatabaseInstance());
+            system_catalog.CreateFunction(data, *info);
+        }
+    }
+
+}
@@ -0,0 +1,548 @@
+#include "datasketches_extension.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_aggregate_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_type_info.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+#include <DataSketches/count_min.hpp>
+#include <type_traits>
+
+#include "item_hash.hpp"
+#include "sketch_memory.hpp"
+#include "sketch_statistics.hpp"
+
+namespace duckdb
+{
+    namespace
+    {
+        // Sketches held in aggregate states allocate through the tracking allocator.
+        using CountMinStateSketch = datasketches::count_min_sketch<uint64_t, DSTrackingAllocator<uint64_t>>;
+        using CountMinSketch = datasketches::count_min_sketch<uint64_t>;
+
+        // A Count-Min sketch answers point frequency queries for any item,
+        // not only the heavy hitters kept by the Frequent Items sketch.  Its
+        // estimates never undercount; they overcount by at most
+        // relative_error * total_weight with the configured confidence.
+
+        // ============================================================
+        // 1. Helpers & Bind Data
+        // ============================================================
+        struct DSCountMinBindData : public DSSketchBindData
+        {
+            DSCountMinBindData(uint8_t num_hashes, uint32_t num_buckets) : num_hashes(num_hashes), num_buckets(num_buckets) {}
+            unique_ptr<FunctionData> Copy() const override { return make_uniq<DSCountMinBindData>(*this); }
+            bool Equals(const FunctionData &other_p) const override
+            {
+                auto &other = other_p.Cast<DSCountMinBindData>();
+                return num_hashes == other.num_hashes && num_buckets == other.num_buckets;
+            }
+            // Both 0 when merging, where the sketches carry their parameters.
+            uint8_t num_hashes;
+            uint32_t num_buckets;
+        };
+
+        static int64_t DSCountMinConstantArgument(ClientContext &context, Expression &expr, const char *name)
+        {
+            if (expr.HasParameter())
+                throw ParameterNotResolvedException();
+            if (!expr.IsFoldable())
+                throw BinderException("Count-Min %s must be constant", name);
+            Value val = ExpressionExecutor::EvaluateScalar(context, expr);
+            if (val.IsNull())
+                throw BinderException("Count-Min %s cannot be NULL", name);
+            return val.GetValue<int64_t>();
+        }
+
+        unique_ptr<FunctionData> DSCountMinBind(ClientContext &context, AggregateFunction &function,
+                                                vector<unique_ptr<Expression>> &arguments)
+        {
+            auto num_hashes = DSCountMinConstantArgument(context, *arguments[0], "num_hashes");
+            auto num_buckets = DSCountMinConstantArgument(context, *arguments[1], "num_buckets");
+            if (num_hashes < 1 || num_hashes > 255)
+                throw InvalidInputException("Count-Min num_hashes must be between 1 and 255, got: %d", num_hashes);
+            if (num_buckets < 3)
+                throw InvalidInputException("Count-Min num_buckets must be at least 3, got: %d", num_buckets);
+            // The library caps the number of counters at 2^30.
+            if (num_hashes * num_buckets >= (int64_t(1) << 30))
+                throw InvalidInputException("Count-Min num_hashes * num_buckets must be less than 2^30, got: %d",
+                                            num_hashes * num_buckets);
+            Function::EraseArgument(function, arguments, 1);
+            Function::EraseArgument(function, arguments, 0);
+            return make_uniq<DSCountMinBindData>((uint8_t)num_hashes, (uint32_t)num_buckets);
+        }
+
+        unique_ptr<FunctionData> DSCountMinMergeBind(ClientContext &context, AggregateFunction &function,
+                                                     vector<unique_ptr<Expression>> &arguments)
+        {
+            return make_uniq<DSCountMinBindData>(0, 0);
+        }
+
+        static CountMinSketch DSCountMinDeserialize(const string_t &blob)
+        {
+            try
+            {
+                return CountMinSketch::deserialize(blob.GetDataUnsafe(), blob.GetSize());
+            }
+            catch (const std::exception &e)
+            {
+                throw InvalidInputException("Failed to deserialize Count-Min sketch: %s", e.what());
+            }
+        }
+
+        // ============================================================
+        // 2. State & Operations
+        // ============================================================
+        struct DSCountMinState
+        {
+            CountMinStateSketch *sketch = nullptr;
+
+            ~DSCountMinState()
+            {
+                if (sketch)
+                    delete sketch;
+            }
+
+            void Create(const DSCountMinBindData &bind_data)
+            {
+                if (!sketch)
+                    sketch = new CountMinStateSketch(bind_data.num_hashes, bind_data.num_buckets);
+            }
+
+            void Merge(const CountMinStateSketch &other)
+            {
+                if (!sketch)
+                {
+                    sketch = new CountMinStateSketch(other);
+                    return;
+                }
+                try
+                {
+                    sketch->merge(other);
+                }
+                catch (const std::exception &e)
+                {
+                    throw InvalidInputException("Failed to merge Count-Min sketches: %s", e.what());
+                }
+            }
+        };
+
+        struct DSCountMinOperationBase
+        {
+            template <class STATE>
+            static void Initialize(STATE &state)
+            {
+                state.sketch = nullptr;
+            }
+            template <class STATE>
+            static void Destroy(STATE &state, AggregateInputData &)
+            {
+                if (state.sketch)
+                    delete state.sketch;
+            }
+            static bool IgnoreNull() { return true; }
+
+            template <class STATE, class OP>
+            static void Combine(const STATE &source, STATE &target, AggregateInputData &)
+            {
+                if (source.sketch)
+                    target.Merge(*source.sketch);
+            }
+
+            template <class T, class STATE>
+            static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data)
+            {
+                if (!state.sketch)
+                {
+                    auto &bind_data = finalize_data.input.bind_data->template Cast<DSCountMinBindData>();
+                    if (!bind_data.num_hashes)
+                    {
+                        // Merging no sketches: the parameters are unknown.
+                        finalize_data.ReturnNull();
+                        return;
+                    }
+                    state.Create(bind_data);
+                }
+                auto serialized = state.sketch->serialize();
+                target = StringVector::AddStringOrBlob(finalize_data.result, std::string(serialized.begin(), serialized.end()));
+            }
+
+            template <class ITEM_TYPE, class STATE>
+            static void Update(STATE &state, const ITEM_TYPE &item, uint64_t weight, const DSCountMinBindData &bind_data)
+            {
+                state.Create(bind_data);
+                DSWithItemBytes(item, [&](const void *data, size_t size)
+                                   { state.sketch->update(data, size, weight); });
+            }
+        };
+
+        struct DSCountMinOperation : DSCountMinOperationBase
+        {
+            template <class A_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &input, AggregateUnaryInput &idata)
+            {
+                auto &bind_data = idata.input.bind_data->template Cast<DSCountMinBindData>();
+                Update(state, input, 1, bind_data);
+            }
+
+            template <class INPUT_TYPE, class STATE, class OP>
+            static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t count)
+            {
+                // A constant vector is one item seen count times.
+                auto &bind_data = unary_input.input.bind_data->template Cast<DSCountMinBindData>();
+                Update(state, input, count, bind_data);
+            }
+        };
+
+        struct DSCountMinWeightedOperation : DSCountMinOperationBase
+        {
+            template <class A_TYPE, class B_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &input, const B_TYPE &weight, AggregateBinaryInput &idata)
+            {
+                if (weight < 0)
+                    throw InvalidInputException("Count-Min weight must not be negative, got: %d", weight);
+                auto &bind_data = idata.input.bind_data->template Cast<DSCountMinBindData>();
+                Update(state, input, (uint64_t)weight, bind_data);
+            }
+        };
+
+        struct DSCountMinMergeOperation : DSCountMinOperationBase
+        {
+            template <class A_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &input, AggregateUnaryInput &)
+            {
+                auto sketch = [&]()
+                {
+                    try
+                    {
+                        return CountMinStateSketch::deserialize(input.GetDataUnsafe(), input.GetSize());
+                    }
+                    catch (const std::exception &e)
+                    {
+                        throw InvalidInputException("Failed to deserialize Count-Min sketch: %s", e.what());
+                    }
+                }();
+                state.Merge(sketch);
+            }
+
+            template <class INPUT_TYPE, class STATE, class OP>
+            static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t count)
+            {
+                for (idx_t i = 0; i < count; i++)
+                {
+                    Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+                }
+            }
+        };
+
+        // ============================================================
+        // 3. Scalar Functions
+        // ============================================================
+        enum class DSCountMinProbe : uint8_t
+        {
+            ESTIMATE,
+            LOWER_BOUND,
+            UPPER_BOUND
+        };
+
+        template <DSCountMinProbe PROBE, class T>
+        static int64_t DSCountMinQuery(const CountMinSketch &sketch, const T &item)
+        {
+            return DSWithItemBytes(item, [&](const void *data, size_t size)
+                                      {
+                                          switch (PROBE)
+                                          {
+                                          case DSCountMinProbe::LOWER_BOUND:
+                                              return (int64_t)sketch.get_lower_bound(data, size);
+                                          case DSCountMinProbe::UPPER_BOUND:
+                                              return (int64_t)sketch.get_upper_bound(data, size);
+                                          default:
+                                              return (int64_t)sketch.get_estimate(data, size);
+                                          } });
+        }
+
+        // Probes are usually a column of items against one sketch, so a
+        // constant sketch is deserialized once per vector and each item is
+        // hashed once.
+        template <DSCountMinProbe PROBE, class T>
+        static void DSCountMinProbeItems(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            auto &sketch_vector = args.data[0];
+            if (sketch_vector.GetVectorType() == VectorType::CONSTANT_VECTOR)
+            {
+                if (ConstantVector::IsNull(sketch_vector))
+                {
+                    result.SetVectorType(VectorType::CONSTANT_VECTOR);
+                    ConstantVector::SetNull(result, true);
+                    return;
+                }
+                auto sketch = DSCountMinDeserialize(*ConstantVector::GetData<string_t>(sketch_vector));
+                UnaryExecutor::Execute<T, int64_t>(args.data[1], result, args.size(),
+                                                   [&](T item)
+                                                   {
+                                                       return DSCountMinQuery<PROBE>(sketch, item);
+                                                   });
+                return;
+            }
+            BinaryExecutor::Execute<string_t, T, int64_t>(sketch_vector, args.data[1], result, args.size(),
+                                                          [&](string_t sketch_blob, T item)
+                                                          {
+                                                              return DSCountMinQuery<PROBE>(DSCountMinDeserialize(sketch_blob), item);
+                                                          });
+        }
+
+        static void DSCountMinTotalWeight(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            UnaryExecutor::Execute<string_t, int64_t>(args.data[0], result, args.size(),
+                                                      [&](string_t sketch_blob)
+                                                      {
+                                                          return (int64_t)DSCountMinDeserialize(sketch_blob).get_total_weight();
+                                                      });
+        }
+
+        static void DSCountMinIsEmpty(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            UnaryExecutor::Execute<string_t, bool>(args.data[0], result, args.size(),
+                                                   [&](string_t sketch_blob)
+                                                   {
+                                                       return DSCountMinDeserialize(sketch_blob).is_empty();
+                                                   });
+        }
+
+        static void DSCountMinSummary(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat sketch_data;
+            args.data[0].ToUnifiedFormat(count, sketch_data);
+            auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_data);
+            auto &struct_entries = StructVector::GetEntries(result);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+
+                auto sketch = DSCountMinDeserialize(sketch_entries[sketch_idx]);
+                FlatVector::GetData<bool>(*struct_entries[0])[i] = sketch.is_empty();
+                FlatVector::GetData<int32_t>(*struct_entries[1])[i] = (int32_t)sketch.get_num_hashes();
+                FlatVector::GetData<int32_t>(*struct_entries[2])[i] = (int32_t)sketch.get_num_buckets();
+                FlatVector::GetData<int64_t>(*struct_entries[3])[i] = (int64_t)sketch.get_total_weight();
+                FlatVector::GetData<double>(*struct_entries[4])[i] = sketch.get_relative_error();
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
+        static void DSCountMinSuggestNumHashes(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            UnaryExecutor::Execute<double, int32_t>(args.data[0], result, args.size(),
+                                                    [&](double confidence)
+                                                    {
+                                                        if (!(confidence > 0 && confidence < 1))
+                                                            throw InvalidInputException("Count-Min confidence must be between 0 and 1 exclusive, got: %f", confidence);
+                                                        return (int32_t)CountMinSketch::suggest_num_hashes(confidence);
+                                                    });
+        }
+
+        static void DSCountMinSuggestNumBuckets(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            UnaryExecutor::Execute<double, int64_t>(args.data[0], result, args.size(),
+                                                    [&](double relative_error)
+                                                    {
+                                                        if (!(relative_error > 0))
+                                                            throw InvalidInputException("Count-Min relative_error must be positive, got: %f", relative_error);
+                                                        return (int64_t)CountMinSketch::suggest_num_buckets(relative_error);
+                                                    });
+        }
+
+        // ============================================================
+        // 4. Registration Helpers
+        // ============================================================
+        static LogicalType CreateCountMinSketchType(ExtensionLoader &loader)
+        {
+            auto new_type = LogicalType(LogicalTypeId::BLOB);
+            auto new_type_name = "sketch_count_min";
+
+            auto type_info = CreateTypeInfo(new_type_name, LogicalType::BLOB);
+            type_info.temporary = false;
+            type_info.internal = true;
+            type_info.comment = "Sketch type for Count-Min Sketch";
+            new_type.SetAlias(new_type_name);
+
+            auto &system_catalog = Catalog::GetSystemCatalog(loader.GetDatabaseInstance());
+            auto data = CatalogTransaction::GetSystemTransaction(loader.GetDatabaseInstance());
+            system_catalog.CreateType(data, type_info);
+
+            loader.RegisterCastFunction(LogicalType::BLOB, new_type, DefaultCasts::ReinterpretCast, 1);
+            loader.RegisterCastFunction(new_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast, 1);
+
+            return new_type;
+        }
+
+        template <typename T>
+        void RegisterCountMin(AggregateFunctionSet &set, const LogicalType &input_type, const LogicalType &result_type)
+        {
+            auto fun = AggregateFunction::UnaryAggregateDestructor<DSCountMinState, T, string_t, DSCountMinOperation, AggregateDestructorType::LEGACY>(
+                input_type, result_type);
+            fun.bind = DSTrackedBind<DSCountMinBind>;
+            fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            fun.arguments = {LogicalType::INTEGER, LogicalType::INTEGER, input_type};
+            set.AddFunction(fun);
+
+            auto fun_weighted = AggregateFunction::BinaryAggregate<DSCountMinState, T, int64_t, string_t, DSCountMinWeightedOperation, AggregateDestructorType::LEGACY>(
+                input_type, LogicalType::BIGINT, result_type);
+            fun_weighted.destructor = AggregateFunction::StateDestroy<DSCountMinState, DSCountMinWeightedOperation>;
+            fun_weighted.bind = DSTrackedBind<DSCountMinBind>;
+            fun_weighted.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            fun_weighted.arguments = {LogicalType::INTEGER, LogicalType::INTEGER, input_type, LogicalType::BIGINT};
+            set.AddFunction(fun_weighted);
+        }
+
+        template <DSCountMinProbe PROBE>
+        static ScalarFunctionSet CountMinProbeSet(const string &name, const LogicalType &sketch_type)
+        {
+            ScalarFunctionSet set(name);
+            set.AddFunction(ScalarFunction({sketch_type, LogicalType::TINYINT}, LogicalType::BIGINT, DSCountMinProbeItems<PROBE, int8_t>));
+            set.AddFunction(ScalarFunction({sketch_type, LogicalType::SMALLINT}, LogicalType::BIGINT, DSCountMinProbeItems<PROBE, int16_t>));
+            set.AddFunction(ScalarFunction({sketch_type, LogicalType::INTEGER}, LogicalType::BIGINT, DSCountMinProbeItems<PROBE, int32_t>));
+            set.AddFunction(ScalarFunction({sketch_type, LogicalType::BIGINT}, LogicalType::BIGINT, DSCountMinProbeItems<PROBE, int64_t>));
+            set.AddFunction(ScalarFunction({sketch_type, LogicalType::UTINYINT}, LogicalType::BIGINT, DSCountMinProbeItems<PROBE, uint8_t>));
+            set.AddFunction(ScalarFunction({sketch_type, LogicalType::USMALLINT}, LogicalType::BIGINT, DSCountMinProbeItems<PROBE, uint16_t>));
+            set.AddFunction(ScalarFunction({sketch_type, LogicalType::UINTEGER}, LogicalType::BIGINT, DSCountMinProbeItems<PROBE, uint32_t>));
+            set.AddFunction(ScalarFunction({sketch_type, LogicalType::UBIGINT}, LogicalType::BIGINT, DSCountMinProbeItems<PROBE, uint64_t>));
+            set.AddFunction(ScalarFunction({sketch_type, LogicalType::FLOAT}, LogicalType::BIGINT, DSCountMinProbeItems<PROBE, float>));
+            set.AddFunction(ScalarFunction({sketch_type, LogicalType::DOUBLE}, LogicalType::BIGINT, DSCountMinProbeItems<PROBE, double>));
+            set.AddFunction(ScalarFunction({sketch_type, LogicalType::VARCHAR}, LogicalType::BIGINT, DSCountMinProbeItems<PROBE, string_t>));
+            return set;
+        }
+    }
+
+    // ============================================================
+    // 5. Main Loader
+    // ============================================================
+    void LoadCountMinSketch(ExtensionLoader &loader)
+    {
+        auto sketch_type = CreateCountMinSketchType(loader);
+
+        AggregateFunctionSet sketch_agg("datasketch_count_min");
+
+        // --- 1. ITEMS, UNWEIGHTED AND WEIGHTED ---
+        // NOTE: Not for BLOB - it conflicts with the sketch merge operation.
+        RegisterCountMin<int8_t>(sketch_agg, LogicalType::TINYINT, sketch_type);
+        RegisterCountMin<int16_t>(sketch_agg, LogicalType::SMALLINT, sketch_type);
+        RegisterCountMin<int32_t>(sketch_agg, LogicalType::INTEGER, sketch_type);
+        RegisterCountMin<int64_t>(sketch_agg, LogicalType::BIGINT, sketch_type);
+        RegisterCountMin<uint8_t>(sketch_agg, LogicalType::UTINYINT, sketch_type);
+        RegisterCountMin<uint16_t>(sketch_agg, LogicalType::USMALLINT, sketch_type);
+        RegisterCountMin<uint32_t>(sketch_agg, LogicalType::UINTEGER, sketch_type);
+        RegisterCountMin<uint64_t>(sketch_agg, LogicalType::UBIGINT, sketch_type);
+        RegisterCountMin<float>(sketch_agg, LogicalType::FLOAT, sketch_type);
+        RegisterCountMin<double>(sketch_agg, LogicalType::DOUBLE, sketch_type);
+        RegisterCountMin<string_t>(sketch_agg, LogicalType::VARCHAR, sketch_type);
+
+        // --- 2. MERGE SKETCHES ---
+        auto fun_merge = AggregateFunction::UnaryAggregateDestructor<DSCountMinState, string_t, string_t, DSCountMinMergeOperation, AggregateDestructorType::LEGACY>(
+            sketch_type, sketch_type);
+        fun_merge.bind = DSTrackedBind<DSCountMinMergeBind>;
+        fun_merge.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+        sketch_agg.AddFunction(fun_merge);
+
+        {
+            CreateAggregateFunctionInfo info(sketch_agg);
+            FunctionDescription desc;
+            desc.description = "Creates a Count-Min sketch for point frequency estimates of any item, optionally weighted, or merges such sketches";
+            desc.examples.push_back("datasketch_count_min(5, 2048, ip_address)");
+            desc.examples.push_back("datasketch_count_min(5, 2048, ip_address, bytes)");
+            desc.examples.push_back("datasketch_count_min(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+
+        // --- SCALAR FUNCTIONS ---
+        {
+            CreateScalarFunctionInfo info(CountMinProbeSet<DSCountMinProbe::ESTIMATE>("datasketch_count_min_estimate", sketch_type));
+            FunctionDescription desc;
+            desc.description = "Returns the estimated frequency (total weight) of an item; never less than the true value";
+            desc.examples.push_back("datasketch_count_min_estimate(sketch, '10.0.0.1')");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(CountMinProbeSet<DSCountMinProbe::LOWER_BOUND>("datasketch_count_min_lower_bound", sketch_type));
+            FunctionDescription desc;
+            desc.description = "Returns the lower bound of the frequency of an item";
+            desc.examples.push_back("datasketch_count_min_lower_bound(sketch, '10.0.0.1')");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(CountMinProbeSet<DSCountMinProbe::UPPER_BOUND>("datasketch_count_min_upper_bound", sketch_type));
+            FunctionDescription desc;
+            desc.description = "Returns the upper bound of the frequency of an item";
+            desc.examples.push_back("datasketch_count_min_upper_bound(sketch, '10.0.0.1')");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_count_min_total_weight",
+                                                         {sketch_type}, LogicalType::BIGINT, DSCountMinTotalWeight));
+            FunctionDescription desc;
+            desc.description = "Returns the total weight of all items processed by the sketch";
+            desc.examples.push_back("datasketch_count_min_total_weight(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_count_min_is_empty",
+                                                         {sketch_type}, LogicalType::BOOLEAN, DSCountMinIsEmpty));
+            FunctionDescription desc;
+            desc.description = "Returns true if the sketch is empty";
+            desc.examples.push_back("datasketch_count_min_is_empty(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            child_list_t<LogicalType> struct_fields;
+            struct_fields.push_back({"is_empty", LogicalType::BOOLEAN});
+            struct_fields.push_back({"num_hashes", LogicalType::INTEGER});
+            struct_fields.push_back({"num_buckets", LogicalType::INTEGER});
+            struct_fields.push_back({"total_weight", LogicalType::BIGINT});
+            struct_fields.push_back({"relative_error", LogicalType::DOUBLE});
+
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_count_min_summary",
+                                                         {sketch_type}, LogicalType::STRUCT(struct_fields), DSCountMinSummary));
+            FunctionDescription desc;
+            desc.description = "Returns a struct of the parameters and total weight of the sketch from a single deserialization";
+            desc.examples.push_back("datasketch_count_min_summary(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_count_min_suggest_num_hashes",
+                                                         {LogicalType::DOUBLE}, LogicalType::INTEGER, DSCountMinSuggestNumHashes));
+            FunctionDescription desc;
+            desc.description = "Returns the number of hash functions needed for estimates to hold with the given confidence";
+            desc.examples.push_back("datasketch_count_min_suggest_num_hashes(0.99)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_count_min_suggest_num_buckets",
+                                                         {LogicalType::DOUBLE}, LogicalType::BIGINT, DSCountMinSuggestNumBuckets));
+            FunctionDescription desc;
+            desc.description = "Returns the number of buckets needed for the given relative error of the estimates";
+            desc.examples.push_back("datasketch_count_min_suggest_num_buckets(0.001)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+    }
+
+}
@@ -25,7 +25,15 @@ namespace duckdb
     void LoadHLLSketch(ExtensionLoader &loader);
     void LoadCPCSketch(ExtensionLoader &loader);
     void LoadThetaSketch(ExtensionLoader &loader);
+    void LoadTupleSketch(ExtensionLoader &loader);
     void LoadFrequentItemsSketch(ExtensionLoader &loader);
+    void LoadCountMinSketch(ExtensionLoader &loader);
+    void LoadBloomFilter(ExtensionLoader &loader);
+    void LoadSamplingSketches(ExtensionLoader &loader);
+    void LoadDensitySketch(ExtensionLoader &loader);
+    void LoadSketchMemory(ExtensionLoader &loader);
+    void LoadSketchPack(ExtensionLoader &loader);
+    void LoadDistinctMulti(ExtensionLoader &loader);
 
     static void LoadInternal(ExtensionLoader &loader)
     {
@@ -36,7 +44,15 @@ namespace duckdb
         LoadHLLSketch(loader);
         LoadCPCSketch(loader);
         LoadThetaSketch(loader);
+        LoadTupleSketch(loader);
         LoadFrequentItemsSketch(loader);
+        LoadCountMinSketch(loader);
+        LoadBloomFilter(loader);
+        LoadSamplingSketches(loader);
+        LoadDensitySketch(loader);
+        LoadSketchMemory(loader);
+        LoadSketchPack(loader);
+        LoadDistinctMulti(loader);
         QueryFarmSendTelemetry(loader, "datasketches", "2025121201");
     }
 
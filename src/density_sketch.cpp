@@ -0,0 +1,461 @@
+#include "datasketches_extension.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_aggregate_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_type_info.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+#include <DataSketches/density_sketch.hpp>
+#include <vector>
+
+#include "sketch_memory.hpp"
+
+namespace duckdb
+{
+    namespace
+    {
+        // Sketches held in aggregate states allocate through the tracking allocator.
+        using DensityStateSketch = datasketches::density_sketch<double, datasketches::gaussian_kernel<double>, DSTrackingAllocator<double>>;
+        using DensitySketch = datasketches::density_sketch<double>;
+        using DensityStatePoint = std::vector<double, DSTrackingAllocator<double>>;
+
+        // A density sketch keeps a bounded coreset of the points it has seen
+        // and estimates the Gaussian kernel density at any point from it.
+        // Memory grows with k and only logarithmically with the number of
+        // points, so outliers can be scored without a full kernel pass.
+
+        // ============================================================
+        // 1. Helpers & Bind Data
+        // ============================================================
+        struct DSDensityBindData : public DSSketchBindData
+        {
+            DSDensityBindData(uint16_t k, uint32_t dim) : k(k), dim(dim) {}
+            unique_ptr<FunctionData> Copy() const override { return make_uniq<DSDensityBindData>(*this); }
+            bool Equals(const FunctionData &other_p) const override
+            {
+                auto &other = other_p.Cast<DSDensityBindData>();
+                return k == other.k && dim == other.dim;
+            }
+            // Both 0 when merging, where the sketches carry their parameters.
+            uint16_t k;
+            uint32_t dim;
+        };
+
+        static int64_t DSDensityConstantArgument(ClientContext &context, Expression &expr, const char *name)
+        {
+            if (expr.HasParameter())
+                throw ParameterNotResolvedException();
+            if (!expr.IsFoldable())
+                throw BinderException("Density sketch %s must be constant", name);
+            Value val = ExpressionExecutor::EvaluateScalar(context, expr);
+            if (val.IsNull())
+                throw BinderException("Density sketch %s cannot be NULL", name);
+            return val.GetValue<int64_t>();
+        }
+
+        unique_ptr<FunctionData> DSDensityBind(ClientContext &context, AggregateFunction &function,
+                                               vector<unique_ptr<Expression>> &arguments)
+        {
+            auto k = DSDensityConstantArgument(context, *arguments[0], "k");
+            auto dim = DSDensityConstantArgument(context, *arguments[1], "dim");
+            if (k < 2 || k > NumericLimits<uint16_t>::Maximum())
+                throw InvalidInputException("Density sketch k must be between 2 and %d, got: %d",
+                                            (int32_t)NumericLimits<uint16_t>::Maximum(), k);
+            if (dim < 1 || dim > NumericLimits<int32_t>::Maximum())
+                throw InvalidInputException("Density sketch dim must be positive, got: %d", dim);
+            Function::EraseArgument(function, arguments, 1);
+            Function::EraseArgument(function, arguments, 0);
+            return make_uniq<DSDensityBindData>((uint16_t)k, (uint32_t)dim);
+        }
+
+        unique_ptr<FunctionData> DSDensityMergeBind(ClientContext &context, AggregateFunction &function,
+                                                    vector<unique_ptr<Expression>> &arguments)
+        {
+            return make_uniq<DSDensityBindData>(0, 0);
+        }
+
+        // Copies the list at row `idx` into `point`, checking its length.
+        template <class POINT>
+        static void DSDensityReadPoint(const list_entry_t &entry, const UnifiedVectorFormat &child_format, uint32_t dim,
+                                       POINT &point)
+        {
+            if (entry.length != dim)
+            {
+                throw InvalidInputException("Density sketch points must have %d dimensions, got: %d", (int64_t)dim,
+                                            (int64_t)entry.length);
+            }
+            auto child_data = UnifiedVectorFormat::GetData<double>(child_format);
+            point.resize(entry.length);
+            for (idx_t i = 0; i < entry.length; i++)
+            {
+                auto child_idx = child_format.sel->get_index(entry.offset + i);
+                if (!child_format.validity.RowIsValid(child_idx))
+                {
+                    throw InvalidInputException("Density sketch points cannot contain NULL");
+                }
+                point[i] = child_data[child_idx];
+            }
+        }
+
+        static DensitySketch DSDensityDeserialize(const string_t &blob)
+        {
+            try
+            {
+                return DensitySketch::deserialize(blob.GetDataUnsafe(), blob.GetSize());
+            }
+            catch (const std::exception &e)
+            {
+                throw InvalidInputException("Failed to deserialize Density sketch: %s", e.what());
+            }
+        }
+
+        // ============================================================
+        // 2. State & Operations
+        // ============================================================
+        struct DSDensityState
+        {
+            DensityStateSketch *sketch = nullptr;
+
+            ~DSDensityState()
+            {
+                if (sketch)
+                    delete sketch;
+            }
+
+            void Create(const DSDensityBindData &bind_data)
+            {
+                if (!sketch)
+                    sketch = new DensityStateSketch(bind_data.k, bind_data.dim);
+            }
+
+            void Merge(const DensityStateSketch &other)
+            {
+                if (!sketch)
+                {
+                    sketch = new DensityStateSketch(other);
+                    return;
+                }
+                try
+                {
+                    sketch->merge(other);
+                }
+                catch (const std::exception &e)
+                {
+                    throw InvalidInputException("Failed to merge Density sketches: %s", e.what());
+                }
+            }
+        };
+
+        struct DSDensityOperationBase
+        {
+            template <class STATE>
+            static void Initialize(STATE &state)
+            {
+                state.sketch = nullptr;
+            }
+            template <class STATE>
+            static void Destroy(STATE &state, AggregateInputData &)
+            {
+                if (state.sketch)
+                    delete state.sketch;
+            }
+            static bool IgnoreNull() { return true; }
+
+            template <class STATE, class OP>
+            static void Combine(const STATE &source, STATE &target, AggregateInputData &)
+            {
+                if (source.sketch)
+                    target.Merge(*source.sketch);
+            }
+
+            template <class T, class STATE>
+            static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data)
+            {
+                if (!state.sketch)
+                {
+                    auto &bind_data = finalize_data.input.bind_data->template Cast<DSDensityBindData>();
+                    if (!bind_data.k)
+                    {
+                        // Merging no sketches: k and dim are unknown.
+                        finalize_data.ReturnNull();
+                        return;
+                    }
+                    state.Create(bind_data);
+                }
+                auto serialized = state.sketch->serialize();
+                target = StringVector::AddStringOrBlob(finalize_data.result, std::string(serialized.begin(), serialized.end()));
+            }
+        };
+
+        // Builds the sketch from DOUBLE[] points.  The points are lists, so the
+        // update functions are written out as for the AoD tuple sketch.
+        struct DSDensityCreateOperation : DSDensityOperationBase
+        {
+            static void ScatterUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                      Vector &states, idx_t count)
+            {
+                D_ASSERT(input_count == 1);
+                auto &bind_data = aggr_input_data.bind_data->Cast<DSDensityBindData>();
+                UnifiedVectorFormat list_format;
+                inputs[0].ToUnifiedFormat(count, list_format);
+                UnifiedVectorFormat child_format;
+                ListVector::GetEntry(inputs[0]).ToUnifiedFormat(ListVector::GetListSize(inputs[0]), child_format);
+                UnifiedVectorFormat state_format;
+                states.ToUnifiedFormat(count, state_format);
+
+                auto lists = UnifiedVectorFormat::GetData<list_entry_t>(list_format);
+                auto state_data = UnifiedVectorFormat::GetData<DSDensityState *>(state_format);
+                DensityStatePoint point;
+                for (idx_t i = 0; i < count; i++)
+                {
+                    auto list_idx = list_format.sel->get_index(i);
+                    if (!list_format.validity.RowIsValid(list_idx))
+                        continue;
+                    auto &state = *state_data[state_format.sel->get_index(i)];
+                    DSDensityReadPoint(lists[list_idx], child_format, bind_data.dim, point);
+                    state.Create(bind_data);
+                    state.sketch->update(point);
+                }
+            }
+
+            static void SimpleUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                     data_ptr_t state_p, idx_t count)
+            {
+                D_ASSERT(input_count == 1);
+                auto &bind_data = aggr_input_data.bind_data->Cast<DSDensityBindData>();
+                UnifiedVectorFormat list_format;
+                inputs[0].ToUnifiedFormat(count, list_format);
+                UnifiedVectorFormat child_format;
+                ListVector::GetEntry(inputs[0]).ToUnifiedFormat(ListVector::GetListSize(inputs[0]), child_format);
+
+                auto lists = UnifiedVectorFormat::GetData<list_entry_t>(list_format);
+                auto &state = *reinterpret_cast<DSDensityState *>(state_p);
+                DensityStatePoint point;
+                for (idx_t i = 0; i < count; i++)
+                {
+                    auto list_idx = list_format.sel->get_index(i);
+                    if (!list_format.validity.RowIsValid(list_idx))
+                        continue;
+                    DSDensityReadPoint(lists[list_idx], child_format, bind_data.dim, point);
+                    state.Create(bind_data);
+                    state.sketch->update(point);
+                }
+            }
+        };
+
+        struct DSDensityMergeOperation : DSDensityOperationBase
+        {
+            template <class A_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &input, AggregateUnaryInput &)
+            {
+                auto sketch = [&]()
+                {
+                    try
+                    {
+                        return DensityStateSketch::deserialize(input.GetDataUnsafe(), input.GetSize());
+                    }
+                    catch (const std::exception &e)
+                    {
+                        throw InvalidInputException("Failed to deserialize Density sketch: %s", e.what());
+                    }
+                }();
+                state.Merge(sketch);
+            }
+
+            template <class INPUT_TYPE, class STATE, class OP>
+            static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t count)
+            {
+                for (idx_t i = 0; i < count; i++)
+                {
+                    Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+                }
+            }
+        };
+
+        // ============================================================
+        // 3. Scalar Functions
+        // ============================================================
+
+        // Scoring is usually a column of points against one sketch, so a
+        // constant sketch is deserialized once per vector.
+        static void DSDensityEstimate(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            auto &sketch_vector = args.data[0];
+            UnifiedVectorFormat sketch_data;
+            sketch_vector.ToUnifiedFormat(count, sketch_data);
+            auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_data);
+            UnifiedVectorFormat list_data;
+            args.data[1].ToUnifiedFormat(count, list_data);
+            auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(list_data);
+            UnifiedVectorFormat child_data;
+            ListVector::GetEntry(args.data[1]).ToUnifiedFormat(ListVector::GetListSize(args.data[1]), child_data);
+
+            unique_ptr<DensitySketch> constant_sketch;
+            if (sketch_vector.GetVectorType() == VectorType::CONSTANT_VECTOR && !ConstantVector::IsNull(sketch_vector))
+            {
+                constant_sketch = make_uniq<DensitySketch>(DSDensityDeserialize(*ConstantVector::GetData<string_t>(sketch_vector)));
+            }
+
+            result.SetVectorType(VectorType::FLAT_VECTOR);
+            auto result_data = FlatVector::GetData<double>(result);
+            std::vector<double> point;
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                idx_t list_idx = list_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx) || !list_data.validity.RowIsValid(list_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+
+                if (constant_sketch)
+                {
+                    DSDensityReadPoint(list_entries[list_idx], child_data, constant_sketch->get_dim(), point);
+                    result_data[i] = constant_sketch->get_estimate(point);
+                }
+                else
+                {
+                    auto sketch = DSDensityDeserialize(sketch_entries[sketch_idx]);
+                    DSDensityReadPoint(list_entries[list_idx], child_data, sketch.get_dim(), point);
+                    result_data[i] = sketch.get_estimate(point);
+                }
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
+        static void DSDensitySummary(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat sketch_data;
+            args.data[0].ToUnifiedFormat(count, sketch_data);
+            auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_data);
+            auto &struct_entries = StructVector::GetEntries(result);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+
+                auto sketch = DSDensityDeserialize(sketch_entries[sketch_idx]);
+                FlatVector::GetData<bool>(*struct_entries[0])[i] = sketch.is_empty();
+                FlatVector::GetData<int32_t>(*struct_entries[1])[i] = (int32_t)sketch.get_k();
+                FlatVector::GetData<int32_t>(*struct_entries[2])[i] = (int32_t)sketch.get_dim();
+                FlatVector::GetData<int64_t>(*struct_entries[3])[i] = (int64_t)sketch.get_n();
+                FlatVector::GetData<int64_t>(*struct_entries[4])[i] = (int64_t)sketch.get_num_retained();
+                FlatVector::GetData<bool>(*struct_entries[5])[i] = sketch.is_estimation_mode();
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
+        // ============================================================
+        // 4. Registration Helpers
+        // ============================================================
+        static LogicalType CreateDensitySketchType(ExtensionLoader &loader)
+        {
+            auto new_type = LogicalType(LogicalTypeId::BLOB);
+            auto new_type_name = "sketch_density";
+
+            auto type_info = CreateTypeInfo(new_type_name, LogicalType::BLOB);
+            type_info.temporary = false;
+            type_info.internal = true;
+            type_info.comment = "Sketch type for Density Sketch";
+            new_type.SetAlias(new_type_name);
+
+            auto &system_catalog = Catalog::GetSystemCatalog(loader.GetDatabaseInstance());
+            auto data = CatalogTransaction::GetSystemTransaction(loader.GetDatabaseInstance());
+            system_catalog.CreateType(data, type_info);
+
+            loader.RegisterCastFunction(LogicalType::BLOB, new_type, DefaultCasts::ReinterpretCast, 1);
+            loader.RegisterCastFunction(new_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast, 1);
+
+            return new_type;
+        }
+    }
+
+    // ============================================================
+    // 5. Main Loader
+    // ============================================================
+    void LoadDensitySketch(ExtensionLoader &loader)
+    {
+        auto sketch_type = CreateDensitySketchType(loader);
+        auto point_type = LogicalType::LIST(LogicalType::DOUBLE);
+
+        AggregateFunctionSet sketch_agg("datasketch_density");
+
+        // 1. POINTS (FLOAT[n] and DOUBLE[n] arrays cast to DOUBLE[])
+        {
+            using STATE = DSDensityState;
+            using OP = DSDensityCreateOperation;
+            AggregateFunction fun({LogicalType::INTEGER, LogicalType::INTEGER, point_type}, sketch_type,
+                                  AggregateFunction::StateSize<STATE>,
+                                  AggregateFunction::StateInitialize<STATE, OP, AggregateDestructorType::LEGACY>,
+                                  OP::ScatterUpdate, AggregateFunction::StateCombine<STATE, OP>,
+                                  AggregateFunction::StateFinalize<STATE, string_t, OP>, OP::SimpleUpdate);
+            fun.destructor = AggregateFunction::StateDestroy<STATE, OP>;
+            fun.bind = DSTrackedBind<DSDensityBind>;
+            fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            sketch_agg.AddFunction(fun);
+        }
+
+        // 2. MERGE SKETCHES
+        auto fun_merge = AggregateFunction::UnaryAggregateDestructor<DSDensityState, string_t, string_t, DSDensityMergeOperation, AggregateDestructorType::LEGACY>(
+            sketch_type, sketch_type);
+        fun_merge.bind = DSTrackedBind<DSDensityMergeBind>;
+        fun_merge.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+        sketch_agg.AddFunction(fun_merge);
+
+        {
+            CreateAggregateFunctionInfo info(sketch_agg);
+            FunctionDescription desc;
+            desc.description = "Creates a Density sketch of dim-dimensional points for Gaussian kernel density estimates, or merges such sketches";
+            desc.examples.push_back("datasketch_density(32, 3, embedding)");
+            desc.examples.push_back("datasketch_density(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+
+        // --- SCALAR FUNCTIONS ---
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_density_estimate", {sketch_type, point_type},
+                                                         LogicalType::DOUBLE, DSDensityEstimate));
+            FunctionDescription desc;
+            desc.description = "Returns the estimated kernel density at a point; low values mark outliers";
+            desc.examples.push_back("datasketch_density_estimate(sketch, embedding)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            child_list_t<LogicalType> struct_fields;
+            struct_fields.push_back({"is_empty", LogicalType::BOOLEAN});
+            struct_fields.push_back({"k", LogicalType::INTEGER});
+            struct_fields.push_back({"dim", LogicalType::INTEGER});
+            struct_fields.push_back({"n", LogicalType::BIGINT});
+            struct_fields.push_back({"num_retained", LogicalType::BIGINT});
+            struct_fields.push_back({"is_estimation_mode", LogicalType::BOOLEAN});
+
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_density_summary",
+                                                         {sketch_type}, LogicalType::STRUCT(struct_fields), DSDensitySummary));
+            FunctionDescription desc;
+            desc.description = "Returns a struct of the parameters, number of points seen and points retained of the sketch";
+            desc.examples.push_back("datasketch_density_summary(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+    }
+
+}
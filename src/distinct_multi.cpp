@@ -0,0 +1,458 @@
+#include "datasketches_extension.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+#include "duckdb/parser/parsed_data/create_aggregate_function_info.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#include <DataSketches/hll.hpp>
+#include <DataSketches/cpc_sketch.hpp>
+#include <DataSketches/cpc_union.hpp>
+#include <DataSketches/theta_sketch.hpp>
+#include <DataSketches/theta_union.hpp>
+
+#include "sketch_memory.hpp"
+#include "distinct_update.hpp"
+
+namespace duckdb
+{
+    namespace
+    {
+        // Sketches held in aggregate states allocate through the tracking allocator.
+        using DSHLLSketch = datasketches::hll_sketch_alloc<DSTrackingAllocator<uint8_t>>;
+        using DSHLLUnion = datasketches::hll_union_alloc<DSTrackingAllocator<uint8_t>>;
+        using DSCPCSketch = datasketches::cpc_sketch_alloc<DSTrackingAllocator<uint8_t>>;
+        using DSCPCUnion = datasketches::cpc_union_alloc<DSTrackingAllocator<uint8_t>>;
+        using ThetaUpdateSketch = datasketches::update_theta_sketch_alloc<DSTrackingAllocator<uint64_t>>;
+        using ThetaUnion = datasketches::theta_union_alloc<DSTrackingAllocator<uint64_t>>;
+
+        // ============================================================
+        // 1. Bind Data
+        // ============================================================
+        //
+        // datasketch_distinct_multi(lg_k, value[, families]) builds an HLL, a
+        // CPC and a Theta sketch of the same column in one aggregate.  The
+        // input is read, null checked and deduplicated once for all of them;
+        // each sketch still hashes the value itself, since DataSketches does
+        // not accept precomputed hashes.  The result is a STRUCT with one
+        // field per requested family, each equal to what datasketch_hll,
+        // datasketch_cpc or datasketch_theta would return for the column.
+
+        constexpr uint8_t FAMILY_HLL = 1;
+        constexpr uint8_t FAMILY_CPC = 2;
+        constexpr uint8_t FAMILY_THETA = 4;
+
+        struct DSDistinctMultiBindData : public DSSketchBindData
+        {
+            DSDistinctMultiBindData(uint8_t lg_k, uint8_t families) : lg_k(lg_k), families(families) {}
+
+            unique_ptr<FunctionData> Copy() const override
+            {
+                return make_uniq<DSDistinctMultiBindData>(*this);
+            }
+
+            bool Equals(const FunctionData &other_p) const override
+            {
+                auto &other = other_p.Cast<DSDistinctMultiBindData>();
+                return lg_k == other.lg_k && families == other.families;
+            }
+
+            uint8_t lg_k;
+            uint8_t families;
+        };
+
+        static uint8_t DSDistinctMultiFamily(const string &name)
+        {
+            auto lower = StringUtil::Lower(name);
+            if (lower == "hll")
+            {
+                return FAMILY_HLL;
+            }
+            if (lower == "cpc")
+            {
+                return FAMILY_CPC;
+            }
+            if (lower == "theta")
+            {
+                return FAMILY_THETA;
+            }
+            throw InvalidInputException("datasketch_distinct_multi family must be one of 'hll', 'cpc' or 'theta', got: '%s'", name);
+        }
+
+        static Value DSDistinctMultiConstant(ClientContext &context, Expression &argument, const string &name)
+        {
+            if (argument.HasParameter())
+            {
+                throw ParameterNotResolvedException();
+            }
+            if (!argument.IsFoldable())
+            {
+                throw BinderException("datasketch_distinct_multi %s must be constant", name);
+            }
+            auto value = ExpressionExecutor::EvaluateScalar(context, argument);
+            if (value.IsNull())
+            {
+                throw BinderException("datasketch_distinct_multi %s cannot be NULL", name);
+            }
+            return value;
+        }
+
+        static void DSDistinctMultiCheckLgK(int32_t lg_k, int32_t min, int32_t max, const char *family)
+        {
+            if (lg_k < min || lg_k > max)
+            {
+                throw InvalidInputException("%s K (lg_k) value must be between %d and %d, got: %d", family, min, max, lg_k);
+            }
+        }
+
+        static LogicalType DSDistinctMultiSketchType(const string &name)
+        {
+            auto type = LogicalType(LogicalTypeId::BLOB);
+            type.SetAlias(name);
+            return type;
+        }
+
+        static unique_ptr<FunctionData> DSDistinctMultiBind(ClientContext &context, AggregateFunction &function,
+                                                            vector<unique_ptr<Expression>> &arguments)
+        {
+            auto lg_k = DSDistinctMultiConstant(context, *arguments[0], "lg_k").GetValue<int32_t>();
+
+            uint8_t families = FAMILY_HLL | FAMILY_CPC | FAMILY_THETA;
+            if (arguments.size() > 2)
+            {
+                families = 0;
+                auto list = DSDistinctMultiConstant(context, *arguments[2], "families");
+                for (auto &family : ListValue::GetChildren(list))
+                {
+                    if (family.IsNull())
+                    {
+                        throw InvalidInputException("datasketch_distinct_multi family cannot be NULL");
+                    }
+                    families |= DSDistinctMultiFamily(family.GetValue<string>());
+                }
+                if (!families)
+                {
+                    throw InvalidInputException("datasketch_distinct_multi requires at least one family");
+                }
+                Function::EraseArgument(function, arguments, 2);
+            }
+
+            child_list_t<LogicalType> fields;
+            if (families & FAMILY_HLL)
+            {
+                DSDistinctMultiCheckLgK(lg_k, 4, 21, "HLL");
+                fields.emplace_back("hll", DSDistinctMultiSketchType("sketch_hll"));
+            }
+            if (families & FAMILY_CPC)
+            {
+                DSDistinctMultiCheckLgK(lg_k, 4, 26, "CPC");
+                fields.emplace_back("cpc", DSDistinctMultiSketchType("sketch_cpc"));
+            }
+            if (families & FAMILY_THETA)
+            {
+                DSDistinctMultiCheckLgK(lg_k, datasketches::theta_constants::MIN_LG_K,
+                                        datasketches::theta_constants::MAX_LG_K, "Theta");
+                fields.emplace_back("theta", DSDistinctMultiSketchType("sketch_theta"));
+            }
+            function.return_type = LogicalType::STRUCT(std::move(fields));
+
+            Function::EraseArgument(function, arguments, 0);
+            return make_uniq<DSDistinctMultiBindData>(uint8_t(lg_k), families);
+        }
+
+        // ============================================================
+        // 2. State & Operations
+        // ============================================================
+
+        struct DSDistinctMultiState
+        {
+            DSHLLSketch *hll = nullptr;
+            DSHLLUnion *hll_union = nullptr;
+            DSCPCSketch *cpc = nullptr;
+            DSCPCUnion *cpc_union = nullptr;
+            ThetaUpdateSketch *theta = nullptr;
+            ThetaUnion *theta_union = nullptr;
+
+            ~DSDistinctMultiState()
+            {
+                Free();
+            }
+
+            bool IsEmpty() const
+            {
+                return !hll && !hll_union && !cpc && !cpc_union && !theta && !theta_union;
+            }
+
+            void CreateSketches(const DSDistinctMultiBindData &bind_data)
+            {
+                if (bind_data.families & FAMILY_HLL)
+                {
+                    hll = new DSHLLSketch(bind_data.lg_k, datasketches::target_hll_type::HLL_4);
+                }
+                if (bind_data.families & FAMILY_CPC)
+                {
+                    cpc = new DSCPCSketch(bind_data.lg_k);
+                }
+                if (bind_data.families & FAMILY_THETA)
+                {
+                    ThetaUpdateSketch::builder b;
+                    b.set_lg_k(bind_data.lg_k);
+                    theta = new ThetaUpdateSketch(b.build());
+                }
+            }
+
+            // Moves the sketches into unions so that other states can be merged in.
+            void CreateUnions(const DSDistinctMultiBindData &bind_data)
+            {
+                if ((bind_data.families & FAMILY_HLL) && !hll_union)
+                {
+                    hll_union = new DSHLLUnion(bind_data.lg_k);
+                }
+                if ((bind_data.families & FAMILY_CPC) && !cpc_union)
+                {
+                    cpc_union = new DSCPCUnion(bind_data.lg_k);
+                }
+                if ((bind_data.families & FAMILY_THETA) && !theta_union)
+                {
+                    ThetaUnion::builder b;
+                    b.set_lg_k(bind_data.lg_k);
+                    theta_union = new ThetaUnion(b.build());
+                }
+                // Only the sketches: merging the unions' own results back
+                // into them would reprocess every entry on each call.
+                if (hll)
+                {
+                    hll_union->update(*hll);
+                }
+                if (cpc)
+                {
+                    cpc_union->update(*cpc);
+                }
+                if (theta)
+                {
+                    theta_union->update(*theta);
+                }
+                DeleteSketches();
+            }
+
+            void MergeInto(DSHLLUnion *hll_target, DSCPCUnion *cpc_target, ThetaUnion *theta_target) const
+            {
+                if (hll)
+                {
+                    hll_target->update(*hll);
+                }
+                if (hll_union)
+                {
+                    hll_target->update(hll_union->get_result(datasketches::target_hll_type::HLL_8));
+                }
+                if (cpc)
+                {
+                    cpc_target->update(*cpc);
+                }
+                if (cpc_union)
+                {
+                    cpc_target->update(cpc_union->get_result());
+                }
+                if (theta)
+                {
+                    theta_target->update(*theta);
+                }
+                // The union does not need the entries ordered, so skip sorting them.
+                if (theta_union)
+                {
+                    theta_target->update(theta_union->get_result(false));
+                }
+            }
+
+            void DeleteSketches()
+            {
+                delete hll;
+                hll = nullptr;
+                delete cpc;
+                cpc = nullptr;
+                delete theta;
+                theta = nullptr;
+            }
+
+            void Free()
+            {
+                DeleteSketches();
+                delete hll_union;
+                hll_union = nullptr;
+                delete cpc_union;
+                cpc_union = nullptr;
+                delete theta_union;
+                theta_union = nullptr;
+            }
+        };
+
+        struct DSDistinctMultiOperation
+        {
+            // Inserting a value twice leaves every sketch unchanged.
+            static constexpr bool IDEMPOTENT = true;
+
+            template <class STATE>
+            static void Initialize(STATE &state)
+            {
+                state.hll = nullptr;
+                state.hll_union = nullptr;
+                state.cpc = nullptr;
+                state.cpc_union = nullptr;
+                state.theta = nullptr;
+                state.theta_union = nullptr;
+            }
+
+            template <class STATE>
+            static void Destroy(STATE &state, AggregateInputData &)
+            {
+                state.Free();
+            }
+
+            static bool IgnoreNull() { return true; }
+
+            template <class A_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &a_data, AggregateUnaryInput &idata)
+            {
+                if (!state.hll && !state.cpc && !state.theta)
+                {
+                    state.CreateSketches(idata.input.bind_data->template Cast<DSDistinctMultiBindData>());
+                }
+                if constexpr (std::is_same_v<A_TYPE, duckdb::string_t>)
+                {
+                    auto data = a_data.GetData();
+                    auto size = a_data.GetSize();
+                    if (state.hll)
+                        state.hll->update(data, size);
+                    if (state.cpc)
+                        state.cpc->update(data, size);
+                    if (state.theta)
+                        state.theta->update(data, size);
+                }
+                else
+                {
+                    if (state.hll)
+                        state.hll->update(a_data);
+                    if (state.cpc)
+                        state.cpc->update(a_data);
+                    if (state.theta)
+                        state.theta->update(a_data);
+                }
+            }
+
+            template <class INPUT_TYPE, class STATE, class OP>
+            static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t count)
+            {
+                Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+            }
+
+            template <class STATE, class OP>
+            static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data)
+            {
+                if (source.IsEmpty())
+                {
+                    return;
+                }
+                target.CreateUnions(aggr_input_data.bind_data->template Cast<DSDistinctMultiBindData>());
+                source.MergeInto(target.hll_union, target.cpc_union, target.theta_union);
+            }
+        };
+
+        template <class BYTES>
+        static string_t DSDistinctMultiAdd(Vector &vector, const BYTES &bytes)
+        {
+            return StringVector::AddStringOrBlob(vector, string(bytes.begin(), bytes.end()));
+        }
+
+        static void DSDistinctMultiFinalize(Vector &states, AggregateInputData &aggr_input_data, Vector &result,
+                                            idx_t count, idx_t offset)
+        {
+            auto &bind_data = aggr_input_data.bind_data->Cast<DSDistinctMultiBindData>();
+            UnifiedVectorFormat state_format;
+            states.ToUnifiedFormat(count, state_format);
+            auto state_data = UnifiedVectorFormat::GetData<DSDistinctMultiState *>(state_format);
+            auto &fields = StructVector::GetEntries(result);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                auto &state = *state_data[state_format.sel->get_index(i)];
+                auto rid = i + offset;
+                if (state.IsEmpty())
+                {
+                    FlatVector::SetNull(result, rid, true);
+                    continue;
+                }
+                if (state.hll_union || state.cpc_union || state.theta_union)
+                {
+                    state.CreateUnions(bind_data);
+                }
+
+                idx_t field = 0;
+                if (bind_data.families & FAMILY_HLL)
+                {
+                    auto &vector = *fields[field++];
+                    auto serialized = state.hll_union ? state.hll_union->get_result(datasketches::target_hll_type::HLL_4).serialize_updatable()
+                                                      : state.hll->serialize_updatable();
+                    FlatVector::GetData<string_t>(vector)[rid] = DSDistinctMultiAdd(vector, serialized);
+                }
+                if (bind_data.families & FAMILY_CPC)
+                {
+                    auto &vector = *fields[field++];
+                    auto serialized = state.cpc_union ? state.cpc_union->get_result().serialize() : state.cpc->serialize();
+                    FlatVector::GetData<string_t>(vector)[rid] = DSDistinctMultiAdd(vector, serialized);
+                }
+                if (bind_data.families & FAMILY_THETA)
+                {
+                    auto &vector = *fields[field++];
+                    auto serialized = state.theta_union ? state.theta_union->get_result().serialize() : state.theta->compact().serialize();
+                    FlatVector::GetData<string_t>(vector)[rid] = DSDistinctMultiAdd(vector, serialized);
+                }
+            }
+        }
+
+        template <typename T>
+        static void RegisterDistinctMulti(AggregateFunctionSet &set, const LogicalType &input_type)
+        {
+            using STATE = DSDistinctMultiState;
+            using OP = DSDistinctMultiOperation;
+            auto fun = AggregateFunction::UnaryAggregateDestructor<STATE, T, string_t, OP, AggregateDestructorType::LEGACY>(
+                input_type, LogicalType::BLOB);
+            DSUseDistinctUpdate<STATE, T, OP>(fun);
+            fun.finalize = DSDistinctMultiFinalize;
+            fun.bind = DSTrackedBind<DSDistinctMultiBind>;
+            fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+            set.AddFunction(fun);
+
+            fun.arguments.push_back(LogicalType::LIST(LogicalType::VARCHAR));
+            set.AddFunction(fun);
+        }
+    } // namespace
+
+    // ============================================================
+    // 3. Loader
+    // ============================================================
+
+    void LoadDistinctMulti(ExtensionLoader &loader)
+    {
+        AggregateFunctionSet set("datasketch_distinct_multi");
+        RegisterDistinctMulti<int8_t>(set, LogicalType::TINYINT);
+        RegisterDistinctMulti<int16_t>(set, LogicalType::SMALLINT);
+        RegisterDistinctMulti<int32_t>(set, LogicalType::INTEGER);
+        RegisterDistinctMulti<int64_t>(set, LogicalType::BIGINT);
+        RegisterDistinctMulti<uint8_t>(set, LogicalType::UTINYINT);
+        RegisterDistinctMulti<uint16_t>(set, LogicalType::USMALLINT);
+        RegisterDistinctMulti<uint32_t>(set, LogicalType::UINTEGER);
+        RegisterDistinctMulti<uint64_t>(set, LogicalType::UBIGINT);
+        RegisterDistinctMulti<float>(set, LogicalType::FLOAT);
+        RegisterDistinctMulti<double>(set, LogicalType::DOUBLE);
+        RegisterDistinctMulti<string_t>(set, LogicalType::VARCHAR);
+        RegisterDistinctMulti<string_t>(set, LogicalType::BLOB);
+
+        CreateAggregateFunctionInfo info(set);
+        FunctionDescription desc;
+        desc.description = "Builds HLL, CPC and Theta sketches of one column in a single pass and returns them as a struct";
+        desc.examples.push_back("datasketch_distinct_multi(14, uid)");
+        desc.examples.push_back("datasketch_distinct_multi(14, uid, ['hll', 'theta']).theta");
+        info.descriptions.push_back(desc);
+        loader.RegisterFunction(info);
+    }
+
+} // namespace duckdb
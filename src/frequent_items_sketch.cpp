@@ -11,33 +11,46 @@
 #include <string>
 #include <type_traits>
 
+#include "sketch_memory.hpp"
+#include "deferred_k.hpp"
+
 namespace duckdb
 {
     namespace
     {
-        using FrequentItemsSketch = datasketches::frequent_items_sketch<std::string>;
+        // Sketches held in aggregate states allocate through the tracking allocator.
+        using FrequentItemsSketch = datasketches::frequent_items_sketch<std::string, uint64_t, std::hash<std::string>,
+                                                                        std::equal_to<std::string>,
+                                                                        DSTrackingAllocator<std::string>>;
 
         // ============================================================
         // 1. Helpers & Bind Data
         // ============================================================
-        struct DSFreqItemsBindData : public FunctionData
+        struct DSFreqItemsBindData : public DSSketchBindData
         {
             DSFreqItemsBindData() : lg_max_k(10) {}
             explicit DSFreqItemsBindData(uint8_t lg_max_k) : lg_max_k(lg_max_k) {}
-            unique_ptr<FunctionData> Copy() const override { return make_uniq<DSFreqItemsBindData>(lg_max_k); }
+            unique_ptr<FunctionData> Copy() const override { return make_uniq<DSFreqItemsBindData>(*this); }
             bool Equals(const FunctionData &other_p) const override
             {
                 return lg_max_k == other_p.Cast<DSFreqItemsBindData>().lg_max_k;
             }
+            // 0 when lg_max_k is a prepared statement parameter resolved per state.
             uint8_t lg_max_k;
         };
 
+        template <class STATE, class INPUT_TYPE, class OP>
         unique_ptr<FunctionData> DSFreqItemsBind(ClientContext &context, AggregateFunction &function,
                                                  vector<unique_ptr<Expression>> &arguments)
         {
             uint8_t lg_max_k = 10;
             if (arguments.size() == 2)
             {
+                if (arguments[0]->HasParameter())
+                {
+                    DSDeferK<STATE, INPUT_TYPE, OP>(function);
+                    return make_uniq<DSFreqItemsBindData>(0);
+                }
                 if (!arguments[0]->IsFoldable())
                     throw BinderException("Frequent Items lg_max_k must be constant");
                 Value k_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
@@ -54,6 +67,22 @@ namespace duckdb
         struct DSFreqItemsState
         {
             FrequentItemsSketch *sketch = nullptr;
+            // lg_max_k given as a prepared statement parameter, 0 otherwise.
+            int32_t k = 0;
+
+            static void CheckK(int32_t lg_max_k)
+            {
+                if (lg_max_k < 3 || lg_max_k > 26)
+                    throw InvalidInputException("Frequent Items lg_max_k must be between 3 and 26, got: %d", lg_max_k);
+            }
+
+            uint8_t ResolveLgMaxK(const DSFreqItemsBindData &bind_data) const
+            {
+                if (bind_data.lg_max_k)
+                    return bind_data.lg_max_k;
+                return k ? (uint8_t)k : 10;
+            }
+
             ~DSFreqItemsState()
             {
                 if (sketch)
@@ -70,7 +99,11 @@ namespace duckdb
         struct DSFreqItemsOperation
         {
             template <class STATE>
-            static void Initialize(STATE &state) { state.sketch = nullptr; }
+            static void Initialize(STATE &state)
+            {
+                state.sketch = nullptr;
+                state.k = 0;
+            }
             template <class STATE>
             static void Destroy(STATE &state, AggregateInputData &)
             {
@@ -83,7 +116,7 @@ namespace duckdb
             static void Operation(STATE &state, const A_TYPE &input, AggregateUnaryInput &idata)
             {
                 auto &bind_data = idata.input.bind_data->template Cast<DSFreqItemsBindData>();
-                state.Create(bind_data.lg_max_k);
+                state.Create(state.ResolveLgMaxK(bind_data));
 
                 if constexpr (std::is_same_v<A_TYPE, string_t>)
                 {
@@ -114,10 +147,12 @@ namespace duckdb
             {
                 if (!source.sketch)
                     return;
+                if (!target.k)
+                    target.k = source.k;
                 if (!target.sketch)
                 {
                     auto &bind_data = aggr.bind_data->template Cast<DSFreqItemsBindData>();
-                    target.Create(bind_data.lg_max_k);
+                    target.Create(target.ResolveLgMaxK(bind_data));
                 }
                 target.sketch->merge(*source.sketch);
             }
@@ -133,7 +168,7 @@ namespace duckdb
                 else
                 {
                     auto &bind_data = finalize_data.input.bind_data->template Cast<DSFreqItemsBindData>();
-                    FrequentItemsSketch empty_sketch(bind_data.lg_max_k);
+                    FrequentItemsSketch empty_sketch(state.ResolveLgMaxK(bind_data));
                     auto serialized = empty_sketch.serialize();
                     target = StringVector::AddStringOrBlob(finalize_data.result, std::string(serialized.begin(), serialized.end()));
                 }
@@ -153,7 +188,7 @@ namespace duckdb
             static void Operation(STATE &state, const A_TYPE &input, AggregateUnaryInput &idata)
             {
                 auto &bind_data = idata.input.bind_data->template Cast<DSFreqItemsBindData>();
-                state.Create(bind_data.lg_max_k);
+                state.Create(state.ResolveLgMaxK(bind_data));
                 auto input_sketch = FrequentItemsSketch::deserialize(input.GetDataUnsafe(), input.GetSize());
                 state.sketch->merge(input_sketch);
             }
@@ -347,6 +382,37 @@ namespace duckdb
             ListVector::SetListSize(result, current_offset);
         }
 
+        static void DSFreqItemsSummary(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat sketch_data;
+            args.data[0].ToUnifiedFormat(count, sketch_data);
+            auto &struct_entries = StructVector::GetEntries(result);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+
+                string_t sketch_blob = ((string_t *)sketch_data.data)[sketch_idx];
+                auto sketch = DeserializeSketch(sketch_blob);
+                FlatVector::GetData<bool>(*struct_entries[0])[i] = sketch.is_empty();
+                FlatVector::GetData<int64_t>(*struct_entries[1])[i] = (int64_t)sketch.get_num_active_items();
+                FlatVector::GetData<int64_t>(*struct_entries[2])[i] = (int64_t)sketch.get_total_weight();
+                FlatVector::GetData<double>(*struct_entries[3])[i] = sketch.get_epsilon();
+                FlatVector::GetData<int64_t>(*struct_entries[4])[i] = (int64_t)sketch.get_maximum_error();
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
         // ============================================================
         // 4. Registration Helpers
         // ============================================================
@@ -376,7 +442,7 @@ namespace duckdb
         {
             auto fun = AggregateFunction::UnaryAggregateDestructor<DSFreqItemsState, T, string_t, DSFreqItemsOperation, AggregateDestructorType::LEGACY>(
                 input_type, result_type);
-            fun.bind = DSFreqItemsBind;
+            fun.bind = DSTrackedBind<DSFreqItemsBind<DSFreqItemsState, T, DSFreqItemsOperation>>;
             fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
             fun.arguments = {input_type};
             set.AddFunction(fun);
@@ -419,7 +485,7 @@ namespace duckdb
         // --- 2. MERGE SKETCHES (uses sketch_type which is aliased BLOB) ---
         auto fun_merge = AggregateFunction::UnaryAggregateDestructor<DSFreqItemsState, string_t, string_t, DSFreqItemsMergeOperation, AggregateDestructorType::LEGACY>(
             sketch_type, sketch_type);
-        fun_merge.bind = DSFreqItemsBind;
+        fun_merge.bind = DSTrackedBind<DSFreqItemsBind<DSFreqItemsState, string_t, DSFreqItemsMergeOperation>>;
         fun_merge.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
         fun_merge.arguments = {sketch_type};
         sketch_agg.AddFunction(fun_merge);
@@ -540,6 +606,22 @@ namespace duckdb
             info.descriptions.push_back(desc);
             loader.RegisterFunction(info);
         }
+        {
+            child_list_t<LogicalType> struct_fields;
+            struct_fields.push_back({"is_empty", LogicalType::BOOLEAN});
+            struct_fields.push_back({"num_active", LogicalType::BIGINT});
+            struct_fields.push_back({"total_weight", LogicalType::BIGINT});
+            struct_fields.push_back({"epsilon", LogicalType::DOUBLE});
+            struct_fields.push_back({"maximum_error", LogicalType::BIGINT});
+
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_frequent_items_summary",
+                                                         {sketch_type}, LogicalType::STRUCT(struct_fields), DSFreqItemsSummary));
+            FunctionDescription desc;
+            desc.description = "Returns a struct of the metadata of the sketch from a single deserialization";
+            desc.examples.push_back("datasketch_frequent_items_summary(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
 
         // --- GET FREQUENT LIST ---
         {
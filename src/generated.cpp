@@ -4,6 +4,8 @@
 #include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_aggregate_function_info.hpp"
 #include "duckdb/function/scalar_function.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hugeint.hpp"
 
 #include <DataSketches/quantiles_sketch.hpp>
 #include <DataSketches/kll_sketch.hpp>
@@ -13,9 +15,106 @@
 #include <DataSketches/cpc_sketch.hpp>
 #include <DataSketches/cpc_union.hpp>
 
+#include "sketch_memory.hpp"
+#include "deferred_k.hpp"
+#include "distinct_update.hpp"
+#include "distinct_hash.hpp"
+#include "sketch_statistics.hpp"
+#include "hll_registers.hpp"
+
+#include <cstring>
+#include <ostream>
+
+// HUGEINT and DECIMAL items are stored as hugeint_t.  The library only
+// serializes arithmetic types and strings, so hugeint_t is written as its 16
+// bytes in native order like the arithmetic types are.
+namespace datasketches
+{
+template <>
+struct serde<duckdb::hugeint_t> {
+    void serialize(std::ostream &os, const duckdb::hugeint_t *items, unsigned num) const {
+        os.write(reinterpret_cast<const char *>(items), sizeof(duckdb::hugeint_t) * num);
+        if (!os.good()) {
+            throw std::runtime_error("error writing to std::ostream with " + std::to_string(num) + " items");
+        }
+    }
+    void deserialize(std::istream &is, duckdb::hugeint_t *items, unsigned num) const {
+        is.read(reinterpret_cast<char *>(items), sizeof(duckdb::hugeint_t) * num);
+        if (!is.good()) {
+            throw std::runtime_error("error reading from std::istream with " + std::to_string(num) + " items");
+        }
+    }
+    size_t serialize(void *ptr, size_t capacity, const duckdb::hugeint_t *items, unsigned num) const {
+        const size_t bytes = sizeof(duckdb::hugeint_t) * num;
+        check_memory_size(bytes, capacity);
+        std::memcpy(ptr, items, bytes);
+        return bytes;
+    }
+    size_t deserialize(const void *ptr, size_t capacity, duckdb::hugeint_t *items, unsigned num) const {
+        const size_t bytes = sizeof(duckdb::hugeint_t) * num;
+        check_memory_size(bytes, capacity);
+        std::memcpy(items, ptr, bytes);
+        return bytes;
+    }
+    size_t size_of_item(const duckdb::hugeint_t &) const {
+        return sizeof(duckdb::hugeint_t);
+    }
+};
+} // namespace datasketches
+
 namespace duckdb
 {
 
+// Used by to_string() of sketches holding hugeint_t items.
+static inline std::ostream &operator<<(std::ostream &os, const hugeint_t &value) {
+    return os << Hugeint::ToString(value);
+}
+
+// Maps a DuckDB value to the item stored in a quantile sketch.  VARCHAR
+// values only point into their vector, so the sketch keeps owned strings and
+// results are copied back into the result vector.  Every other type is stored
+// as is; temporal types are registered with their physical integer and
+// DECIMAL with the hugeint_t of DECIMAL(38, 18).
+template <class T>
+struct DSQuantileItem {
+    using type = T;
+    static const T &FromDuckDB(const T &value) {
+        return value;
+    }
+    static T ToDuckDB(Vector &result, const T &item) {
+        return item;
+    }
+};
+
+template <>
+struct DSQuantileItem<string_t> {
+    using type = std::string;
+    static std::string FromDuckDB(const string_t &value) {
+        return value.GetString();
+    }
+    static string_t ToDuckDB(Vector &result, const std::string &item) {
+        return StringVector::AddString(result, item);
+    }
+};
+
+template <class T>
+using DSQuantileItemType = typename DSQuantileItem<T>::type;
+
+// Every sketch held in an aggregate state allocates through the tracking
+// allocator so that its memory is accounted for by DuckDB.
+template <class T>
+using DSQuantilesSketch = datasketches::quantiles_sketch<DSQuantileItemType<T>, std::less<DSQuantileItemType<T>>, DSTrackingAllocator<DSQuantileItemType<T>>>;
+template <class T>
+using DSKLLSketch = datasketches::kll_sketch<DSQuantileItemType<T>, std::less<DSQuantileItemType<T>>, DSTrackingAllocator<DSQuantileItemType<T>>>;
+template <class T>
+using DSREQSketch = datasketches::req_sketch<DSQuantileItemType<T>, std::less<DSQuantileItemType<T>>, DSTrackingAllocator<DSQuantileItemType<T>>>;
+template <class T>
+using DSTDigestSketch = datasketches::tdigest<T, DSTrackingAllocator<T>>;
+using DSHLLSketch = datasketches::hll_sketch_alloc<DSTrackingAllocator<uint8_t>>;
+using DSHLLUnion = datasketches::hll_union_alloc<DSTrackingAllocator<uint8_t>>;
+using DSCPCSketch = datasketches::cpc_sketch_alloc<DSTrackingAllocator<uint8_t>>;
+using DSCPCUnion = datasketches::cpc_union_alloc<DSTrackingAllocator<uint8_t>>;
+
 
 static std::string toLowerCase(const std::string& input) {
     std::string result = input;
@@ -25,32 +124,257 @@ static std::string toLowerCase(const std::string& input) {
     return result;
 }
 
+// Name of the item type in sketch type names, e.g. sketch_kll_timestamptz.
+static std::string DSSketchTypeSuffix(const LogicalType &type) {
+    switch (type.id()) {
+    case LogicalTypeId::TIMESTAMP_TZ:
+        return "timestamptz";
+    case LogicalTypeId::DECIMAL:
+        return "decimal";
+    default:
+        return toLowerCase(type.ToString());
+    }
+}
+
+// The BLOB alias a sketch type of the given item type is registered as.
+static LogicalType DSSketchAliasType(const std::string &prefix, const LogicalType &embedded_type) {
+    auto type = LogicalType(LogicalTypeId::BLOB);
+    type.SetAlias(prefix + DSSketchTypeSuffix(embedded_type));
+    return type;
+}
+
+// Quantile sketches hold DECIMAL items as DECIMAL(38, 18), since a sketch
+// type cannot carry a width and scale.  Wider DECIMALs, such as the
+// DECIMAL(38, s) of a sum(), would be rounded or overflow and are sketched
+// as DOUBLE instead.
+static bool DSDecimalItemFits(const LogicalType &type) {
+    auto width = DecimalType::GetWidth(type);
+    auto scale = DecimalType::GetScale(type);
+    return scale <= 18 && width - scale <= 20;
+}
+
+template <class T>
+static void GatherSplitPoints(const UnifiedVectorFormat &children, const T *children_data, const list_entry_t &entry,
+                              std::vector<DSQuantileItemType<T>> &out) {
+    out.resize(entry.length);
+    for (idx_t i = 0; i < entry.length; i++) {
+        auto idx = children.sel->get_index(entry.offset + i);
+        if (!children.validity.RowIsValid(idx)) {
+            throw InvalidInputException("split_points cannot contain NULL values");
+        }
+        out[i] = DSQuantileItem<T>::FromDuckDB(children_data[idx]);
+    }
+}
+
+template <class T>
+static void ValidateSplitPoints(const T *points, idx_t count) {
+    for (idx_t i = 0; i < count; i++) {
+        if constexpr (std::is_floating_point<T>::value) {
+            if (std::isnan(points[i])) {
+                throw InvalidInputException("split_points cannot contain NaN values");
+            }
+        }
+        if (i > 0 && !(points[i - 1] < points[i])) {
+            throw InvalidInputException("split_points must be unique and monotonically increasing");
+        }
+    }
+}
+
+// A sorted view flattens a quantiles sketch into its sorted items and their
+// cumulative weights so that repeated quantile and rank queries are a binary
+// search over the blob, with no deserialization, sort or allocation.
+//
+// Layout (native byte order, little endian on every platform DuckDB supports;
+// a blob written with the other byte order fails the magic check):
+//   uint32_t magic, uint32_t item_size, uint64_t count, uint64_t total_weight,
+//   T items[count], uint64_t cumulative_weights[count]
+//
+// The blob lives in DuckDB's string heap with no alignment guarantee, so all
+// reads go through Load<>.
+template <class T>
+class DSSortedView {
+public:
+    static constexpr uint32_t MAGIC = 0x56534453; // "SDSV"
+    static constexpr idx_t HEADER_SIZE = 2 * sizeof(uint32_t) + 2 * sizeof(uint64_t);
+
+    explicit DSSortedView(const string_t &blob) {
+        auto data = const_data_ptr_cast(blob.GetData());
+        auto size = blob.GetSize();
+        if (size < HEADER_SIZE || Load<uint32_t>(data) != MAGIC || Load<uint32_t>(data + sizeof(uint32_t)) != sizeof(T)) {
+            throw InvalidInputException("Invalid sorted view: unrecognized header");
+        }
+        count = Load<uint64_t>(data + 2 * sizeof(uint32_t));
+        total_weight = Load<uint64_t>(data + 2 * sizeof(uint32_t) + sizeof(uint64_t));
+        if (size != HEADER_SIZE + count * (sizeof(T) + sizeof(uint64_t))) {
+            throw InvalidInputException("Invalid sorted view: size does not match its header");
+        }
+        items = data + HEADER_SIZE;
+        cumulative_weights = items + count * sizeof(T);
+    }
+
+    template <class SKETCH>
+    static string_t Serialize(Vector &result, const SKETCH &sketch) {
+        if (sketch.is_empty()) {
+            auto blob = StringVector::EmptyString(result, HEADER_SIZE);
+            WriteHeader(data_ptr_cast(blob.GetDataWriteable()), 0, 0);
+            blob.Finalize();
+            return blob;
+        }
+
+        auto view = sketch.get_sorted_view();
+        const uint64_t count = view.size();
+        auto blob = StringVector::EmptyString(result, HEADER_SIZE + count * (sizeof(T) + sizeof(uint64_t)));
+        auto data = data_ptr_cast(blob.GetDataWriteable());
+        WriteHeader(data, count, sketch.get_n());
+        auto item_ptr = data + HEADER_SIZE;
+        auto weight_ptr = item_ptr + count * sizeof(T);
+        for (auto it = view.begin(); it != view.end(); ++it) {
+            Store<T>((*it).first, item_ptr);
+            Store<uint64_t>(it.get_cumulative_weight(true), weight_ptr);
+            item_ptr += sizeof(T);
+            weight_ptr += sizeof(uint64_t);
+        }
+        blob.Finalize();
+        return blob;
+    }
+
+    T GetQuantile(double rank, bool inclusive) const {
+        CheckNotEmpty();
+        if (!(rank >= 0.0 && rank <= 1.0)) {
+            throw InvalidInputException("Normalized rank must be between 0 and 1, got: %f", rank);
+        }
+        const uint64_t weight =
+            static_cast<uint64_t>(inclusive ? std::ceil(rank * total_weight) : rank * total_weight);
+        // First entry whose cumulative weight reaches the target weight.
+        idx_t lo = 0;
+        idx_t hi = count;
+        while (lo < hi) {
+            auto mid = lo + (hi - lo) / 2;
+            auto mid_weight = CumulativeWeight(mid);
+            if (inclusive ? mid_weight < weight : mid_weight <= weight) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return Item(lo == count ? count - 1 : lo);
+    }
+
+    double GetRank(const T &item, bool inclusive) const {
+        CheckNotEmpty();
+        return RankOf(item, inclusive);
+    }
+
+    void GetCDF(const T *split_points, idx_t size, bool inclusive, double *out) const {
+        CheckNotEmpty();
+        for (idx_t i = 0; i < size; i++) {
+            out[i] = RankOf(split_points[i], inclusive);
+        }
+        out[size] = 1.0;
+    }
+
+private:
+    static void WriteHeader(data_ptr_t data, uint64_t count, uint64_t total_weight) {
+        Store<uint32_t>(MAGIC, data);
+        Store<uint32_t>(sizeof(T), data + sizeof(uint32_t));
+        Store<uint64_t>(count, data + 2 * sizeof(uint32_t));
+        Store<uint64_t>(total_weight, data + 2 * sizeof(uint32_t) + sizeof(uint64_t));
+    }
+
+    T Item(idx_t idx) const {
+        return Load<T>(items + idx * sizeof(T));
+    }
+
+    uint64_t CumulativeWeight(idx_t idx) const {
+        return Load<uint64_t>(cumulative_weights + idx * sizeof(uint64_t));
+    }
+
+    void CheckNotEmpty() const {
+        if (count == 0) {
+            throw InvalidInputException("Cannot query an empty sorted view");
+        }
+    }
+
+    double RankOf(const T &item, bool inclusive) const {
+        // Count of entries ordered before the item (or equal to it, when inclusive).
+        idx_t lo = 0;
+        idx_t hi = count;
+        while (lo < hi) {
+            auto mid = lo + (hi - lo) / 2;
+            auto mid_item = Item(mid);
+            if (inclusive ? !(item < mid_item) : mid_item < item) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo == 0) {
+            return 0;
+        }
+        return static_cast<double>(CumulativeWeight(lo - 1)) / total_weight;
+    }
+
+    const_data_ptr_t items;
+    const_data_ptr_t cumulative_weights;
+    uint64_t count;
+    uint64_t total_weight;
+};
+
+// A K given as a prepared statement parameter is resolved per state, see
+// deferred_k.hpp.
+template <class BIND_DATA_TYPE, class STATE>
+static int32_t DSResolveK(const STATE &state, const BIND_DATA_TYPE &bind_data) {
+    return bind_data.k ? bind_data.k : state.k;
+}
+
     
 
 
-struct DSQuantilesBindData : public FunctionData {
+struct DSQuantilesBindData : public DSSketchBindData {
 	DSQuantilesBindData() {
 	}
 	explicit DSQuantilesBindData(int32_t k) : k(k) {
 	}
 
 	unique_ptr<FunctionData> Copy() const override {
-		return make_uniq<DSQuantilesBindData>(k);
+		return make_uniq<DSQuantilesBindData>(*this);
 	}
 
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<DSQuantilesBindData>();
+		
         return k == other.k;
+		
 	}
 
+    // 0 when K is a prepared statement parameter resolved per state.
     int32_t k;
+    
+    
 };
 
 
+
+
+static string DSQuantilesKError(int32_t actual_k) {
+	
+	// Validate K parameter: must be in range (0, 32768]
+	if (actual_k <= 0 || actual_k > 32768) {
+		return "Quantiles K value must be between 1 and 32768, got: " + std::to_string(actual_k);
+	}
+	
+	return string();
+}
+
+
+template <class STATE, class INPUT_TYPE, class OP>
 unique_ptr<FunctionData> DSQuantilesBind(ClientContext &context, AggregateFunction &function,
                                             vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = make_uniq<DSQuantilesBindData>(0);
+	
 	if (arguments[0]->HasParameter()) {
-		throw ParameterNotResolvedException();
+		DSDeferK<STATE, INPUT_TYPE, OP>(function);
+		return std::move(bind_data);
 	}
 	if (!arguments[0]->IsFoldable()) {
 		throw BinderException("Quantiles can only take a constant K value");
@@ -61,16 +385,14 @@ unique_ptr<FunctionData> DSQuantilesBind(ClientContext &context, AggregateFuncti
 	}
 
 	auto actual_k = k_val.GetValue<int32_t>();
-
-	
-	// Validate K parameter: must be in range (0, 32768]
-	if (actual_k <= 0 || actual_k > 32768) {
-		throw BinderException("Quantiles K value must be between 1 and 32768, got: " + std::to_string(actual_k));
+	auto error = DSQuantilesKError(actual_k);
+	if (!error.empty()) {
+		throw BinderException(error);
 	}
-	
 
+	bind_data->k = actual_k;
 	Function::EraseArgument(function, arguments, 0);
-	return make_uniq<DSQuantilesBindData>(actual_k);
+	return std::move(bind_data);
 }
 
 
@@ -80,15 +402,37 @@ unique_ptr<FunctionData> DSQuantilesBind(ClientContext &context, AggregateFuncti
     struct DSQuantilesState
     {
         
-        datasketches::quantiles_sketch<T> *sketch = nullptr;
+        DSQuantilesSketch<T> *sketch = nullptr;
+
+        // The first few values of a group are kept inline.  The state itself
+        // lives in DuckDB's aggregate hash table, which can be spilled, so a
+        // GROUP BY over many small groups does not allocate a full sketch
+        // (KLL, for example, preallocates k items) for every group.  Values
+        // that do not own their data (VARCHAR) go straight to the sketch.
+        static constexpr idx_t PENDING_CAPACITY = std::is_same<DSQuantileItemType<T>, T>::value ? 4 : 0;
+        T pending[PENDING_CAPACITY ? PENDING_CAPACITY : 1];
+        uint8_t pending_count = 0;
         
 
+        int32_t k = 0;
+
+        static void CheckK(int32_t k)
+        {
+            auto error = DSQuantilesKError(k);
+            if (!error.empty())
+            {
+                throw InvalidInputException(error);
+            }
+        }
+
         ~DSQuantilesState()
         {
             if (sketch)
             {
                 delete sketch;
             }
+            
+            
         }
 
         
@@ -97,7 +441,7 @@ unique_ptr<FunctionData> DSQuantilesBind(ClientContext &context, AggregateFuncti
             D_ASSERT(!sketch);
             D_ASSERT(k > 0);
             D_ASSERT(k <= 32768);
-            sketch = new datasketches::quantiles_sketch<T>(k);
+            sketch = new DSQuantilesSketch<T>(k);
         }
         
 
@@ -106,16 +450,69 @@ unique_ptr<FunctionData> DSQuantilesBind(ClientContext &context, AggregateFuncti
             if (existing.sketch)
             {
                 
-                sketch = new datasketches::quantiles_sketch<T>(*existing.sketch);
+                sketch = new DSQuantilesSketch<T>(*existing.sketch);
                 
             }
         }
 
         
-        datasketches::quantiles_sketch<T> deserialize_sketch(const string_t &data)
+        bool IsEmpty() const
+        {
+            return !sketch && pending_count == 0;
+        }
+
+        void Update(const T &value, int32_t k)
+        {
+            if (!sketch && pending_count < PENDING_CAPACITY)
+            {
+                pending[pending_count++] = value;
+                return;
+            }
+            Materialize(k);
+            sketch->update(DSQuantileItem<T>::FromDuckDB(value));
+        }
+
+        void Materialize(int32_t k)
+        {
+            if (!sketch)
+            {
+                CreateSketch(k);
+            }
+            for (idx_t i = 0; i < pending_count; i++)
+            {
+                sketch->update(DSQuantileItem<T>::FromDuckDB(pending[i]));
+            }
+            pending_count = 0;
+        }
+
+        void Combine(const DSQuantilesState &source, int32_t k)
+        {
+            if (source.sketch)
+            {
+                if (IsEmpty())
+                {
+                    CreateSketch(source);
+                }
+                else
+                {
+                    Materialize(k);
+                    sketch->merge(*source.sketch);
+                }
+            }
+            for (idx_t i = 0; i < source.pending_count; i++)
+            {
+                Update(source.pending[i], k);
+            }
+        }
+        
+
+        
+
+        
+        DSQuantilesSketch<T> deserialize_sketch(const string_t &data)
         {
             try {
-                return datasketches::quantiles_sketch<T>::deserialize(data.GetDataUnsafe(), data.GetSize());
+                return DSQuantilesSketch<T>::deserialize(data.GetDataUnsafe(), data.GetSize());
             } catch (const std::exception &e) {
                 throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
             }
@@ -128,12 +525,9 @@ unique_ptr<FunctionData> DSQuantilesBind(ClientContext &context, AggregateFuncti
     
     static LogicalType CreateQuantilesSketchType(ExtensionLoader &loader, LogicalType embedded_type)
     {
-        auto new_type = LogicalType(LogicalTypeId::BLOB);
-        auto type_suffix = toLowerCase(embedded_type.ToString());
-        auto new_type_name = "sketch_quantiles_" + type_suffix;
-
+        auto new_type = DSSketchAliasType("sketch_quantiles_", embedded_type);
+        auto new_type_name = new_type.GetAlias();
 
-        new_type.SetAlias(new_type_name);
         auto type_info = CreateTypeInfo(new_type_name, new_type);
         type_info.temporary = false;
         type_info.internal = true;
@@ -147,30 +541,70 @@ unique_ptr<FunctionData> DSQuantilesBind(ClientContext &context, AggregateFuncti
     }
     
 
+    
+    static LogicalType CreateQuantilesSortedViewType(ExtensionLoader &loader, LogicalType embedded_type)
+    {
+        auto new_type = DSSketchAliasType("sketch_quantiles_sorted_view_", embedded_type);
+        auto new_type_name = new_type.GetAlias();
+        auto type_info = CreateTypeInfo(new_type_name, new_type);
+        type_info.temporary = false;
+        type_info.internal = true;
+        type_info.comment = "Sorted view of a Quantiles sketch with embedded type " + embedded_type.ToString();
+        auto &system_catalog = Catalog::GetSystemCatalog(loader.GetDatabaseInstance());
+        auto data = CatalogTransaction::GetSystemTransaction(loader.GetDatabaseInstance());
+        system_catalog.CreateType(data, type_info);
+	    loader.RegisterCastFunction(LogicalType::BLOB, new_type, DefaultCasts::ReinterpretCast, 1);
+        loader.RegisterCastFunction(new_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast, 1);
+        return new_type;
+    }
+    
 
-struct DSKLLBindData : public FunctionData {
+
+struct DSKLLBindData : public DSSketchBindData {
 	DSKLLBindData() {
 	}
 	explicit DSKLLBindData(int32_t k) : k(k) {
 	}
 
 	unique_ptr<FunctionData> Copy() const override {
-		return make_uniq<DSKLLBindData>(k);
+		return make_uniq<DSKLLBindData>(*this);
 	}
 
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<DSKLLBindData>();
+		
         return k == other.k;
+		
 	}
 
+    // 0 when K is a prepared statement parameter resolved per state.
     int32_t k;
+    
+    
 };
 
 
+
+
+static string DSKLLKError(int32_t actual_k) {
+	
+	// Validate K parameter: must be in range (0, 32768]
+	if (actual_k <= 0 || actual_k > 32768) {
+		return "KLL K value must be between 1 and 32768, got: " + std::to_string(actual_k);
+	}
+	
+	return string();
+}
+
+
+template <class STATE, class INPUT_TYPE, class OP>
 unique_ptr<FunctionData> DSKLLBind(ClientContext &context, AggregateFunction &function,
                                             vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = make_uniq<DSKLLBindData>(0);
+	
 	if (arguments[0]->HasParameter()) {
-		throw ParameterNotResolvedException();
+		DSDeferK<STATE, INPUT_TYPE, OP>(function);
+		return std::move(bind_data);
 	}
 	if (!arguments[0]->IsFoldable()) {
 		throw BinderException("KLL can only take a constant K value");
@@ -181,16 +615,14 @@ unique_ptr<FunctionData> DSKLLBind(ClientContext &context, AggregateFunction &fu
 	}
 
 	auto actual_k = k_val.GetValue<int32_t>();
-
-	
-	// Validate K parameter: must be in range (0, 32768]
-	if (actual_k <= 0 || actual_k > 32768) {
-		throw BinderException("KLL K value must be between 1 and 32768, got: " + std::to_string(actual_k));
+	auto error = DSKLLKError(actual_k);
+	if (!error.empty()) {
+		throw BinderException(error);
 	}
-	
 
+	bind_data->k = actual_k;
 	Function::EraseArgument(function, arguments, 0);
-	return make_uniq<DSKLLBindData>(actual_k);
+	return std::move(bind_data);
 }
 
 
@@ -200,15 +632,37 @@ unique_ptr<FunctionData> DSKLLBind(ClientContext &context, AggregateFunction &fu
     struct DSKLLState
     {
         
-        datasketches::kll_sketch<T> *sketch = nullptr;
+        DSKLLSketch<T> *sketch = nullptr;
+
+        // The first few values of a group are kept inline.  The state itself
+        // lives in DuckDB's aggregate hash table, which can be spilled, so a
+        // GROUP BY over many small groups does not allocate a full sketch
+        // (KLL, for example, preallocates k items) for every group.  Values
+        // that do not own their data (VARCHAR) go straight to the sketch.
+        static constexpr idx_t PENDING_CAPACITY = std::is_same<DSQuantileItemType<T>, T>::value ? 4 : 0;
+        T pending[PENDING_CAPACITY ? PENDING_CAPACITY : 1];
+        uint8_t pending_count = 0;
         
 
+        int32_t k = 0;
+
+        static void CheckK(int32_t k)
+        {
+            auto error = DSKLLKError(k);
+            if (!error.empty())
+            {
+                throw InvalidInputException(error);
+            }
+        }
+
         ~DSKLLState()
         {
             if (sketch)
             {
                 delete sketch;
             }
+            
+            
         }
 
         
@@ -217,7 +671,7 @@ unique_ptr<FunctionData> DSKLLBind(ClientContext &context, AggregateFunction &fu
             D_ASSERT(!sketch);
             D_ASSERT(k > 0);
             D_ASSERT(k <= 32768);
-            sketch = new datasketches::kll_sketch<T>(k);
+            sketch = new DSKLLSketch<T>(k);
         }
         
 
@@ -226,16 +680,69 @@ unique_ptr<FunctionData> DSKLLBind(ClientContext &context, AggregateFunction &fu
             if (existing.sketch)
             {
                 
-                sketch = new datasketches::kll_sketch<T>(*existing.sketch);
+                sketch = new DSKLLSketch<T>(*existing.sketch);
                 
             }
         }
 
         
-        datasketches::kll_sketch<T> deserialize_sketch(const string_t &data)
+        bool IsEmpty() const
+        {
+            return !sketch && pending_count == 0;
+        }
+
+        void Update(const T &value, int32_t k)
+        {
+            if (!sketch && pending_count < PENDING_CAPACITY)
+            {
+                pending[pending_count++] = value;
+                return;
+            }
+            Materialize(k);
+            sketch->update(DSQuantileItem<T>::FromDuckDB(value));
+        }
+
+        void Materialize(int32_t k)
+        {
+            if (!sketch)
+            {
+                CreateSketch(k);
+            }
+            for (idx_t i = 0; i < pending_count; i++)
+            {
+                sketch->update(DSQuantileItem<T>::FromDuckDB(pending[i]));
+            }
+            pending_count = 0;
+        }
+
+        void Combine(const DSKLLState &source, int32_t k)
+        {
+            if (source.sketch)
+            {
+                if (IsEmpty())
+                {
+                    CreateSketch(source);
+                }
+                else
+                {
+                    Materialize(k);
+                    sketch->merge(*source.sketch);
+                }
+            }
+            for (idx_t i = 0; i < source.pending_count; i++)
+            {
+                Update(source.pending[i], k);
+            }
+        }
+        
+
+        
+
+        
+        DSKLLSketch<T> deserialize_sketch(const string_t &data)
         {
             try {
-                return datasketches::kll_sketch<T>::deserialize(data.GetDataUnsafe(), data.GetSize());
+                return DSKLLSketch<T>::deserialize(data.GetDataUnsafe(), data.GetSize());
             } catch (const std::exception &e) {
                 throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
             }
@@ -248,12 +755,9 @@ unique_ptr<FunctionData> DSKLLBind(ClientContext &context, AggregateFunction &fu
     
     static LogicalType CreateKLLSketchType(ExtensionLoader &loader, LogicalType embedded_type)
     {
-        auto new_type = LogicalType(LogicalTypeId::BLOB);
-        auto type_suffix = toLowerCase(embedded_type.ToString());
-        auto new_type_name = "sketch_kll_" + type_suffix;
+        auto new_type = DSSketchAliasType("sketch_kll_", embedded_type);
+        auto new_type_name = new_type.GetAlias();
 
-
-        new_type.SetAlias(new_type_name);
         auto type_info = CreateTypeInfo(new_type_name, new_type);
         type_info.temporary = false;
         type_info.internal = true;
@@ -267,30 +771,70 @@ unique_ptr<FunctionData> DSKLLBind(ClientContext &context, AggregateFunction &fu
     }
     
 
+    
+    static LogicalType CreateKLLSortedViewType(ExtensionLoader &loader, LogicalType embedded_type)
+    {
+        auto new_type = DSSketchAliasType("sketch_kll_sorted_view_", embedded_type);
+        auto new_type_name = new_type.GetAlias();
+        auto type_info = CreateTypeInfo(new_type_name, new_type);
+        type_info.temporary = false;
+        type_info.internal = true;
+        type_info.comment = "Sorted view of a KLL sketch with embedded type " + embedded_type.ToString();
+        auto &system_catalog = Catalog::GetSystemCatalog(loader.GetDatabaseInstance());
+        auto data = CatalogTransaction::GetSystemTransaction(loader.GetDatabaseInstance());
+        system_catalog.CreateType(data, type_info);
+	    loader.RegisterCastFunction(LogicalType::BLOB, new_type, DefaultCasts::ReinterpretCast, 1);
+        loader.RegisterCastFunction(new_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast, 1);
+        return new_type;
+    }
+    
+
 
-struct DSREQBindData : public FunctionData {
+struct DSREQBindData : public DSSketchBindData {
 	DSREQBindData() {
 	}
 	explicit DSREQBindData(int32_t k) : k(k) {
 	}
 
 	unique_ptr<FunctionData> Copy() const override {
-		return make_uniq<DSREQBindData>(k);
+		return make_uniq<DSREQBindData>(*this);
 	}
 
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<DSREQBindData>();
+		
         return k == other.k;
+		
 	}
 
+    // 0 when K is a prepared statement parameter resolved per state.
     int32_t k;
+    
+    
 };
 
 
+
+
+static string DSREQKError(int32_t actual_k) {
+	
+	// Validate K parameter: must be in range [4, 1024]
+	if (actual_k < 4 || actual_k > 1024) {
+		return "REQ K value must be between 4 and 1024, got: " + std::to_string(actual_k);
+	}
+	
+	return string();
+}
+
+
+template <class STATE, class INPUT_TYPE, class OP>
 unique_ptr<FunctionData> DSREQBind(ClientContext &context, AggregateFunction &function,
                                             vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = make_uniq<DSREQBindData>(0);
+	
 	if (arguments[0]->HasParameter()) {
-		throw ParameterNotResolvedException();
+		DSDeferK<STATE, INPUT_TYPE, OP>(function);
+		return std::move(bind_data);
 	}
 	if (!arguments[0]->IsFoldable()) {
 		throw BinderException("REQ can only take a constant K value");
@@ -301,16 +845,14 @@ unique_ptr<FunctionData> DSREQBind(ClientContext &context, AggregateFunction &fu
 	}
 
 	auto actual_k = k_val.GetValue<int32_t>();
-
-	
-	// Validate K parameter: must be in range [4, 1024]
-	if (actual_k < 4 || actual_k > 1024) {
-		throw BinderException("REQ K value must be between 4 and 1024, got: " + std::to_string(actual_k));
+	auto error = DSREQKError(actual_k);
+	if (!error.empty()) {
+		throw BinderException(error);
 	}
-	
 
+	bind_data->k = actual_k;
 	Function::EraseArgument(function, arguments, 0);
-	return make_uniq<DSREQBindData>(actual_k);
+	return std::move(bind_data);
 }
 
 
@@ -320,15 +862,37 @@ unique_ptr<FunctionData> DSREQBind(ClientContext &context, AggregateFunction &fu
     struct DSREQState
     {
         
-        datasketches::req_sketch<T> *sketch = nullptr;
+        DSREQSketch<T> *sketch = nullptr;
+
+        // The first few values of a group are kept inline.  The state itself
+        // lives in DuckDB's aggregate hash table, which can be spilled, so a
+        // GROUP BY over many small groups does not allocate a full sketch
+        // (KLL, for example, preallocates k items) for every group.  Values
+        // that do not own their data (VARCHAR) go straight to the sketch.
+        static constexpr idx_t PENDING_CAPACITY = std::is_same<DSQuantileItemType<T>, T>::value ? 4 : 0;
+        T pending[PENDING_CAPACITY ? PENDING_CAPACITY : 1];
+        uint8_t pending_count = 0;
         
 
+        int32_t k = 0;
+
+        static void CheckK(int32_t k)
+        {
+            auto error = DSREQKError(k);
+            if (!error.empty())
+            {
+                throw InvalidInputException(error);
+            }
+        }
+
         ~DSREQState()
         {
             if (sketch)
             {
                 delete sketch;
             }
+            
+            
         }
 
         
@@ -337,7 +901,7 @@ unique_ptr<FunctionData> DSREQBind(ClientContext &context, AggregateFunction &fu
             D_ASSERT(!sketch);
             D_ASSERT(k >= 4);
             D_ASSERT(k <= 1024);
-            sketch = new datasketches::req_sketch<T>(k);
+            sketch = new DSREQSketch<T>(k);
         }
         
 
@@ -346,16 +910,69 @@ unique_ptr<FunctionData> DSREQBind(ClientContext &context, AggregateFunction &fu
             if (existing.sketch)
             {
                 
-                sketch = new datasketches::req_sketch<T>(*existing.sketch);
+                sketch = new DSREQSketch<T>(*existing.sketch);
                 
             }
         }
 
         
-        datasketches::req_sketch<T> deserialize_sketch(const string_t &data)
+        bool IsEmpty() const
+        {
+            return !sketch && pending_count == 0;
+        }
+
+        void Update(const T &value, int32_t k)
+        {
+            if (!sketch && pending_count < PENDING_CAPACITY)
+            {
+                pending[pending_count++] = value;
+                return;
+            }
+            Materialize(k);
+            sketch->update(DSQuantileItem<T>::FromDuckDB(value));
+        }
+
+        void Materialize(int32_t k)
+        {
+            if (!sketch)
+            {
+                CreateSketch(k);
+            }
+            for (idx_t i = 0; i < pending_count; i++)
+            {
+                sketch->update(DSQuantileItem<T>::FromDuckDB(pending[i]));
+            }
+            pending_count = 0;
+        }
+
+        void Combine(const DSREQState &source, int32_t k)
+        {
+            if (source.sketch)
+            {
+                if (IsEmpty())
+                {
+                    CreateSketch(source);
+                }
+                else
+                {
+                    Materialize(k);
+                    sketch->merge(*source.sketch);
+                }
+            }
+            for (idx_t i = 0; i < source.pending_count; i++)
+            {
+                Update(source.pending[i], k);
+            }
+        }
+        
+
+        
+
+        
+        DSREQSketch<T> deserialize_sketch(const string_t &data)
         {
             try {
-                return datasketches::req_sketch<T>::deserialize(data.GetDataUnsafe(), data.GetSize());
+                return DSREQSketch<T>::deserialize(data.GetDataUnsafe(), data.GetSize());
             } catch (const std::exception &e) {
                 throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
             }
@@ -366,18 +983,33 @@ unique_ptr<FunctionData> DSREQBind(ClientContext &context, AggregateFunction &fu
 
 
     
-    static LogicalType CreateREQSketchType(ExtensionLoader &loader, LogicalType embedded_type)
+    static LogicalType CreateREQSketchType(ExtensionLoader &loader, LogicalType embedded_type)
+    {
+        auto new_type = DSSketchAliasType("sketch_req_", embedded_type);
+        auto new_type_name = new_type.GetAlias();
+
+        auto type_info = CreateTypeInfo(new_type_name, new_type);
+        type_info.temporary = false;
+        type_info.internal = true;
+        type_info.comment = "Sketch type for REQ sketch with embedded type " + embedded_type.ToString();
+        auto &system_catalog = Catalog::GetSystemCatalog(loader.GetDatabaseInstance());
+        auto data = CatalogTransaction::GetSystemTransaction(loader.GetDatabaseInstance());
+        system_catalog.CreateType(data, type_info);
+	    loader.RegisterCastFunction(LogicalType::BLOB, new_type, DefaultCasts::ReinterpretCast, 1);
+        loader.RegisterCastFunction(new_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast, 1);
+        return new_type;
+    }
+    
+
+    
+    static LogicalType CreateREQSortedViewType(ExtensionLoader &loader, LogicalType embedded_type)
     {
-        auto new_type = LogicalType(LogicalTypeId::BLOB);
-        auto type_suffix = toLowerCase(embedded_type.ToString());
-        auto new_type_name = "sketch_req_" + type_suffix;
-
-
-        new_type.SetAlias(new_type_name);
+        auto new_type = DSSketchAliasType("sketch_req_sorted_view_", embedded_type);
+        auto new_type_name = new_type.GetAlias();
         auto type_info = CreateTypeInfo(new_type_name, new_type);
         type_info.temporary = false;
         type_info.internal = true;
-        type_info.comment = "Sketch type for REQ sketch with embedded type " + embedded_type.ToString();
+        type_info.comment = "Sorted view of a REQ sketch with embedded type " + embedded_type.ToString();
         auto &system_catalog = Catalog::GetSystemCatalog(loader.GetDatabaseInstance());
         auto data = CatalogTransaction::GetSystemTransaction(loader.GetDatabaseInstance());
         system_catalog.CreateType(data, type_info);
@@ -388,29 +1020,51 @@ unique_ptr<FunctionData> DSREQBind(ClientContext &context, AggregateFunction &fu
     
 
 
-struct DSTDigestBindData : public FunctionData {
+struct DSTDigestBindData : public DSSketchBindData {
 	DSTDigestBindData() {
 	}
 	explicit DSTDigestBindData(int32_t k) : k(k) {
 	}
 
 	unique_ptr<FunctionData> Copy() const override {
-		return make_uniq<DSTDigestBindData>(k);
+		return make_uniq<DSTDigestBindData>(*this);
 	}
 
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<DSTDigestBindData>();
+		
         return k == other.k;
+		
 	}
 
+    // 0 when K is a prepared statement parameter resolved per state.
     int32_t k;
+    
+    
 };
 
 
+
+
+static string DSTDigestKError(int32_t actual_k) {
+	
+	// Validate K parameter: must be positive (TDigest compression parameter)
+	if (actual_k <= 0) {
+		return "TDigest K (compression) value must be positive, got: " + std::to_string(actual_k);
+	}
+	
+	return string();
+}
+
+
+template <class STATE, class INPUT_TYPE, class OP>
 unique_ptr<FunctionData> DSTDigestBind(ClientContext &context, AggregateFunction &function,
                                             vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = make_uniq<DSTDigestBindData>(0);
+	
 	if (arguments[0]->HasParameter()) {
-		throw ParameterNotResolvedException();
+		DSDeferK<STATE, INPUT_TYPE, OP>(function);
+		return std::move(bind_data);
 	}
 	if (!arguments[0]->IsFoldable()) {
 		throw BinderException("TDigest can only take a constant K value");
@@ -421,16 +1075,14 @@ unique_ptr<FunctionData> DSTDigestBind(ClientContext &context, AggregateFunction
 	}
 
 	auto actual_k = k_val.GetValue<int32_t>();
-
-	
-	// Validate K parameter: must be positive (TDigest compression parameter)
-	if (actual_k <= 0) {
-		throw BinderException("TDigest K (compression) value must be positive, got: " + std::to_string(actual_k));
+	auto error = DSTDigestKError(actual_k);
+	if (!error.empty()) {
+		throw BinderException(error);
 	}
-	
 
+	bind_data->k = actual_k;
 	Function::EraseArgument(function, arguments, 0);
-	return make_uniq<DSTDigestBindData>(actual_k);
+	return std::move(bind_data);
 }
 
 
@@ -440,22 +1092,44 @@ unique_ptr<FunctionData> DSTDigestBind(ClientContext &context, AggregateFunction
     struct DSTDigestState
     {
         
-        datasketches::tdigest<T> *sketch = nullptr;
+        DSTDigestSketch<T> *sketch = nullptr;
+
+        // The first few values of a group are kept inline.  The state itself
+        // lives in DuckDB's aggregate hash table, which can be spilled, so a
+        // GROUP BY over many small groups does not allocate a full sketch
+        // (KLL, for example, preallocates k items) for every group.  Values
+        // that do not own their data (VARCHAR) go straight to the sketch.
+        static constexpr idx_t PENDING_CAPACITY = std::is_same<DSQuantileItemType<T>, T>::value ? 4 : 0;
+        T pending[PENDING_CAPACITY ? PENDING_CAPACITY : 1];
+        uint8_t pending_count = 0;
         
 
+        int32_t k = 0;
+
+        static void CheckK(int32_t k)
+        {
+            auto error = DSTDigestKError(k);
+            if (!error.empty())
+            {
+                throw InvalidInputException(error);
+            }
+        }
+
         ~DSTDigestState()
         {
             if (sketch)
             {
                 delete sketch;
             }
+            
+            
         }
 
         
         void CreateSketch(uint16_t k)
         {
             D_ASSERT(!sketch);
-            sketch = new datasketches::tdigest<T>(k);
+            sketch = new DSTDigestSketch<T>(k);
         }
         
 
@@ -464,16 +1138,69 @@ unique_ptr<FunctionData> DSTDigestBind(ClientContext &context, AggregateFunction
             if (existing.sketch)
             {
                 
-                sketch = new datasketches::tdigest<T>(*existing.sketch);
+                sketch = new DSTDigestSketch<T>(*existing.sketch);
                 
             }
         }
 
         
-        datasketches::tdigest<T> deserialize_sketch(const string_t &data)
+        bool IsEmpty() const
+        {
+            return !sketch && pending_count == 0;
+        }
+
+        void Update(const T &value, int32_t k)
+        {
+            if (!sketch && pending_count < PENDING_CAPACITY)
+            {
+                pending[pending_count++] = value;
+                return;
+            }
+            Materialize(k);
+            sketch->update(DSQuantileItem<T>::FromDuckDB(value));
+        }
+
+        void Materialize(int32_t k)
+        {
+            if (!sketch)
+            {
+                CreateSketch(k);
+            }
+            for (idx_t i = 0; i < pending_count; i++)
+            {
+                sketch->update(DSQuantileItem<T>::FromDuckDB(pending[i]));
+            }
+            pending_count = 0;
+        }
+
+        void Combine(const DSTDigestState &source, int32_t k)
+        {
+            if (source.sketch)
+            {
+                if (IsEmpty())
+                {
+                    CreateSketch(source);
+                }
+                else
+                {
+                    Materialize(k);
+                    sketch->merge(*source.sketch);
+                }
+            }
+            for (idx_t i = 0; i < source.pending_count; i++)
+            {
+                Update(source.pending[i], k);
+            }
+        }
+        
+
+        
+
+        
+        DSTDigestSketch<T> deserialize_sketch(const string_t &data)
         {
             try {
-                return datasketches::tdigest<T>::deserialize(data.GetDataUnsafe(), data.GetSize());
+                return DSTDigestSketch<T>::deserialize(data.GetDataUnsafe(), data.GetSize());
             } catch (const std::exception &e) {
                 throw InvalidInputException("Failed to deserialize TDigest sketch: %s", e.what());
             }
@@ -486,12 +1213,9 @@ unique_ptr<FunctionData> DSTDigestBind(ClientContext &context, AggregateFunction
     
     static LogicalType CreateTDigestSketchType(ExtensionLoader &loader, LogicalType embedded_type)
     {
-        auto new_type = LogicalType(LogicalTypeId::BLOB);
-        auto type_suffix = toLowerCase(embedded_type.ToString());
-        auto new_type_name = "sketch_tdigest_" + type_suffix;
+        auto new_type = DSSketchAliasType("sketch_tdigest_", embedded_type);
+        auto new_type_name = new_type.GetAlias();
 
-
-        new_type.SetAlias(new_type_name);
         auto type_info = CreateTypeInfo(new_type_name, new_type);
         type_info.temporary = false;
         type_info.internal = true;
@@ -505,30 +1229,104 @@ unique_ptr<FunctionData> DSTDigestBind(ClientContext &context, AggregateFunction
     }
     
 
+    
+
 
-struct DSHLLBindData : public FunctionData {
+struct DSHLLBindData : public DSSketchBindData {
 	DSHLLBindData() {
 	}
 	explicit DSHLLBindData(int32_t k) : k(k) {
 	}
 
 	unique_ptr<FunctionData> Copy() const override {
-		return make_uniq<DSHLLBindData>(k);
+		return make_uniq<DSHLLBindData>(*this);
 	}
 
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<DSHLLBindData>();
-        return k == other.k;
+		
+        return k == other.k && hll_type == other.hll_type && compact == other.compact &&
+               decimal_scale == other.decimal_scale;
+		
 	}
 
+    // 0 when K is a prepared statement parameter resolved per state.
     int32_t k;
+    
+    // Target type of the result and whether it is serialized in compact form.
+    datasketches::target_hll_type hll_type = datasketches::target_hll_type::HLL_4;
+    bool compact = false;
+    
+    
+    // Scale of a DECIMAL input, see DSBindDecimalInput.
+    uint8_t decimal_scale = 0;
+    
 };
 
 
+static datasketches::target_hll_type DSHLLTargetType(const string &name) {
+	auto upper = StringUtil::Upper(name);
+	if (upper == "HLL_4") {
+		return datasketches::target_hll_type::HLL_4;
+	} else if (upper == "HLL_6") {
+		return datasketches::target_hll_type::HLL_6;
+	} else if (upper == "HLL_8") {
+		return datasketches::target_hll_type::HLL_8;
+	}
+	throw InvalidInputException("HLL type must be one of 'HLL_4', 'HLL_6' or 'HLL_8', got: '%s'", name);
+}
+
+static Value DSHLLConstantArgument(ClientContext &context, Expression &argument, const string &name) {
+	if (argument.HasParameter()) {
+		throw ParameterNotResolvedException();
+	}
+	if (!argument.IsFoldable()) {
+		throw BinderException("HLL %s must be constant", name);
+	}
+	auto value = ExpressionExecutor::EvaluateScalar(context, argument);
+	if (value.IsNull()) {
+		throw BinderException("HLL %s cannot be NULL", name);
+	}
+	return value;
+}
+
+// Reads and removes the optional arguments after the value:
+// datasketch_hll(lg_k, value[, type[, compact]]).
+static void DSHLLBindOptions(ClientContext &context, AggregateFunction &function,
+                             vector<unique_ptr<Expression>> &arguments, DSHLLBindData &bind_data) {
+	if (arguments.size() > 3) {
+		bind_data.compact = DSHLLConstantArgument(context, *arguments[3], "compact").GetValue<bool>();
+		Function::EraseArgument(function, arguments, 3);
+	}
+	if (arguments.size() > 2) {
+		bind_data.hll_type = DSHLLTargetType(DSHLLConstantArgument(context, *arguments[2], "type").GetValue<string>());
+		Function::EraseArgument(function, arguments, 2);
+	}
+}
+
+
+
+static string DSHLLKError(int32_t actual_k) {
+	
+	// Validate K parameter: lg_k must be in range [4, 21] for HLL
+	if (actual_k < 4 || actual_k > 21) {
+		return "HLL K (lg_k) value must be between 4 and 21, got: " + std::to_string(actual_k);
+	}
+	
+	return string();
+}
+
+
+template <class STATE, class INPUT_TYPE, class OP>
 unique_ptr<FunctionData> DSHLLBind(ClientContext &context, AggregateFunction &function,
                                             vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = make_uniq<DSHLLBindData>(0);
+	
+	DSHLLBindOptions(context, function, arguments, *bind_data);
+	
 	if (arguments[0]->HasParameter()) {
-		throw ParameterNotResolvedException();
+		DSDeferK<STATE, INPUT_TYPE, OP>(function);
+		return std::move(bind_data);
 	}
 	if (!arguments[0]->IsFoldable()) {
 		throw BinderException("HLL can only take a constant K value");
@@ -539,16 +1337,14 @@ unique_ptr<FunctionData> DSHLLBind(ClientContext &context, AggregateFunction &fu
 	}
 
 	auto actual_k = k_val.GetValue<int32_t>();
-
-	
-	// Validate K parameter: lg_k must be in range [4, 21] for HLL
-	if (actual_k < 4 || actual_k > 21) {
-		throw BinderException("HLL K (lg_k) value must be between 4 and 21, got: " + std::to_string(actual_k));
+	auto error = DSHLLKError(actual_k);
+	if (!error.empty()) {
+		throw BinderException(error);
 	}
-	
 
+	bind_data->k = actual_k;
 	Function::EraseArgument(function, arguments, 0);
-	return make_uniq<DSHLLBindData>(actual_k);
+	return std::move(bind_data);
 }
 
 
@@ -556,22 +1352,52 @@ unique_ptr<FunctionData> DSHLLBind(ClientContext &context, AggregateFunction &fu
     struct DSHLLState
     {
         
-        datasketches::hll_sketch *sketch = nullptr;
+        DSHLLSketch *sketch = nullptr;
+        // Merged input accumulates here, so that combining many states (for
+        // example the nodes of a window segment tree) does not rebuild a
+        // compact sketch after every merge.
+        DSHLLUnion *union_sketch = nullptr;
+        
+        // Dense HLL_8 inputs of the union's lg_k are merged by taking the
+        // register wise maximum here, without deserializing each sketch.
+        uint8_t *registers = nullptr;
+        uint8_t registers_lg_k = 0;
+        
         
 
+        int32_t k = 0;
+
+        static void CheckK(int32_t k)
+        {
+            auto error = DSHLLKError(k);
+            if (!error.empty())
+            {
+                throw InvalidInputException(error);
+            }
+        }
+
         ~DSHLLState()
         {
             if (sketch)
             {
                 delete sketch;
             }
+            
+            if (union_sketch)
+            {
+                delete union_sketch;
+            }
+            
+            
+            FreeRegisters();
+            
         }
 
         
-        void CreateSketch(uint16_t k)
+        void CreateSketch(uint16_t k, datasketches::target_hll_type hll_type)
         {
             D_ASSERT(!sketch);
-            sketch = new datasketches::hll_sketch(k);
+            sketch = new DSHLLSketch(k, hll_type);
         }
         
 
@@ -580,16 +1406,113 @@ unique_ptr<FunctionData> DSHLLBind(ClientContext &context, AggregateFunction &fu
             if (existing.sketch)
             {
                 
-                sketch = new datasketches::hll_sketch(*existing.sketch);
+                sketch = new DSHLLSketch(*existing.sketch);
+                
+            }
+        }
+
+        
+
+        
+        void CreateUnion(uint8_t lg_k)
+        {
+            if (!union_sketch)
+            {
+                union_sketch = new DSHLLUnion(lg_k);
+            }
+            if (sketch)
+            {
+                union_sketch->update(*sketch);
+                delete sketch;
+                sketch = nullptr;
+            }
+        }
+
+        void MergeInto(DSHLLUnion &target) const
+        {
+            if (sketch)
+            {
+                target.update(*sketch);
+            }
+            if (union_sketch)
+            {
+                
+                target.update(union_sketch->get_result(datasketches::target_hll_type::HLL_8));
+                
+            }
+        }
+
+        
+        void MergeRegisters(const uint8_t *source, uint8_t lg_k)
+        {
+            auto count = idx_t(1) << lg_k;
+            if (registers && registers_lg_k != lg_k)
+            {
+                FlushRegisters();
+            }
+            if (!registers)
+            {
+                registers = DSTrackingAllocator<uint8_t>().allocate(count);
+                registers_lg_k = lg_k;
+                memcpy(registers, source, count);
+                return;
+            }
+            DSHLLMaxRegisters(registers, source, count);
+        }
+
+        // Moves the merged registers into the union sketch.
+        void FlushRegisters()
+        {
+            if (!registers)
+            {
+                return;
+            }
+            auto image = DSHLLRegistersImage(registers, registers_lg_k);
+            auto merged = DSHLLSketch::deserialize(image.data(), image.size());
+            CreateUnion(registers_lg_k);
+            union_sketch->update(merged);
+            FreeRegisters();
+        }
+
+        void FreeRegisters()
+        {
+            if (registers)
+            {
+                DSTrackingAllocator<uint8_t>().deallocate(registers, idx_t(1) << registers_lg_k);
+                registers = nullptr;
+            }
+        }
+
+        DSHLLSketch GetResult(datasketches::target_hll_type hll_type)
+        
+        {
+            if (!union_sketch)
+            {
+                
+                if (sketch->get_target_type() != hll_type)
+                {
+                    return DSHLLSketch(*sketch, hll_type);
+                }
                 
+                return *sketch;
+            }
+            if (sketch)
+            {
+                union_sketch->update(*sketch);
+                delete sketch;
+                sketch = nullptr;
             }
+            
+            return union_sketch->get_result(hll_type);
+            
         }
+        
 
         
-        datasketches::hll_sketch deserialize_sketch(const string_t &data)
+        DSHLLSketch deserialize_sketch(const string_t &data)
         {
             try {
-                return datasketches::hll_sketch::deserialize(data.GetDataUnsafe(), data.GetSize());
+                return DSHLLSketch::deserialize(data.GetDataUnsafe(), data.GetSize());
             } catch (const std::exception &e) {
                 throw InvalidInputException("Failed to deserialize HLL sketch: %s", e.what());
             }
@@ -618,30 +1541,57 @@ unique_ptr<FunctionData> DSHLLBind(ClientContext &context, AggregateFunction &fu
     }
     
 
+    
+
 
-struct DSCPCBindData : public FunctionData {
+struct DSCPCBindData : public DSSketchBindData {
 	DSCPCBindData() {
 	}
 	explicit DSCPCBindData(int32_t k) : k(k) {
 	}
 
 	unique_ptr<FunctionData> Copy() const override {
-		return make_uniq<DSCPCBindData>(k);
+		return make_uniq<DSCPCBindData>(*this);
 	}
 
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<DSCPCBindData>();
-        return k == other.k;
+		
+        return k == other.k && decimal_scale == other.decimal_scale;
+		
 	}
 
+    // 0 when K is a prepared statement parameter resolved per state.
     int32_t k;
+    
+    
+    // Scale of a DECIMAL input, see DSBindDecimalInput.
+    uint8_t decimal_scale = 0;
+    
 };
 
 
+
+
+static string DSCPCKError(int32_t actual_k) {
+	
+	// Validate K parameter: lg_k must be in range [4, 26] for CPC
+	if (actual_k < 4 || actual_k > 26) {
+		return "CPC K (lg_k) value must be between 4 and 26, got: " + std::to_string(actual_k);
+	}
+	
+	return string();
+}
+
+
+template <class STATE, class INPUT_TYPE, class OP>
 unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &function,
                                             vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = make_uniq<DSCPCBindData>(0);
+	
 	if (arguments[0]->HasParameter()) {
-		throw ParameterNotResolvedException();
+		DSDeferK<STATE, INPUT_TYPE, OP>(function);
+		return std::move(bind_data);
 	}
 	if (!arguments[0]->IsFoldable()) {
 		throw BinderException("CPC can only take a constant K value");
@@ -652,16 +1602,14 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
 	}
 
 	auto actual_k = k_val.GetValue<int32_t>();
-
-	
-	// Validate K parameter: lg_k must be in range [4, 26] for CPC
-	if (actual_k < 4 || actual_k > 26) {
-		throw BinderException("CPC K (lg_k) value must be between 4 and 26, got: " + std::to_string(actual_k));
+	auto error = DSCPCKError(actual_k);
+	if (!error.empty()) {
+		throw BinderException(error);
 	}
-	
 
+	bind_data->k = actual_k;
 	Function::EraseArgument(function, arguments, 0);
-	return make_uniq<DSCPCBindData>(actual_k);
+	return std::move(bind_data);
 }
 
 
@@ -669,40 +1617,115 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
     struct DSCPCState
     {
         
-        datasketches::cpc_sketch *sketch = nullptr;
+        DSCPCSketch *sketch = nullptr;
+        // Merged input accumulates here, so that combining many states (for
+        // example the nodes of a window segment tree) does not rebuild a
+        // compact sketch after every merge.
+        DSCPCUnion *union_sketch = nullptr;
+        
+        
+
+        int32_t k = 0;
+
+        static void CheckK(int32_t k)
+        {
+            auto error = DSCPCKError(k);
+            if (!error.empty())
+            {
+                throw InvalidInputException(error);
+            }
+        }
+
+        ~DSCPCState()
+        {
+            if (sketch)
+            {
+                delete sketch;
+            }
+            
+            if (union_sketch)
+            {
+                delete union_sketch;
+            }
+            
+            
+        }
+
+        
+        void CreateSketch(uint8_t k)
+        {
+            D_ASSERT(!sketch);
+            sketch = new DSCPCSketch(k);
+        }
+        
+
+        void CreateSketch(const DSCPCState &existing)
+        {
+            if (existing.sketch)
+            {
+                
+                sketch = new DSCPCSketch(*existing.sketch);
+                
+            }
+        }
+
+        
+
         
+        void CreateUnion(uint8_t lg_k)
+        {
+            if (!union_sketch)
+            {
+                union_sketch = new DSCPCUnion(lg_k);
+            }
+            if (sketch)
+            {
+                union_sketch->update(*sketch);
+                delete sketch;
+                sketch = nullptr;
+            }
+        }
 
-        ~DSCPCState()
+        void MergeInto(DSCPCUnion &target) const
         {
             if (sketch)
             {
-                delete sketch;
+                target.update(*sketch);
+            }
+            if (union_sketch)
+            {
+                
+                target.update(union_sketch->get_result());
+                
             }
         }
 
         
-        void CreateSketch(uint8_t k)
-        {
-            D_ASSERT(!sketch);
-            sketch = new datasketches::cpc_sketch(k);
-        }
+        DSCPCSketch GetResult()
         
-
-        void CreateSketch(const DSCPCState &existing)
         {
-            if (existing.sketch)
+            if (!union_sketch)
             {
                 
-                sketch = new datasketches::cpc_sketch(*existing.sketch);
-                
+                return *sketch;
+            }
+            if (sketch)
+            {
+                union_sketch->update(*sketch);
+                delete sketch;
+                sketch = nullptr;
             }
+            
+            return union_sketch->get_result();
+            
         }
+        
 
         
-        datasketches::cpc_sketch deserialize_sketch(const string_t &data)
+        DSCPCSketch deserialize_sketch(const string_t &data)
         {
             try {
-                return datasketches::cpc_sketch::deserialize(data.GetDataUnsafe(), data.GetSize());
+                return DSCPCSketch::deserialize(data.GetDataUnsafe(), data.GetSize());
             } catch (const std::exception &e) {
                 throw InvalidInputException("Failed to deserialize CPC sketch: %s", e.what());
             }
@@ -731,11 +1754,15 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
     }
     
 
+    
+
     struct DSSketchOperationBase {
         template <class STATE>
         static void Initialize(STATE &state)
         {
             state.sketch = nullptr;
+            state.pending_count = 0;
+            state.k = 0;
         }
 
         template <class STATE>
@@ -757,11 +1784,8 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
                               const A_TYPE &a_data,
                               AggregateUnaryInput &idata)
         {
-            if (!state.sketch)
-            {
-                auto &bind_data = idata.input.bind_data->template Cast<BIND_DATA_TYPE>();
-                state.CreateSketch(bind_data.k);
-            }
+            auto &bind_data = idata.input.bind_data->template Cast<BIND_DATA_TYPE>();
+            state.Materialize(DSResolveK(state, bind_data));
 
             // this is a sketch in b_data, so we need to deserialize it.
             state.sketch->merge(state.deserialize_sketch(a_data));
@@ -779,26 +1803,26 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
         static void Combine(const STATE &source, STATE &target,
                             AggregateInputData &aggr_input_data)
         {
-            if (!target.sketch)
-            {
-                target.CreateSketch(source);
-            }
-            else
+            auto &bind_data = aggr_input_data.bind_data->template Cast<BIND_DATA_TYPE>();
+            if (!target.k)
             {
-                target.sketch->merge(*source.sketch);
+                target.k = source.k;
             }
+            target.Combine(source, DSResolveK(target, bind_data));
         }
 
         template <class T, class STATE>
         static void Finalize(STATE &state, T &target,
                              AggregateFinalizeData &finalize_data)
         {
-            if (!state.sketch)
+            if (state.IsEmpty())
             {
                 finalize_data.ReturnNull();
             }
             else
             {
+                auto &bind_data = finalize_data.input.bind_data->template Cast<BIND_DATA_TYPE>();
+                state.Materialize(DSResolveK(state, bind_data));
                 auto serialized_data = state.sketch->serialize();
                 auto sketch_string = std::string(serialized_data.begin(), serialized_data.end());
                 target = StringVector::AddStringOrBlob(finalize_data.result, sketch_string);
@@ -814,13 +1838,8 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
                               const A_TYPE &a_data,
                               AggregateUnaryInput &idata)
         {
-            if (!state.sketch)
-            {
-                auto &bind_data = idata.input.bind_data->template Cast<BIND_DATA_TYPE>();
-                state.CreateSketch(bind_data.k);
-            }
-
-            state.sketch->update(a_data);
+            auto &bind_data = idata.input.bind_data->template Cast<BIND_DATA_TYPE>();
+            state.Update(a_data, DSResolveK(state, bind_data));
         }
 
         template <class INPUT_TYPE, class STATE, class OP>
@@ -835,26 +1854,26 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
         static void Combine(const STATE &source, STATE &target,
                             AggregateInputData &aggr_input_data)
         {
-            if (!target.sketch)
-            {
-                target.CreateSketch(source);
-            }
-            else
+            auto &bind_data = aggr_input_data.bind_data->template Cast<BIND_DATA_TYPE>();
+            if (!target.k)
             {
-                target.sketch->merge(*source.sketch);
+                target.k = source.k;
             }
+            target.Combine(source, DSResolveK(target, bind_data));
         }
 
         template <class T, class STATE>
         static void Finalize(STATE &state, T &target,
                              AggregateFinalizeData &finalize_data)
         {
-            if (!state.sketch)
+            if (state.IsEmpty())
             {
                 finalize_data.ReturnNull();
             }
             else
             {
+                auto &bind_data = finalize_data.input.bind_data->template Cast<BIND_DATA_TYPE>();
+                state.Materialize(DSResolveK(state, bind_data));
                 auto serialized_data = state.sketch->serialize();
                 auto sketch_string = std::string(serialized_data.begin(), serialized_data.end());
                 target = StringVector::AddStringOrBlob(finalize_data.result, sketch_string);
@@ -863,64 +1882,99 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
     };
 
     template <class BIND_DATA_TYPE>
-    struct DSHLLCreateOperation : DSSketchOperationBase
+    struct DSCountingSketchOperationBase
     {
-        template <class A_TYPE, class STATE, class OP>
-        static void Operation(STATE &state,
-                              const A_TYPE &a_data,
-                              AggregateUnaryInput &idata)
+        template <class STATE>
+        static void Initialize(STATE &state)
         {
-            if (!state.sketch)
+            state.sketch = nullptr;
+            state.union_sketch = nullptr;
+            state.k = 0;
+            if constexpr (std::is_same_v<STATE, DSHLLState>)
             {
-                auto &bind_data = idata.input.bind_data->template Cast<BIND_DATA_TYPE>();
-                state.CreateSketch(bind_data.k);
-            }
-
-            if constexpr (std::is_same_v<A_TYPE, duckdb::string_t>) {
-                state.sketch->update(a_data.GetData(), a_data.GetSize());
-            } else {
-                state.sketch->update(a_data);
+                state.registers = nullptr;
+                state.registers_lg_k = 0;
             }
         }
 
-        template <class INPUT_TYPE, class STATE, class OP>
-        static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
-                                    idx_t count) {
-            for (idx_t i = 0; i < count; i++) {
-                Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+        template <class STATE>
+        static void Destroy(STATE &state, AggregateInputData &aggr_input_data) {
+            if (state.sketch) {
+                delete state.sketch;
+                state.sketch = nullptr;
+            }
+            if (state.union_sketch) {
+                delete state.union_sketch;
+                state.union_sketch = nullptr;
             }
         }
 
+        static bool IgnoreNull() { return true; }
+
         template <class STATE, class OP>
         static void Combine(const STATE &source, STATE &target,
                             AggregateInputData &aggr_input_data)
         {
-            if (!target.sketch)
+            if (!source.sketch && !source.union_sketch)
+            {
+                return;
+            }
+            if (!target.k)
+            {
+                target.k = source.k;
+            }
+            if (!target.sketch && !target.union_sketch && !source.union_sketch)
             {
                 target.CreateSketch(source);
+                return;
             }
-            else
+            auto &bind_data = aggr_input_data.bind_data->template Cast<BIND_DATA_TYPE>();
+            target.CreateUnion(DSResolveK(target, bind_data));
+            source.MergeInto(*target.union_sketch);
+        }
+
+        template <class INPUT_TYPE, class STATE, class OP>
+        static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+                                    idx_t count) {
+            for (idx_t i = 0; i < count; i++) {
+                OP::template Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+            }
+        }
+    };
+
+    template <class BIND_DATA_TYPE>
+    struct DSHLLCreateOperation : DSCountingSketchOperationBase<BIND_DATA_TYPE>
+    {
+        // Inserting a value twice leaves the sketch unchanged.
+        static constexpr bool IDEMPOTENT = true;
+
+        template <class A_TYPE, class STATE, class OP>
+        static void Operation(STATE &state,
+                              const A_TYPE &a_data,
+                              AggregateUnaryInput &idata)
+        {
+            auto &bind_data = idata.input.bind_data->template Cast<BIND_DATA_TYPE>();
+            if (!state.sketch)
             {
-                datasketches::hll_union u(target.sketch->get_lg_config_k());
-                u.update(*target.sketch);
-                if(source.sketch) {
-                    u.update(*source.sketch);
-                }
-                *target.sketch = u.get_result(datasketches::target_hll_type::HLL_4);
+                state.CreateSketch(DSResolveK(state, bind_data), bind_data.hll_type);
             }
+
+            DSDistinctUpdate(*state.sketch, a_data, bind_data.decimal_scale);
         }
 
         template <class T, class STATE>
         static void Finalize(STATE &state, T &target,
                              AggregateFinalizeData &finalize_data)
         {
-            if (!state.sketch)
+            if (!state.sketch && !state.union_sketch)
             {
                 finalize_data.ReturnNull();
             }
             else
             {
-                auto serialized_data = state.sketch->serialize_updatable();
+                auto &bind_data = finalize_data.input.bind_data->template Cast<BIND_DATA_TYPE>();
+                auto sketch = state.GetResult(bind_data.hll_type);
+                auto serialized_data = bind_data.compact ? sketch.serialize_compact() : sketch.serialize_updatable();
                 auto sketch_string = std::string(serialized_data.begin(), serialized_data.end());
                 target = StringVector::AddStringOrBlob(finalize_data.result, sketch_string);
             }
@@ -928,7 +1982,7 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
     };
 
     template <class BIND_DATA_TYPE>
-    struct DSHLLMergeOperation : DSSketchOperationBase
+    struct DSHLLMergeOperation : DSCountingSketchOperationBase<BIND_DATA_TYPE>
     {
 
         template <class A_TYPE, class STATE, class OP>
@@ -937,71 +1991,51 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
                               AggregateUnaryInput &idata)
         {
             auto &bind_data = idata.input.bind_data->template Cast<BIND_DATA_TYPE>();
-
-            if (!state.sketch)
+            auto lg_k = uint8_t(DSResolveK(state, bind_data));
+            auto registers = DSHLLDenseRegisters(a_data, lg_k);
+            if (registers)
             {
-                state.CreateSketch(bind_data.k);
-            }
-
-            auto a_sketch = state.deserialize_sketch(a_data);
-
-            datasketches::hll_union u(bind_data.k);
-            if(state.sketch) {
-                u.update(*state.sketch);
-            }
-            u.update(a_sketch);
-
-            *state.sketch = u.get_result(datasketches::target_hll_type::HLL_4);
-        }
-
-        template <class INPUT_TYPE, class STATE, class OP>
-        static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
-                                    idx_t count) {
-            for (idx_t i = 0; i < count; i++) {
-                Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+                state.MergeRegisters(registers, lg_k);
+                return;
             }
+            state.CreateUnion(lg_k);
+            state.union_sketch->update(state.deserialize_sketch(a_data));
         }
 
         template <class STATE, class OP>
         static void Combine(const STATE &source, STATE &target,
                             AggregateInputData &aggr_input_data)
         {
-            if (!target.sketch)
-            {
-                target.CreateSketch(source);
-            }
-            else
+            if (source.registers)
             {
-                datasketches::hll_union u(target.sketch->get_lg_config_k());
-                if(source.sketch) {
-                    u.update(*source.sketch);
+                if (!target.k)
+                {
+                    target.k = source.k;
                 }
-                u.update(*target.sketch);
-
-                *target.sketch = u.get_result(datasketches::target_hll_type::HLL_4);
+                target.MergeRegisters(source.registers, source.registers_lg_k);
             }
+            DSCountingSketchOperationBase<BIND_DATA_TYPE>::template Combine<STATE, OP>(source, target, aggr_input_data);
+        }
+
+        template <class STATE>
+        static void Destroy(STATE &state, AggregateInputData &aggr_input_data)
+        {
+            state.FreeRegisters();
+            DSCountingSketchOperationBase<BIND_DATA_TYPE>::template Destroy<STATE>(state, aggr_input_data);
         }
 
         template <class T, class STATE>
         static void Finalize(STATE &state, T &target,
                              AggregateFinalizeData &finalize_data)
         {
-            if (!state.sketch)
-            {
-                finalize_data.ReturnNull();
-            }
-            else
-            {
-                auto serialized_data = state.sketch->serialize_updatable();
-                auto sketch_string = std::string(serialized_data.begin(), serialized_data.end());
-                target = StringVector::AddStringOrBlob(finalize_data.result, sketch_string);
-            }
+            state.FlushRegisters();
+            DSHLLCreateOperation<BIND_DATA_TYPE>::template Finalize<T, STATE>(state, target, finalize_data);
         }
     };
 
 
     template <class BIND_DATA_TYPE>
-    struct DSCPCMergeOperation : DSSketchOperationBase
+    struct DSCPCMergeOperation : DSCountingSketchOperationBase<BIND_DATA_TYPE>
     {
         template <class A_TYPE, class STATE, class OP>
         static void Operation(STATE &state,
@@ -1009,60 +2043,21 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
                               AggregateUnaryInput &idata)
         {
             auto &bind_data = idata.input.bind_data->template Cast<BIND_DATA_TYPE>();
-
-            if (!state.sketch)
-            {
-                state.CreateSketch(bind_data.k);
-            }
-
-            auto a_sketch = state.deserialize_sketch(a_data);
-            datasketches::cpc_union u(bind_data.k);
-            if(state.sketch) {
-                u.update(*state.sketch);
-            }
-            u.update(a_sketch);
-
-            *state.sketch = u.get_result();
-        }
-
-        template <class INPUT_TYPE, class STATE, class OP>
-        static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
-                                    idx_t count) {
-            for (idx_t i = 0; i < count; i++) {
-                Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
-            }
-        }
-
-        template <class STATE, class OP>
-        static void Combine(const STATE &source, STATE &target,
-                            AggregateInputData &aggr_input_data)
-        {
-            if (!target.sketch)
-            {
-                target.CreateSketch(source);
-            }
-            else
-            {
-                datasketches::cpc_union u(target.sketch->get_lg_k());
-                if(source.sketch) {
-                    u.update(*source.sketch);
-                }
-                u.update(*target.sketch);
-                *target.sketch = u.get_result();
-            }
+            state.CreateUnion(DSResolveK(state, bind_data));
+            state.union_sketch->update(state.deserialize_sketch(a_data));
         }
 
         template <class T, class STATE>
         static void Finalize(STATE &state, T &target,
                              AggregateFinalizeData &finalize_data)
         {
-            if (!state.sketch)
+            if (!state.sketch && !state.union_sketch)
             {
                 finalize_data.ReturnNull();
             }
             else
             {
-                auto serialized_data = state.sketch->serialize();
+                auto serialized_data = state.GetResult().serialize();
                 auto sketch_string = std::string(serialized_data.begin(), serialized_data.end());
                 target = StringVector::AddStringOrBlob(finalize_data.result, sketch_string);
             }
@@ -1070,69 +2065,30 @@ unique_ptr<FunctionData> DSCPCBind(ClientContext &context, AggregateFunction &fu
     };
 
     template <class BIND_DATA_TYPE>
-    struct DSCPCCreateOperation : DSSketchOperationBase
+    struct DSCPCCreateOperation : DSCountingSketchOperationBase<BIND_DATA_TYPE>
     {
+        // Inserting a value twice leaves the sketch unchanged.
+        static constexpr bool IDEMPOTENT = true;
+
         template <class A_TYPE, class STATE, class OP>
         static void Operation(STATE &state,
                               const A_TYPE &a_data,
                               AggregateUnaryInput &idata)
         {
+            auto &bind_data = idata.input.bind_data->template Cast<BIND_DATA_TYPE>();
             if (!state.sketch)
             {
-                auto &bind_data = idata.input.bind_data->template Cast<BIND_DATA_TYPE>();
-                state.CreateSketch(bind_data.k);
+                state.CreateSketch(DSResolveK(state, bind_data));
             }
 
-            if constexpr (std::is_same_v<A_TYPE, duckdb::string_t>) {
-                state.sketch->update(a_data.GetData(), a_data.GetSize());
-            } else {
-                state.sketch->update(a_data);
-            }
-        }
-
-        template <class INPUT_TYPE, class STATE, class OP>
-        static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
-                                    idx_t count) {
-            for (idx_t i = 0; i < count; i++) {
-                Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
-            }
-        }
-
-
-        template <class STATE, class OP>
-        static void Combine(const STATE &source, STATE &target,
-                            AggregateInputData &aggr_input_data)
-        {
-            if (!target.sketch)
-            {
-                target.CreateSketch(source);
-            }
-            else
-            {
-                datasketches::cpc_union u(target.sketch->get_lg_k());
-                u.update(*target.sketch);
-                if(source.sketch) {
-                    u.update(*source.sketch);
-                }
-                *target.sketch = u.get_result();
-            }
+            DSDistinctUpdate(*state.sketch, a_data, bind_data.decimal_scale);
         }
 
-
         template <class T, class STATE>
         static void Finalize(STATE &state, T &target,
                              AggregateFinalizeData &finalize_data)
         {
-            if (!state.sketch)
-            {
-                finalize_data.ReturnNull();
-            }
-            else
-            {
-                auto serialized_data = state.sketch->serialize();
-                auto sketch_string = std::string(serialized_data.begin(), serialized_data.end());
-                target = StringVector::AddStringOrBlob(finalize_data.result, sketch_string);
-            }
+            DSCPCMergeOperation<BIND_DATA_TYPE>::template Finalize<T, STATE>(state, target, finalize_data);
         }
     };
 
@@ -1163,7 +2119,7 @@ static inline void DSQuantilesis_empty(DataChunk &args, ExpressionState &state,
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
@@ -1197,7 +2153,7 @@ static inline void DSQuantilesk(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
@@ -1224,57 +2180,157 @@ static inline void DSQuantilescdf(DataChunk &args, ExpressionState &state, Vecto
 
     
         
-                    UnifiedVectorFormat unified_split_points;
-                    split_points_vector.ToUnifiedFormat(args.size(), unified_split_points);
+                    auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
+                    UnifiedVectorFormat split_points_children_unified;
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
+                    const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
 
-                    // auto split_points_list_entries = UnifiedVectorFormat::GetData<list_entry_t>(unified_split_points);
-                    //         auto split_points_validitiy = FlatVector::Validity(split_points_vector);
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
+                    
+        TernaryExecutor::Execute
+        <string_t,list_entry_t,bool,list_entry_t>
+        (
+        sketch_vector,split_points_vector,inclusive_vector,result,args.size(),
+        [&](string_t sketch_data,list_entry_t split_points_data,bool inclusive_data) {
 
-                    auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
+            
+            auto sketch = [&]() {
+                try {
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
+                }
+            }();
+
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
+                    {
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
+                    {
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
+                    }
+                    
+auto cdf_result = sketch.get_CDF(split_points_ptr, split_points_data.length, inclusive_data);
+                auto current_size = ListVector::GetListSize(result);
+                auto new_size = current_size + cdf_result.size();
+                if (ListVector::GetListCapacity(result) < new_size)
+                {
+                    ListVector::Reserve(result, new_size);
+                }
+
+                auto &child_entry = ListVector::GetEntry(result);
+                auto child_vals = FlatVector::GetData<double>(child_entry);
+                //auto &child_validity = FlatVector::Validity(child_entry);
+                for (idx_t i = 0; i < cdf_result.size(); i++)
+                {
+                    child_vals[current_size + i] = cdf_result[i];
+                }
+                ListVector::SetListSize(result, new_size);
+                return list_entry_t{current_size, cdf_result.size()};
+                
+        });
+
+}
 
+    
+
+
+template <class T>
+
+static inline void DSQuantilescdf_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sorted_view_vector = args.data[0];
+        auto &split_points_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+                    auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
                     UnifiedVectorFormat split_points_children_unified;
-                    split_points_list_children.ToUnifiedFormat(args.size(), split_points_children_unified);
-
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
                     const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
+
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
                     
         TernaryExecutor::Execute
         <string_t,list_entry_t,bool,list_entry_t>
         (
-        sketch_vector,split_points_vector,inclusive_vector,result,args.size(),
-        [&](string_t sketch_data,list_entry_t split_points_data,bool inclusive_data) {
+        sorted_view_vector,split_points_vector,inclusive_vector,result,args.size(),
+        [&](string_t sorted_view_data,list_entry_t split_points_data,bool inclusive_data) {
 
-            
-            auto sketch = [&]() {
-                try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
-                } catch (const std::exception &e) {
-                    throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
-                }
-            }();
+            DSSortedView<T> sorted_view(sorted_view_data);
 
-                    std::vector<T> passing_points(split_points_data.length);
-                    for (idx_t i = 0; i < split_points_data.length; i++)
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
+                    {
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
                     {
-                        passing_points[i] = split_points_list_children_data[i + split_points_data.offset];
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
                     }
                     
-auto cdf_result = sketch.get_CDF(passing_points.data(), split_points_data.length, inclusive_data);
+
                 auto current_size = ListVector::GetListSize(result);
-                auto new_size = current_size + cdf_result.size();
+                auto new_size = current_size + split_points_data.length + 1;
                 if (ListVector::GetListCapacity(result) < new_size)
                 {
                     ListVector::Reserve(result, new_size);
                 }
 
                 auto &child_entry = ListVector::GetEntry(result);
-                auto child_vals = FlatVector::GetData<T>(child_entry);
-                //auto &child_validity = FlatVector::Validity(child_entry);
-                for (idx_t i = 0; i < cdf_result.size(); i++)
-                {
-                    child_vals[current_size + i] = cdf_result[i];
-                }
+                auto child_vals = FlatVector::GetData<double>(child_entry);
+                sorted_view.GetCDF(split_points_ptr, split_points_data.length, inclusive_data, child_vals + current_size);
                 ListVector::SetListSize(result, new_size);
-                return list_entry_t{current_size, cdf_result.size()};
+                return list_entry_t{current_size, split_points_data.length + 1};
                 
         });
 
@@ -1297,18 +2353,21 @@ static inline void DSQuantilespmf(DataChunk &args, ExpressionState &state, Vecto
 
     
         
-                    UnifiedVectorFormat unified_split_points;
-                    split_points_vector.ToUnifiedFormat(args.size(), unified_split_points);
-
-                    // auto split_points_list_entries = UnifiedVectorFormat::GetData<list_entry_t>(unified_split_points);
-                    //         auto split_points_validitiy = FlatVector::Validity(split_points_vector);
-
                     auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
-
                     UnifiedVectorFormat split_points_children_unified;
-                    split_points_list_children.ToUnifiedFormat(args.size(), split_points_children_unified);
-
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
                     const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
+
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
                     
         TernaryExecutor::Execute
         <string_t,list_entry_t,bool,list_entry_t>
@@ -1319,19 +2378,35 @@ static inline void DSQuantilespmf(DataChunk &args, ExpressionState &state, Vecto
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
             }();
 
-                    std::vector<T> passing_points(split_points_data.length);
-                    for (idx_t i = 0; i < split_points_data.length; i++)
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
                     {
-                        passing_points[i] = split_points_list_children_data[i + split_points_data.offset];
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
+                    {
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
                     }
                     
-auto pmf_result = sketch.get_PMF(passing_points.data(), split_points_data.length, inclusive_data);
+auto pmf_result = sketch.get_PMF(split_points_ptr, split_points_data.length, inclusive_data);
                 auto current_size = ListVector::GetListSize(result);
                 auto new_size = current_size + pmf_result.size();
                 if (ListVector::GetListCapacity(result) < new_size)
@@ -1378,7 +2453,7 @@ static inline void DSQuantilesnormalized_rank_error(DataChunk &args, ExpressionS
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
@@ -1414,7 +2489,7 @@ static inline void DSQuantilesdescribe(DataChunk &args, ExpressionState &state,
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
@@ -1450,12 +2525,41 @@ static inline void DSQuantilesrank(DataChunk &args, ExpressionState &state, Vect
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
             }();
-return sketch.get_rank(item_data, inclusive_data);
+return sketch.get_rank(DSQuantileItem<T>::FromDuckDB(item_data), inclusive_data);
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSQuantilesrank_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sorted_view_vector = args.data[0];
+        auto &item_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+        TernaryExecutor::Execute
+        <string_t,T,bool,double>
+        (
+        sorted_view_vector,item_vector,inclusive_vector,result,args.size(),
+        [&](string_t sorted_view_data,T item_data,bool inclusive_data) {
+
+            DSSortedView<T> sorted_view(sorted_view_data);
+return sorted_view.GetRank(item_data, inclusive_data);
         });
 
 }
@@ -1486,12 +2590,183 @@ static inline void DSQuantilesquantile(DataChunk &args, ExpressionState &state,
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
+                }
+            }();
+return DSQuantileItem<T>::ToDuckDB(result, sketch.get_quantile(rank_data, inclusive_data));
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSQuantilesquantile_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sorted_view_vector = args.data[0];
+        auto &rank_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+        TernaryExecutor::Execute
+        <string_t,double,bool,T>
+        (
+        sorted_view_vector,rank_vector,inclusive_vector,result,args.size(),
+        [&](string_t sorted_view_data,double rank_data,bool inclusive_data) {
+
+            DSSortedView<T> sorted_view(sorted_view_data);
+return sorted_view.GetQuantile(rank_data, inclusive_data);
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSQuantilesquantiles(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sketch_vector = args.data[0];
+        auto &ranks_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+                    auto &ranks_list_children = ListVector::GetEntry(ranks_vector);
+                    UnifiedVectorFormat ranks_children_unified;
+                    ranks_list_children.ToUnifiedFormat(ListVector::GetListSize(ranks_vector), ranks_children_unified);
+                    const double *ranks_list_children_data = UnifiedVectorFormat::GetData<double>(ranks_children_unified);
+                    
+        TernaryExecutor::Execute
+        <string_t,list_entry_t,bool,list_entry_t>
+        (
+        sketch_vector,ranks_vector,inclusive_vector,result,args.size(),
+        [&](string_t sketch_data,list_entry_t ranks_data,bool inclusive_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
+                }
+            }();
+
+                if (sketch.is_empty())
+                {
+                    throw InvalidInputException("Cannot query an empty Quantiles sketch");
+                }
+                auto sorted_view = sketch.get_sorted_view();
+
+                auto current_size = ListVector::GetListSize(result);
+                auto new_size = current_size + ranks_data.length;
+                if (ListVector::GetListCapacity(result) < new_size)
+                {
+                    ListVector::Reserve(result, new_size);
+                }
+
+                auto &child_entry = ListVector::GetEntry(result);
+                auto child_vals = FlatVector::GetData<T>(child_entry);
+                for (idx_t i = 0; i < ranks_data.length; i++)
+                {
+                    auto point_idx = ranks_children_unified.sel->get_index(ranks_data.offset + i);
+                    if (!ranks_children_unified.validity.RowIsValid(point_idx))
+                    {
+                        throw InvalidInputException("ranks cannot contain NULL values");
+                    }
+                    const auto &point = ranks_list_children_data[point_idx];
+                    if (!(point >= 0.0 && point <= 1.0))
+                    {
+                        throw InvalidInputException("Normalized rank must be between 0 and 1, got: %f", point);
+                    }
+                    child_vals[current_size + i] = DSQuantileItem<T>::ToDuckDB(child_entry, sorted_view.get_quantile(point, inclusive_data));
+                }
+                ListVector::SetListSize(result, new_size);
+                return list_entry_t{current_size, ranks_data.length};
+                
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSQuantilesranks(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sketch_vector = args.data[0];
+        auto &items_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+                    auto &items_list_children = ListVector::GetEntry(items_vector);
+                    UnifiedVectorFormat items_children_unified;
+                    items_list_children.ToUnifiedFormat(ListVector::GetListSize(items_vector), items_children_unified);
+                    const T *items_list_children_data = UnifiedVectorFormat::GetData<T>(items_children_unified);
+                    
+        TernaryExecutor::Execute
+        <string_t,list_entry_t,bool,list_entry_t>
+        (
+        sketch_vector,items_vector,inclusive_vector,result,args.size(),
+        [&](string_t sketch_data,list_entry_t items_data,bool inclusive_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
             }();
-return sketch.get_quantile(rank_data, inclusive_data);
+
+                if (sketch.is_empty())
+                {
+                    throw InvalidInputException("Cannot query an empty Quantiles sketch");
+                }
+                auto sorted_view = sketch.get_sorted_view();
+
+                auto current_size = ListVector::GetListSize(result);
+                auto new_size = current_size + items_data.length;
+                if (ListVector::GetListCapacity(result) < new_size)
+                {
+                    ListVector::Reserve(result, new_size);
+                }
+
+                auto &child_entry = ListVector::GetEntry(result);
+                auto child_vals = FlatVector::GetData<double>(child_entry);
+                for (idx_t i = 0; i < items_data.length; i++)
+                {
+                    auto point_idx = items_children_unified.sel->get_index(items_data.offset + i);
+                    if (!items_children_unified.validity.RowIsValid(point_idx))
+                    {
+                        throw InvalidInputException("items cannot contain NULL values");
+                    }
+                    const auto &point = items_list_children_data[point_idx];
+                    child_vals[current_size + i] = sorted_view.get_rank(DSQuantileItem<T>::FromDuckDB(point), inclusive_data);
+                }
+                ListVector::SetListSize(result, new_size);
+                return list_entry_t{current_size, items_data.length};
+                
         });
 
 }
@@ -1520,7 +2795,7 @@ static inline void DSQuantilesn(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
@@ -1554,7 +2829,7 @@ static inline void DSQuantilesis_estimation_mode(DataChunk &args, ExpressionStat
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
@@ -1588,7 +2863,7 @@ static inline void DSQuantilesnum_retained(DataChunk &args, ExpressionState &sta
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
@@ -1622,12 +2897,12 @@ static inline void DSQuantilesmin_item(DataChunk &args, ExpressionState &state,
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
             }();
-return sketch.get_min_item();
+return DSQuantileItem<T>::ToDuckDB(result, sketch.get_min_item());
         });
 
 }
@@ -1656,12 +2931,46 @@ static inline void DSQuantilesmax_item(DataChunk &args, ExpressionState &state,
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::quantiles_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
+                }
+            }();
+return DSQuantileItem<T>::ToDuckDB(result, sketch.get_max_item());
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSQuantilesto_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 1);
+
+    
+        auto &sketch_vector = args.data[0];
+
+    
+        
+        UnaryExecutor::Execute
+        <string_t,string_t>
+        (
+        sketch_vector,result,args.size(),
+        [&](string_t sketch_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
                 }
             }();
-return sketch.get_max_item();
+return DSSortedView<T>::Serialize(result, sketch);
         });
 
 }
@@ -1669,14 +2978,85 @@ return sketch.get_max_item();
     
 
 
+template <class T>
+
+static inline void DSQuantilessummary(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 1);
+
+    
+        auto &sketch_vector = args.data[0];
+
+    
+        UnifiedVectorFormat sketch_unified;
+        sketch_vector.ToUnifiedFormat(args.size(), sketch_unified);
+        auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_unified);
+        auto &struct_entries = StructVector::GetEntries(result);
+
+        for (idx_t row = 0; row < args.size(); row++)
+        {
+            auto sketch_idx = sketch_unified.sel->get_index(row);
+            if (!sketch_unified.validity.RowIsValid(sketch_idx))
+            {
+                FlatVector::SetNull(result, row, true);
+                continue;
+            }
+            auto sketch_data = sketch_entries[sketch_idx];
+            
+            auto sketch = [&]() {
+                try {
+                    return DSQuantilesSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize Quantiles sketch: %s", e.what());
+                }
+            }();
+            
+            FlatVector::GetData<uint16_t>(*struct_entries[0])[row] = sketch.get_k();
+            FlatVector::GetData<uint64_t>(*struct_entries[1])[row] = sketch.get_n();
+            FlatVector::GetData<bool>(*struct_entries[2])[row] = sketch.is_empty();
+            FlatVector::GetData<bool>(*struct_entries[3])[row] = sketch.is_estimation_mode();
+            FlatVector::GetData<uint64_t>(*struct_entries[4])[row] = sketch.get_num_retained();
+            if (sketch.is_empty())
+            {
+                FlatVector::SetNull(*struct_entries[5], row, true);
+            }
+            else
+            {
+                FlatVector::GetData<T>(*struct_entries[5])[row] = DSQuantileItem<T>::ToDuckDB(*struct_entries[5], sketch.get_min_item());
+            }
+            if (sketch.is_empty())
+            {
+                FlatVector::SetNull(*struct_entries[6], row, true);
+            }
+            else
+            {
+                FlatVector::GetData<T>(*struct_entries[6])[row] = DSQuantileItem<T>::ToDuckDB(*struct_entries[6], sketch.get_max_item());
+            }
+            FlatVector::GetData<double>(*struct_entries[7])[row] = sketch.get_normalized_rank_error(false);
+            FlatVector::GetData<double>(*struct_entries[8])[row] = sketch.get_normalized_rank_error(true);
+        }
+
+        if (args.AllConstant())
+        {
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        }
+
+}
+
+    
+
+
     
     template <typename T>
     auto static DSQuantilesMergeAggregate(const LogicalType &type, const LogicalType &result_type) -> AggregateFunction
     
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSQuantilesState<T>, string_t, string_t, DSQuantilesMergeOperation<DSQuantilesBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSQuantilesState<T>, string_t, string_t, DSQuantilesMergeOperation<DSQuantilesBindData>, AggregateDestructorType::LEGACY>(
             result_type, result_type);
+        fun.bind = DSTrackedBind<DSQuantilesBind<DSQuantilesState<T>, string_t, DSQuantilesMergeOperation<DSQuantilesBindData>>>;
+        return fun;
         
     }
 
@@ -1686,11 +3066,30 @@ return sketch.get_max_item();
     auto static DSQuantilesCreateAggregate(const LogicalType &type, const LogicalType &result_type) -> AggregateFunction
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSQuantilesState<T>, T, string_t, DSQuantilesCreateOperation<DSQuantilesBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSQuantilesState<T>, T, string_t, DSQuantilesCreateOperation<DSQuantilesBindData>, AggregateDestructorType::LEGACY>(
             type, result_type);
+        fun.bind = DSTrackedBind<DSQuantilesBind<DSQuantilesState<T>, T, DSQuantilesCreateOperation<DSQuantilesBindData>>>;
+        return fun;
         
     }
 
+    
+    static unique_ptr<FunctionData> DSQuantilesBindDecimal(ClientContext &context, AggregateFunction &function,
+                                                        vector<unique_ptr<Expression>> &arguments)
+    {
+        if (DSDecimalItemFits(arguments[1]->return_type)) {
+            return DSQuantilesBind<DSQuantilesState<hugeint_t>, hugeint_t, DSQuantilesCreateOperation<DSQuantilesBindData>>(context, function, arguments);
+        }
+        auto name = function.name;
+        auto k_type = function.arguments[0];
+        function = DSQuantilesCreateAggregate<double>(LogicalType::DOUBLE, DSSketchAliasType("sketch_quantiles_", LogicalType::DOUBLE));
+        function.name = name;
+        function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+        function.arguments.insert(function.arguments.begin(), k_type);
+        return function.bind(context, function, arguments);
+    }
+    
+
 
   void LoadQuantilesSketch(ExtensionLoader &loader) {
 
@@ -1698,16 +3097,44 @@ return sketch.get_max_item();
       
         std::unordered_map<LogicalTypeId, LogicalType> sketch_map_types;
         
-            sketch_map_types.insert({ LogicalTypeId::TINYINT, CreateQuantilesSketchType(loader, LogicalType(LogicalTypeId::TINYINT))});
-            sketch_map_types.insert({ LogicalTypeId::SMALLINT, CreateQuantilesSketchType(loader, LogicalType(LogicalTypeId::SMALLINT))});
-            sketch_map_types.insert({ LogicalTypeId::INTEGER, CreateQuantilesSketchType(loader, LogicalType(LogicalTypeId::INTEGER))});
-            sketch_map_types.insert({ LogicalTypeId::BIGINT, CreateQuantilesSketchType(loader, LogicalType(LogicalTypeId::BIGINT))});
-            sketch_map_types.insert({ LogicalTypeId::FLOAT, CreateQuantilesSketchType(loader, LogicalType(LogicalTypeId::FLOAT))});
-            sketch_map_types.insert({ LogicalTypeId::DOUBLE, CreateQuantilesSketchType(loader, LogicalType(LogicalTypeId::DOUBLE))});
-            sketch_map_types.insert({ LogicalTypeId::UTINYINT, CreateQuantilesSketchType(loader, LogicalType(LogicalTypeId::UTINYINT))});
-            sketch_map_types.insert({ LogicalTypeId::USMALLINT, CreateQuantilesSketchType(loader, LogicalType(LogicalTypeId::USMALLINT))});
-            sketch_map_types.insert({ LogicalTypeId::UINTEGER, CreateQuantilesSketchType(loader, LogicalType(LogicalTypeId::UINTEGER))});
-            sketch_map_types.insert({ LogicalTypeId::UBIGINT, CreateQuantilesSketchType(loader, LogicalType(LogicalTypeId::UBIGINT))});
+            sketch_map_types.insert({ LogicalTypeId::TINYINT, CreateQuantilesSketchType(loader, LogicalType::TINYINT)});
+            sketch_map_types.insert({ LogicalTypeId::SMALLINT, CreateQuantilesSketchType(loader, LogicalType::SMALLINT)});
+            sketch_map_types.insert({ LogicalTypeId::INTEGER, CreateQuantilesSketchType(loader, LogicalType::INTEGER)});
+            sketch_map_types.insert({ LogicalTypeId::BIGINT, CreateQuantilesSketchType(loader, LogicalType::BIGINT)});
+            sketch_map_types.insert({ LogicalTypeId::FLOAT, CreateQuantilesSketchType(loader, LogicalType::FLOAT)});
+            sketch_map_types.insert({ LogicalTypeId::DOUBLE, CreateQuantilesSketchType(loader, LogicalType::DOUBLE)});
+            sketch_map_types.insert({ LogicalTypeId::UTINYINT, CreateQuantilesSketchType(loader, LogicalType::UTINYINT)});
+            sketch_map_types.insert({ LogicalTypeId::USMALLINT, CreateQuantilesSketchType(loader, LogicalType::USMALLINT)});
+            sketch_map_types.insert({ LogicalTypeId::UINTEGER, CreateQuantilesSketchType(loader, LogicalType::UINTEGER)});
+            sketch_map_types.insert({ LogicalTypeId::UBIGINT, CreateQuantilesSketchType(loader, LogicalType::UBIGINT)});
+            sketch_map_types.insert({ LogicalTypeId::DATE, CreateQuantilesSketchType(loader, LogicalType::DATE)});
+            sketch_map_types.insert({ LogicalTypeId::TIME, CreateQuantilesSketchType(loader, LogicalType::TIME)});
+            sketch_map_types.insert({ LogicalTypeId::TIMESTAMP, CreateQuantilesSketchType(loader, LogicalType::TIMESTAMP)});
+            sketch_map_types.insert({ LogicalTypeId::TIMESTAMP_TZ, CreateQuantilesSketchType(loader, LogicalType::TIMESTAMP_TZ)});
+            sketch_map_types.insert({ LogicalTypeId::HUGEINT, CreateQuantilesSketchType(loader, LogicalType::HUGEINT)});
+            sketch_map_types.insert({ LogicalTypeId::DECIMAL, CreateQuantilesSketchType(loader, LogicalType::DECIMAL(38, 18))});
+            sketch_map_types.insert({ LogicalTypeId::VARCHAR, CreateQuantilesSketchType(loader, LogicalType::VARCHAR)});
+      
+
+      
+        std::unordered_map<LogicalTypeId, LogicalType> sorted_view_map_types;
+        
+            sorted_view_map_types.insert({ LogicalTypeId::TINYINT, CreateQuantilesSortedViewType(loader, LogicalType::TINYINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::SMALLINT, CreateQuantilesSortedViewType(loader, LogicalType::SMALLINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::INTEGER, CreateQuantilesSortedViewType(loader, LogicalType::INTEGER)});
+            sorted_view_map_types.insert({ LogicalTypeId::BIGINT, CreateQuantilesSortedViewType(loader, LogicalType::BIGINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::FLOAT, CreateQuantilesSortedViewType(loader, LogicalType::FLOAT)});
+            sorted_view_map_types.insert({ LogicalTypeId::DOUBLE, CreateQuantilesSortedViewType(loader, LogicalType::DOUBLE)});
+            sorted_view_map_types.insert({ LogicalTypeId::UTINYINT, CreateQuantilesSortedViewType(loader, LogicalType::UTINYINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::USMALLINT, CreateQuantilesSortedViewType(loader, LogicalType::USMALLINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::UINTEGER, CreateQuantilesSortedViewType(loader, LogicalType::UINTEGER)});
+            sorted_view_map_types.insert({ LogicalTypeId::UBIGINT, CreateQuantilesSortedViewType(loader, LogicalType::UBIGINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::DATE, CreateQuantilesSortedViewType(loader, LogicalType::DATE)});
+            sorted_view_map_types.insert({ LogicalTypeId::TIME, CreateQuantilesSortedViewType(loader, LogicalType::TIME)});
+            sorted_view_map_types.insert({ LogicalTypeId::TIMESTAMP, CreateQuantilesSortedViewType(loader, LogicalType::TIMESTAMP)});
+            sorted_view_map_types.insert({ LogicalTypeId::TIMESTAMP_TZ, CreateQuantilesSortedViewType(loader, LogicalType::TIMESTAMP_TZ)});
+            sorted_view_map_types.insert({ LogicalTypeId::HUGEINT, CreateQuantilesSortedViewType(loader, LogicalType::HUGEINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::DECIMAL, CreateQuantilesSortedViewType(loader, LogicalType::DECIMAL(38, 18))});
       
 
       
@@ -1715,36 +3142,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_is_empty");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_empty<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_empty<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_empty<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_empty<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_empty<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_empty<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_empty<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_empty<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_empty<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_empty<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_empty<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_empty<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_empty<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_empty<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_empty<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_empty<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_empty<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_empty<uint64_t>));
+                ,    DSQuantilesis_empty<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_empty<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_empty<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_empty<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_empty<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -1764,36 +3213,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_k");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::USMALLINT
-                ,    DSQuantilesk<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesk<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::USMALLINT
-                ,    DSQuantilesk<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesk<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::USMALLINT
-                ,    DSQuantilesk<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesk<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::USMALLINT
-                ,    DSQuantilesk<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::USMALLINT
-                ,    DSQuantilesk<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesk<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::USMALLINT
-                ,    DSQuantilesk<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesk<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::USMALLINT
-                ,    DSQuantilesk<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesk<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::USMALLINT
-                ,    DSQuantilesk<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesk<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::USMALLINT
-                ,    DSQuantilesk<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesk<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::USMALLINT
-                ,    DSQuantilesk<uint64_t>));
+                ,    DSQuantilesk<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::USMALLINT
+                ,    DSQuantilesk<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::USMALLINT
+                ,    DSQuantilesk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::USMALLINT
+                ,    DSQuantilesk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::USMALLINT
+                ,    DSQuantilesk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::USMALLINT
+                ,    DSQuantilesk<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::USMALLINT
+                ,    DSQuantilesk<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::USMALLINT
+                ,    DSQuantilesk<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -1813,36 +3284,107 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_cdf");
         
             
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TINYINT)
-                ,    DSQuantilescdf<int8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::SMALLINT)
-                ,    DSQuantilescdf<int16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::INTEGER)
-                ,    DSQuantilescdf<int32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::BIGINT)
-                ,    DSQuantilescdf<int64_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::FLOAT)
-                ,    DSQuantilescdf<float>));
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
-                ,    DSQuantilescdf<double>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UTINYINT)
-                ,    DSQuantilescdf<uint8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::USMALLINT)
-                ,    DSQuantilescdf<uint16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UINTEGER)
-                ,    DSQuantilescdf<uint32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UBIGINT)
-                ,    DSQuantilescdf<uint64_t>));
+                ,    DSQuantilescdf<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::VARCHAR),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf<string_t>), DSUnitIntervalListStatistics));
+            
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilescdf_sorted_view<hugeint_t>), DSUnitIntervalListStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -1862,36 +3404,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_pmf");
         
             
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TINYINT)
-                ,    DSQuantilespmf<int8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::SMALLINT)
-                ,    DSQuantilespmf<int16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::INTEGER)
-                ,    DSQuantilespmf<int32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::BIGINT)
-                ,    DSQuantilespmf<int64_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::FLOAT)
-                ,    DSQuantilespmf<float>));
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
-                ,    DSQuantilespmf<double>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UTINYINT)
-                ,    DSQuantilespmf<uint8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::USMALLINT)
-                ,    DSQuantilespmf<uint16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UINTEGER)
-                ,    DSQuantilespmf<uint32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UBIGINT)
-                ,    DSQuantilespmf<uint64_t>));
+                ,    DSQuantilespmf<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::VARCHAR),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilespmf<string_t>), DSUnitIntervalListStatistics));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -1911,36 +3475,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_normalized_rank_error");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesnormalized_rank_error<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnormalized_rank_error<int8_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesnormalized_rank_error<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnormalized_rank_error<int16_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesnormalized_rank_error<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnormalized_rank_error<int32_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesnormalized_rank_error<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnormalized_rank_error<int64_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesnormalized_rank_error<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnormalized_rank_error<float>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesnormalized_rank_error<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnormalized_rank_error<double>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesnormalized_rank_error<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnormalized_rank_error<uint8_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesnormalized_rank_error<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnormalized_rank_error<uint16_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesnormalized_rank_error<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnormalized_rank_error<uint32_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesnormalized_rank_error<uint64_t>));
+                ,    DSQuantilesnormalized_rank_error<uint64_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesnormalized_rank_error<int32_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesnormalized_rank_error<int64_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesnormalized_rank_error<int64_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesnormalized_rank_error<int64_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesnormalized_rank_error<hugeint_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesnormalized_rank_error<hugeint_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesnormalized_rank_error<string_t>), DSNonNegativeStatistics));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -1960,36 +3546,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_describe");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSQuantilesdescribe<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesdescribe<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSQuantilesdescribe<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesdescribe<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSQuantilesdescribe<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesdescribe<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSQuantilesdescribe<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSQuantilesdescribe<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesdescribe<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSQuantilesdescribe<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesdescribe<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSQuantilesdescribe<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesdescribe<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSQuantilesdescribe<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesdescribe<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSQuantilesdescribe<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesdescribe<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSQuantilesdescribe<uint64_t>));
+                ,    DSQuantilesdescribe<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSQuantilesdescribe<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSQuantilesdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSQuantilesdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSQuantilesdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSQuantilesdescribe<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSQuantilesdescribe<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSQuantilesdescribe<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -2009,36 +3617,107 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_rank");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::TINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesrank<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesrank<int8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::SMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesrank<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesrank<int16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::INTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesrank<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesrank<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::BIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesrank<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::FLOAT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesrank<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesrank<float>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesrank<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesrank<double>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::UTINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesrank<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesrank<uint8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::USMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesrank<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesrank<uint16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::UINTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesrank<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesrank<uint32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::UBIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesrank<uint64_t>));
+                ,    DSQuantilesrank<uint64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::DATE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::TIME,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::TIMESTAMP,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::TIMESTAMP_TZ,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::HUGEINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank<hugeint_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::DECIMAL(38, 18),LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank<hugeint_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::VARCHAR,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank<string_t>), DSUnitIntervalStatistics));
+            
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TINYINT],LogicalType::TINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<int8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::SMALLINT],LogicalType::SMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<int16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::INTEGER],LogicalType::INTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::BIGINT],LogicalType::BIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::FLOAT],LogicalType::FLOAT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<float>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<double>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UTINYINT],LogicalType::UTINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<uint8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::USMALLINT],LogicalType::USMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<uint16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UINTEGER],LogicalType::UINTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<uint32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UBIGINT],LogicalType::UBIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<uint64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DATE],LogicalType::DATE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIME],LogicalType::TIME,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP],LogicalType::TIMESTAMP,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::TIMESTAMP_TZ,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::HUGEINT],LogicalType::HUGEINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<hugeint_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DECIMAL],LogicalType::DECIMAL(38, 18),LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesrank_sorted_view<hugeint_t>), DSUnitIntervalStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -2058,36 +3737,107 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_quantile");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TINYINT
-                ,    DSQuantilesquantile<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesquantile<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::SMALLINT
-                ,    DSQuantilesquantile<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesquantile<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::INTEGER
-                ,    DSQuantilesquantile<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesquantile<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::BIGINT
-                ,    DSQuantilesquantile<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::FLOAT
-                ,    DSQuantilesquantile<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesquantile<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSQuantilesquantile<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesquantile<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UTINYINT
-                ,    DSQuantilesquantile<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesquantile<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::USMALLINT
-                ,    DSQuantilesquantile<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesquantile<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UINTEGER
-                ,    DSQuantilesquantile<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesquantile<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UBIGINT
-                ,    DSQuantilesquantile<uint64_t>));
+                ,    DSQuantilesquantile<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DATE
+                ,    DSQuantilesquantile<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIME
+                ,    DSQuantilesquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP
+                ,    DSQuantilesquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP_TZ
+                ,    DSQuantilesquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::HUGEINT
+                ,    DSQuantilesquantile<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DECIMAL(38, 18)
+                ,    DSQuantilesquantile<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSQuantilesquantile<string_t>), nullptr));
+            
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TINYINT
+                ,    DSQuantilesquantile_sorted_view<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::SMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::SMALLINT
+                ,    DSQuantilesquantile_sorted_view<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::INTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::INTEGER
+                ,    DSQuantilesquantile_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::BIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::BIGINT
+                ,    DSQuantilesquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::FLOAT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::FLOAT
+                ,    DSQuantilesquantile_sorted_view<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSQuantilesquantile_sorted_view<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UTINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UTINYINT
+                ,    DSQuantilesquantile_sorted_view<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::USMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::USMALLINT
+                ,    DSQuantilesquantile_sorted_view<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UINTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UINTEGER
+                ,    DSQuantilesquantile_sorted_view<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UBIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UBIGINT
+                ,    DSQuantilesquantile_sorted_view<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DATE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DATE
+                ,    DSQuantilesquantile_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIME],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIME
+                ,    DSQuantilesquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP
+                ,    DSQuantilesquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP_TZ
+                ,    DSQuantilesquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::HUGEINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::HUGEINT
+                ,    DSQuantilesquantile_sorted_view<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DECIMAL],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DECIMAL(38, 18)
+                ,    DSQuantilesquantile_sorted_view<hugeint_t>), nullptr));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -2102,41 +3852,205 @@ return sketch.get_max_item();
         loader.RegisterFunction(info);
 
 
+      }
+      {
+        ScalarFunctionSet fs("datasketch_quantiles_quantiles");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TINYINT)
+                ,    DSQuantilesquantiles<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::SMALLINT)
+                ,    DSQuantilesquantiles<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::INTEGER)
+                ,    DSQuantilesquantiles<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::BIGINT)
+                ,    DSQuantilesquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::FLOAT)
+                ,    DSQuantilesquantiles<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesquantiles<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UTINYINT)
+                ,    DSQuantilesquantiles<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::USMALLINT)
+                ,    DSQuantilesquantiles<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UINTEGER)
+                ,    DSQuantilesquantiles<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UBIGINT)
+                ,    DSQuantilesquantiles<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DATE)
+                ,    DSQuantilesquantiles<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TIME)
+                ,    DSQuantilesquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TIMESTAMP)
+                ,    DSQuantilesquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TIMESTAMP_TZ)
+                ,    DSQuantilesquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::HUGEINT)
+                ,    DSQuantilesquantiles<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DECIMAL(38, 18))
+                ,    DSQuantilesquantiles<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::VARCHAR)
+                ,    DSQuantilesquantiles<string_t>), nullptr));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return the quantiles of a list of ranks in the sketch, computed from a single sorted view";
+            desc.examples.push_back("datasketch_quantiles_quantiles(sketch, ranks, inclusive)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
+      }
+      {
+        ScalarFunctionSet fs("datasketch_quantiles_ranks");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::VARCHAR),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSQuantilesranks<string_t>), DSUnitIntervalListStatistics));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return the ranks of a list of items in the sketch, computed from a single sorted view";
+            desc.examples.push_back("datasketch_quantiles_ranks(sketch, items, inclusive)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
       }
       {
         ScalarFunctionSet fs("datasketch_quantiles_n");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::UBIGINT
-                ,    DSQuantilesn<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesn<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::UBIGINT
-                ,    DSQuantilesn<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesn<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::UBIGINT
-                ,    DSQuantilesn<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesn<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::UBIGINT
-                ,    DSQuantilesn<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::UBIGINT
-                ,    DSQuantilesn<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesn<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::UBIGINT
-                ,    DSQuantilesn<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesn<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UBIGINT
-                ,    DSQuantilesn<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesn<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::UBIGINT
-                ,    DSQuantilesn<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesn<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UBIGINT
-                ,    DSQuantilesn<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesn<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSQuantilesn<uint64_t>));
+                ,    DSQuantilesn<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::UBIGINT
+                ,    DSQuantilesn<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::UBIGINT
+                ,    DSQuantilesn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::UBIGINT
+                ,    DSQuantilesn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::UBIGINT
+                ,    DSQuantilesn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::UBIGINT
+                ,    DSQuantilesn<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::UBIGINT
+                ,    DSQuantilesn<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::UBIGINT
+                ,    DSQuantilesn<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -2156,36 +4070,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_is_estimation_mode");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_estimation_mode<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_estimation_mode<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_estimation_mode<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_estimation_mode<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_estimation_mode<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_estimation_mode<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_estimation_mode<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_estimation_mode<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_estimation_mode<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_estimation_mode<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_estimation_mode<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_estimation_mode<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_estimation_mode<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_estimation_mode<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_estimation_mode<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_estimation_mode<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesis_estimation_mode<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::BOOLEAN
-                ,    DSQuantilesis_estimation_mode<uint64_t>));
+                ,    DSQuantilesis_estimation_mode<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_estimation_mode<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_estimation_mode<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_estimation_mode<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::BOOLEAN
+                ,    DSQuantilesis_estimation_mode<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -2205,36 +4141,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_num_retained");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::UBIGINT
-                ,    DSQuantilesnum_retained<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnum_retained<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::UBIGINT
-                ,    DSQuantilesnum_retained<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnum_retained<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::UBIGINT
-                ,    DSQuantilesnum_retained<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnum_retained<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::UBIGINT
-                ,    DSQuantilesnum_retained<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::UBIGINT
-                ,    DSQuantilesnum_retained<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnum_retained<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::UBIGINT
-                ,    DSQuantilesnum_retained<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnum_retained<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UBIGINT
-                ,    DSQuantilesnum_retained<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnum_retained<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::UBIGINT
-                ,    DSQuantilesnum_retained<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnum_retained<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UBIGINT
-                ,    DSQuantilesnum_retained<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesnum_retained<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSQuantilesnum_retained<uint64_t>));
+                ,    DSQuantilesnum_retained<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::UBIGINT
+                ,    DSQuantilesnum_retained<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::UBIGINT
+                ,    DSQuantilesnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::UBIGINT
+                ,    DSQuantilesnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::UBIGINT
+                ,    DSQuantilesnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::UBIGINT
+                ,    DSQuantilesnum_retained<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::UBIGINT
+                ,    DSQuantilesnum_retained<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::UBIGINT
+                ,    DSQuantilesnum_retained<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -2254,36 +4212,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_min_item");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::TINYINT
-                ,    DSQuantilesmin_item<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmin_item<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::SMALLINT
-                ,    DSQuantilesmin_item<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmin_item<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::INTEGER
-                ,    DSQuantilesmin_item<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmin_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BIGINT
-                ,    DSQuantilesmin_item<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::FLOAT
-                ,    DSQuantilesmin_item<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmin_item<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::DOUBLE
-                ,    DSQuantilesmin_item<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmin_item<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UTINYINT
-                ,    DSQuantilesmin_item<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmin_item<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::USMALLINT
-                ,    DSQuantilesmin_item<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmin_item<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UINTEGER
-                ,    DSQuantilesmin_item<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmin_item<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSQuantilesmin_item<uint64_t>));
+                ,    DSQuantilesmin_item<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::DATE
+                ,    DSQuantilesmin_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::TIME
+                ,    DSQuantilesmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::TIMESTAMP
+                ,    DSQuantilesmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::TIMESTAMP_TZ
+                ,    DSQuantilesmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::HUGEINT
+                ,    DSQuantilesmin_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::DECIMAL(38, 18)
+                ,    DSQuantilesmin_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::VARCHAR
+                ,    DSQuantilesmin_item<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -2303,36 +4283,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_quantiles_max_item");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::TINYINT
-                ,    DSQuantilesmax_item<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmax_item<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::SMALLINT
-                ,    DSQuantilesmax_item<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmax_item<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::INTEGER
-                ,    DSQuantilesmax_item<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmax_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BIGINT
-                ,    DSQuantilesmax_item<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::FLOAT
-                ,    DSQuantilesmax_item<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmax_item<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::DOUBLE
-                ,    DSQuantilesmax_item<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmax_item<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UTINYINT
-                ,    DSQuantilesmax_item<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmax_item<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::USMALLINT
-                ,    DSQuantilesmax_item<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmax_item<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UINTEGER
-                ,    DSQuantilesmax_item<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSQuantilesmax_item<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSQuantilesmax_item<uint64_t>));
+                ,    DSQuantilesmax_item<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::DATE
+                ,    DSQuantilesmax_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::TIME
+                ,    DSQuantilesmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::TIMESTAMP
+                ,    DSQuantilesmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::TIMESTAMP_TZ
+                ,    DSQuantilesmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::HUGEINT
+                ,    DSQuantilesmax_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::DECIMAL(38, 18)
+                ,    DSQuantilesmax_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::VARCHAR
+                ,    DSQuantilesmax_item<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -2347,6 +4349,145 @@ return sketch.get_max_item();
         loader.RegisterFunction(info);
 
 
+      }
+      {
+        ScalarFunctionSet fs("datasketch_quantiles_to_sorted_view");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT]},sorted_view_map_types[LogicalTypeId::TINYINT]
+                ,    DSQuantilesto_sorted_view<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT]},sorted_view_map_types[LogicalTypeId::SMALLINT]
+                ,    DSQuantilesto_sorted_view<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER]},sorted_view_map_types[LogicalTypeId::INTEGER]
+                ,    DSQuantilesto_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT]},sorted_view_map_types[LogicalTypeId::BIGINT]
+                ,    DSQuantilesto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT]},sorted_view_map_types[LogicalTypeId::FLOAT]
+                ,    DSQuantilesto_sorted_view<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE]},sorted_view_map_types[LogicalTypeId::DOUBLE]
+                ,    DSQuantilesto_sorted_view<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT]},sorted_view_map_types[LogicalTypeId::UTINYINT]
+                ,    DSQuantilesto_sorted_view<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT]},sorted_view_map_types[LogicalTypeId::USMALLINT]
+                ,    DSQuantilesto_sorted_view<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER]},sorted_view_map_types[LogicalTypeId::UINTEGER]
+                ,    DSQuantilesto_sorted_view<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT]},sorted_view_map_types[LogicalTypeId::UBIGINT]
+                ,    DSQuantilesto_sorted_view<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},sorted_view_map_types[LogicalTypeId::DATE]
+                ,    DSQuantilesto_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},sorted_view_map_types[LogicalTypeId::TIME]
+                ,    DSQuantilesto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},sorted_view_map_types[LogicalTypeId::TIMESTAMP]
+                ,    DSQuantilesto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ]
+                ,    DSQuantilesto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},sorted_view_map_types[LogicalTypeId::HUGEINT]
+                ,    DSQuantilesto_sorted_view<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},sorted_view_map_types[LogicalTypeId::DECIMAL]
+                ,    DSQuantilesto_sorted_view<hugeint_t>), nullptr));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return a precomputed sorted view of the sketch that answers quantile, rank and cdf queries without deserializing";
+            desc.examples.push_back("datasketch_quantiles_to_sorted_view(sketch)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
+      }
+      {
+        ScalarFunctionSet fs("datasketch_quantiles_summary");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TINYINT},{"max_item", LogicalType::TINYINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::SMALLINT},{"max_item", LogicalType::SMALLINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::INTEGER},{"max_item", LogicalType::INTEGER},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::BIGINT},{"max_item", LogicalType::BIGINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::FLOAT},{"max_item", LogicalType::FLOAT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::DOUBLE},{"max_item", LogicalType::DOUBLE},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::UTINYINT},{"max_item", LogicalType::UTINYINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::USMALLINT},{"max_item", LogicalType::USMALLINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::UINTEGER},{"max_item", LogicalType::UINTEGER},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::UBIGINT},{"max_item", LogicalType::UBIGINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::DATE},{"max_item", LogicalType::DATE},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TIME},{"max_item", LogicalType::TIME},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TIMESTAMP},{"max_item", LogicalType::TIMESTAMP},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TIMESTAMP_TZ},{"max_item", LogicalType::TIMESTAMP_TZ},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::HUGEINT},{"max_item", LogicalType::HUGEINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::DECIMAL(38, 18)},{"max_item", LogicalType::DECIMAL(38, 18)},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::VARCHAR},{"max_item", LogicalType::VARCHAR},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSQuantilessummary<string_t>), nullptr));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return a struct of the metadata and estimates of the sketch from a single deserialization";
+            desc.examples.push_back("datasketch_quantiles_summary(sketch)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
       }
 
       // This funciton creates the sketches.
@@ -2356,7 +4497,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSQuantilesCreateAggregate<int8_t>(LogicalType::TINYINT, sketch_map_types[LogicalTypeId::TINYINT]);
-                fun.bind = DSQuantilesBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2364,7 +4505,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSQuantilesCreateAggregate<int8_t>(LogicalType::TINYINT, sketch_map_types[LogicalTypeId::TINYINT]));
             {
                 auto fun = DSQuantilesMergeAggregate<int8_t>(LogicalType::TINYINT, sketch_map_types[LogicalTypeId::TINYINT]);
-                fun.bind = DSQuantilesBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2374,7 +4514,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSQuantilesCreateAggregate<int16_t>(LogicalType::SMALLINT, sketch_map_types[LogicalTypeId::SMALLINT]);
-                fun.bind = DSQuantilesBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2382,7 +4522,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSQuantilesCreateAggregate<int16_t>(LogicalType::SMALLINT, sketch_map_types[LogicalTypeId::SMALLINT]));
             {
                 auto fun = DSQuantilesMergeAggregate<int16_t>(LogicalType::SMALLINT, sketch_map_types[LogicalTypeId::SMALLINT]);
-                fun.bind = DSQuantilesBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2392,7 +4531,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSQuantilesCreateAggregate<int32_t>(LogicalType::INTEGER, sketch_map_types[LogicalTypeId::INTEGER]);
-                fun.bind = DSQuantilesBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2400,7 +4539,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSQuantilesCreateAggregate<int32_t>(LogicalType::INTEGER, sketch_map_types[LogicalTypeId::INTEGER]));
             {
                 auto fun = DSQuantilesMergeAggregate<int32_t>(LogicalType::INTEGER, sketch_map_types[LogicalTypeId::INTEGER]);
-                fun.bind = DSQuantilesBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2410,7 +4548,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSQuantilesCreateAggregate<int64_t>(LogicalType::BIGINT, sketch_map_types[LogicalTypeId::BIGINT]);
-                fun.bind = DSQuantilesBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2418,7 +4556,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSQuantilesCreateAggregate<int64_t>(LogicalType::BIGINT, sketch_map_types[LogicalTypeId::BIGINT]));
             {
                 auto fun = DSQuantilesMergeAggregate<int64_t>(LogicalType::BIGINT, sketch_map_types[LogicalTypeId::BIGINT]);
-                fun.bind = DSQuantilesBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2428,7 +4565,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSQuantilesCreateAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]);
-                fun.bind = DSQuantilesBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2436,7 +4573,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSQuantilesCreateAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]));
             {
                 auto fun = DSQuantilesMergeAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]);
-                fun.bind = DSQuantilesBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2446,7 +4582,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSQuantilesCreateAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]);
-                fun.bind = DSQuantilesBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2454,7 +4590,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSQuantilesCreateAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]));
             {
                 auto fun = DSQuantilesMergeAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]);
-                fun.bind = DSQuantilesBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2464,7 +4599,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSQuantilesCreateAggregate<uint8_t>(LogicalType::UTINYINT, sketch_map_types[LogicalTypeId::UTINYINT]);
-                fun.bind = DSQuantilesBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2472,7 +4607,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSQuantilesCreateAggregate<uint8_t>(LogicalType::UTINYINT, sketch_map_types[LogicalTypeId::UTINYINT]));
             {
                 auto fun = DSQuantilesMergeAggregate<uint8_t>(LogicalType::UTINYINT, sketch_map_types[LogicalTypeId::UTINYINT]);
-                fun.bind = DSQuantilesBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2482,7 +4616,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSQuantilesCreateAggregate<uint16_t>(LogicalType::USMALLINT, sketch_map_types[LogicalTypeId::USMALLINT]);
-                fun.bind = DSQuantilesBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2490,7 +4624,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSQuantilesCreateAggregate<uint16_t>(LogicalType::USMALLINT, sketch_map_types[LogicalTypeId::USMALLINT]));
             {
                 auto fun = DSQuantilesMergeAggregate<uint16_t>(LogicalType::USMALLINT, sketch_map_types[LogicalTypeId::USMALLINT]);
-                fun.bind = DSQuantilesBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2500,7 +4633,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSQuantilesCreateAggregate<uint32_t>(LogicalType::UINTEGER, sketch_map_types[LogicalTypeId::UINTEGER]);
-                fun.bind = DSQuantilesBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2508,7 +4641,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSQuantilesCreateAggregate<uint32_t>(LogicalType::UINTEGER, sketch_map_types[LogicalTypeId::UINTEGER]));
             {
                 auto fun = DSQuantilesMergeAggregate<uint32_t>(LogicalType::UINTEGER, sketch_map_types[LogicalTypeId::UINTEGER]);
-                fun.bind = DSQuantilesBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2518,7 +4650,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSQuantilesCreateAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]);
-                fun.bind = DSQuantilesBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -2526,13 +4658,134 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSQuantilesCreateAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]));
             {
                 auto fun = DSQuantilesMergeAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]);
-                fun.bind = DSQuantilesBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
             }
             //sketch.AddFunction(DSQuantilesMergeAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]));
         
+        
+            {
+                auto fun = DSQuantilesCreateAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesCreateAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]));
+            {
+                auto fun = DSQuantilesMergeAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesMergeAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]));
+        
+        
+            {
+                auto fun = DSQuantilesCreateAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesCreateAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]));
+            {
+                auto fun = DSQuantilesMergeAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesMergeAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]));
+        
+        
+            {
+                auto fun = DSQuantilesCreateAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesCreateAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]));
+            {
+                auto fun = DSQuantilesMergeAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesMergeAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]));
+        
+        
+            {
+                auto fun = DSQuantilesCreateAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesCreateAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]));
+            {
+                auto fun = DSQuantilesMergeAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesMergeAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]));
+        
+        
+            {
+                auto fun = DSQuantilesCreateAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesCreateAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]));
+            {
+                auto fun = DSQuantilesMergeAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesMergeAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]));
+        
+        
+            {
+                auto fun = DSQuantilesCreateAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]);
+                
+                // Any DECIMAL binds here, see DSDecimalItemFits.
+                fun.bind = DSTrackedBind<DSQuantilesBindDecimal>;
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesCreateAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]));
+            {
+                auto fun = DSQuantilesMergeAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesMergeAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]));
+        
+        
+            {
+                auto fun = DSQuantilesCreateAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesCreateAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]));
+            {
+                auto fun = DSQuantilesMergeAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSQuantilesMergeAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]));
+        
       CreateAggregateFunctionInfo sketch_info(sketch);
 
 
@@ -2540,6 +4793,7 @@ return sketch.get_max_item();
         FunctionDescription desc;
         desc.description = "Creates a sketch_quantiles data sketch by aggregating values or by aggregating other Quantiles data sketches";
         desc.examples.push_back("datasketch_quantiles(k, data)");
+        
         sketch_info.descriptions.push_back(desc);
     }
 
@@ -2576,7 +4830,7 @@ static inline void DSKLLis_empty(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
@@ -2610,7 +4864,7 @@ static inline void DSKLLk(DataChunk &args, ExpressionState &state, Vector &resul
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
@@ -2637,57 +4891,157 @@ static inline void DSKLLcdf(DataChunk &args, ExpressionState &state, Vector &res
 
     
         
-                    UnifiedVectorFormat unified_split_points;
-                    split_points_vector.ToUnifiedFormat(args.size(), unified_split_points);
+                    auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
+                    UnifiedVectorFormat split_points_children_unified;
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
+                    const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
 
-                    // auto split_points_list_entries = UnifiedVectorFormat::GetData<list_entry_t>(unified_split_points);
-                    //         auto split_points_validitiy = FlatVector::Validity(split_points_vector);
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
+                    
+        TernaryExecutor::Execute
+        <string_t,list_entry_t,bool,list_entry_t>
+        (
+        sketch_vector,split_points_vector,inclusive_vector,result,args.size(),
+        [&](string_t sketch_data,list_entry_t split_points_data,bool inclusive_data) {
 
-                    auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
+            
+            auto sketch = [&]() {
+                try {
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
+                }
+            }();
+
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
+                    {
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
+                    {
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
+                    }
+                    
+auto cdf_result = sketch.get_CDF(split_points_ptr, split_points_data.length, inclusive_data);
+                auto current_size = ListVector::GetListSize(result);
+                auto new_size = current_size + cdf_result.size();
+                if (ListVector::GetListCapacity(result) < new_size)
+                {
+                    ListVector::Reserve(result, new_size);
+                }
+
+                auto &child_entry = ListVector::GetEntry(result);
+                auto child_vals = FlatVector::GetData<double>(child_entry);
+                //auto &child_validity = FlatVector::Validity(child_entry);
+                for (idx_t i = 0; i < cdf_result.size(); i++)
+                {
+                    child_vals[current_size + i] = cdf_result[i];
+                }
+                ListVector::SetListSize(result, new_size);
+                return list_entry_t{current_size, cdf_result.size()};
+                
+        });
+
+}
 
+    
+
+
+template <class T>
+
+static inline void DSKLLcdf_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sorted_view_vector = args.data[0];
+        auto &split_points_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+                    auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
                     UnifiedVectorFormat split_points_children_unified;
-                    split_points_list_children.ToUnifiedFormat(args.size(), split_points_children_unified);
-
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
                     const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
+
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
                     
         TernaryExecutor::Execute
         <string_t,list_entry_t,bool,list_entry_t>
         (
-        sketch_vector,split_points_vector,inclusive_vector,result,args.size(),
-        [&](string_t sketch_data,list_entry_t split_points_data,bool inclusive_data) {
+        sorted_view_vector,split_points_vector,inclusive_vector,result,args.size(),
+        [&](string_t sorted_view_data,list_entry_t split_points_data,bool inclusive_data) {
 
-            
-            auto sketch = [&]() {
-                try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
-                } catch (const std::exception &e) {
-                    throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
-                }
-            }();
+            DSSortedView<T> sorted_view(sorted_view_data);
 
-                    std::vector<T> passing_points(split_points_data.length);
-                    for (idx_t i = 0; i < split_points_data.length; i++)
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
+                    {
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
                     {
-                        passing_points[i] = split_points_list_children_data[i + split_points_data.offset];
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
                     }
                     
-auto cdf_result = sketch.get_CDF(passing_points.data(), split_points_data.length, inclusive_data);
+
                 auto current_size = ListVector::GetListSize(result);
-                auto new_size = current_size + cdf_result.size();
+                auto new_size = current_size + split_points_data.length + 1;
                 if (ListVector::GetListCapacity(result) < new_size)
                 {
                     ListVector::Reserve(result, new_size);
                 }
 
                 auto &child_entry = ListVector::GetEntry(result);
-                auto child_vals = FlatVector::GetData<T>(child_entry);
-                //auto &child_validity = FlatVector::Validity(child_entry);
-                for (idx_t i = 0; i < cdf_result.size(); i++)
-                {
-                    child_vals[current_size + i] = cdf_result[i];
-                }
+                auto child_vals = FlatVector::GetData<double>(child_entry);
+                sorted_view.GetCDF(split_points_ptr, split_points_data.length, inclusive_data, child_vals + current_size);
                 ListVector::SetListSize(result, new_size);
-                return list_entry_t{current_size, cdf_result.size()};
+                return list_entry_t{current_size, split_points_data.length + 1};
                 
         });
 
@@ -2710,18 +5064,21 @@ static inline void DSKLLpmf(DataChunk &args, ExpressionState &state, Vector &res
 
     
         
-                    UnifiedVectorFormat unified_split_points;
-                    split_points_vector.ToUnifiedFormat(args.size(), unified_split_points);
-
-                    // auto split_points_list_entries = UnifiedVectorFormat::GetData<list_entry_t>(unified_split_points);
-                    //         auto split_points_validitiy = FlatVector::Validity(split_points_vector);
-
                     auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
-
                     UnifiedVectorFormat split_points_children_unified;
-                    split_points_list_children.ToUnifiedFormat(args.size(), split_points_children_unified);
-
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
                     const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
+
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
                     
         TernaryExecutor::Execute
         <string_t,list_entry_t,bool,list_entry_t>
@@ -2732,19 +5089,35 @@ static inline void DSKLLpmf(DataChunk &args, ExpressionState &state, Vector &res
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
             }();
 
-                    std::vector<T> passing_points(split_points_data.length);
-                    for (idx_t i = 0; i < split_points_data.length; i++)
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
                     {
-                        passing_points[i] = split_points_list_children_data[i + split_points_data.offset];
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
+                    {
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
                     }
                     
-auto pmf_result = sketch.get_PMF(passing_points.data(), split_points_data.length, inclusive_data);
+auto pmf_result = sketch.get_PMF(split_points_ptr, split_points_data.length, inclusive_data);
                 auto current_size = ListVector::GetListSize(result);
                 auto new_size = current_size + pmf_result.size();
                 if (ListVector::GetListCapacity(result) < new_size)
@@ -2791,7 +5164,7 @@ static inline void DSKLLnormalized_rank_error(DataChunk &args, ExpressionState &
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
@@ -2827,7 +5200,7 @@ static inline void DSKLLdescribe(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
@@ -2863,12 +5236,41 @@ static inline void DSKLLrank(DataChunk &args, ExpressionState &state, Vector &re
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
             }();
-return sketch.get_rank(item_data, inclusive_data);
+return sketch.get_rank(DSQuantileItem<T>::FromDuckDB(item_data), inclusive_data);
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSKLLrank_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sorted_view_vector = args.data[0];
+        auto &item_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+        TernaryExecutor::Execute
+        <string_t,T,bool,double>
+        (
+        sorted_view_vector,item_vector,inclusive_vector,result,args.size(),
+        [&](string_t sorted_view_data,T item_data,bool inclusive_data) {
+
+            DSSortedView<T> sorted_view(sorted_view_data);
+return sorted_view.GetRank(item_data, inclusive_data);
         });
 
 }
@@ -2899,12 +5301,183 @@ static inline void DSKLLquantile(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
+                }
+            }();
+return DSQuantileItem<T>::ToDuckDB(result, sketch.get_quantile(rank_data, inclusive_data));
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSKLLquantile_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sorted_view_vector = args.data[0];
+        auto &rank_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+        TernaryExecutor::Execute
+        <string_t,double,bool,T>
+        (
+        sorted_view_vector,rank_vector,inclusive_vector,result,args.size(),
+        [&](string_t sorted_view_data,double rank_data,bool inclusive_data) {
+
+            DSSortedView<T> sorted_view(sorted_view_data);
+return sorted_view.GetQuantile(rank_data, inclusive_data);
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSKLLquantiles(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sketch_vector = args.data[0];
+        auto &ranks_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+                    auto &ranks_list_children = ListVector::GetEntry(ranks_vector);
+                    UnifiedVectorFormat ranks_children_unified;
+                    ranks_list_children.ToUnifiedFormat(ListVector::GetListSize(ranks_vector), ranks_children_unified);
+                    const double *ranks_list_children_data = UnifiedVectorFormat::GetData<double>(ranks_children_unified);
+                    
+        TernaryExecutor::Execute
+        <string_t,list_entry_t,bool,list_entry_t>
+        (
+        sketch_vector,ranks_vector,inclusive_vector,result,args.size(),
+        [&](string_t sketch_data,list_entry_t ranks_data,bool inclusive_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
+                }
+            }();
+
+                if (sketch.is_empty())
+                {
+                    throw InvalidInputException("Cannot query an empty KLL sketch");
+                }
+                auto sorted_view = sketch.get_sorted_view();
+
+                auto current_size = ListVector::GetListSize(result);
+                auto new_size = current_size + ranks_data.length;
+                if (ListVector::GetListCapacity(result) < new_size)
+                {
+                    ListVector::Reserve(result, new_size);
+                }
+
+                auto &child_entry = ListVector::GetEntry(result);
+                auto child_vals = FlatVector::GetData<T>(child_entry);
+                for (idx_t i = 0; i < ranks_data.length; i++)
+                {
+                    auto point_idx = ranks_children_unified.sel->get_index(ranks_data.offset + i);
+                    if (!ranks_children_unified.validity.RowIsValid(point_idx))
+                    {
+                        throw InvalidInputException("ranks cannot contain NULL values");
+                    }
+                    const auto &point = ranks_list_children_data[point_idx];
+                    if (!(point >= 0.0 && point <= 1.0))
+                    {
+                        throw InvalidInputException("Normalized rank must be between 0 and 1, got: %f", point);
+                    }
+                    child_vals[current_size + i] = DSQuantileItem<T>::ToDuckDB(child_entry, sorted_view.get_quantile(point, inclusive_data));
+                }
+                ListVector::SetListSize(result, new_size);
+                return list_entry_t{current_size, ranks_data.length};
+                
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSKLLranks(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sketch_vector = args.data[0];
+        auto &items_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+                    auto &items_list_children = ListVector::GetEntry(items_vector);
+                    UnifiedVectorFormat items_children_unified;
+                    items_list_children.ToUnifiedFormat(ListVector::GetListSize(items_vector), items_children_unified);
+                    const T *items_list_children_data = UnifiedVectorFormat::GetData<T>(items_children_unified);
+                    
+        TernaryExecutor::Execute
+        <string_t,list_entry_t,bool,list_entry_t>
+        (
+        sketch_vector,items_vector,inclusive_vector,result,args.size(),
+        [&](string_t sketch_data,list_entry_t items_data,bool inclusive_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
             }();
-return sketch.get_quantile(rank_data, inclusive_data);
+
+                if (sketch.is_empty())
+                {
+                    throw InvalidInputException("Cannot query an empty KLL sketch");
+                }
+                auto sorted_view = sketch.get_sorted_view();
+
+                auto current_size = ListVector::GetListSize(result);
+                auto new_size = current_size + items_data.length;
+                if (ListVector::GetListCapacity(result) < new_size)
+                {
+                    ListVector::Reserve(result, new_size);
+                }
+
+                auto &child_entry = ListVector::GetEntry(result);
+                auto child_vals = FlatVector::GetData<double>(child_entry);
+                for (idx_t i = 0; i < items_data.length; i++)
+                {
+                    auto point_idx = items_children_unified.sel->get_index(items_data.offset + i);
+                    if (!items_children_unified.validity.RowIsValid(point_idx))
+                    {
+                        throw InvalidInputException("items cannot contain NULL values");
+                    }
+                    const auto &point = items_list_children_data[point_idx];
+                    child_vals[current_size + i] = sorted_view.get_rank(DSQuantileItem<T>::FromDuckDB(point), inclusive_data);
+                }
+                ListVector::SetListSize(result, new_size);
+                return list_entry_t{current_size, items_data.length};
+                
         });
 
 }
@@ -2933,7 +5506,7 @@ static inline void DSKLLn(DataChunk &args, ExpressionState &state, Vector &resul
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
@@ -2967,7 +5540,7 @@ static inline void DSKLLis_estimation_mode(DataChunk &args, ExpressionState &sta
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
@@ -3001,7 +5574,7 @@ static inline void DSKLLnum_retained(DataChunk &args, ExpressionState &state, Ve
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
@@ -3035,12 +5608,12 @@ static inline void DSKLLmin_item(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
             }();
-return sketch.get_min_item();
+return DSQuantileItem<T>::ToDuckDB(result, sketch.get_min_item());
         });
 
 }
@@ -3069,12 +5642,46 @@ static inline void DSKLLmax_item(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::kll_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
+                }
+            }();
+return DSQuantileItem<T>::ToDuckDB(result, sketch.get_max_item());
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSKLLto_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 1);
+
+    
+        auto &sketch_vector = args.data[0];
+
+    
+        
+        UnaryExecutor::Execute
+        <string_t,string_t>
+        (
+        sketch_vector,result,args.size(),
+        [&](string_t sketch_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
                 }
             }();
-return sketch.get_max_item();
+return DSSortedView<T>::Serialize(result, sketch);
         });
 
 }
@@ -3082,14 +5689,85 @@ return sketch.get_max_item();
     
 
 
+template <class T>
+
+static inline void DSKLLsummary(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 1);
+
+    
+        auto &sketch_vector = args.data[0];
+
+    
+        UnifiedVectorFormat sketch_unified;
+        sketch_vector.ToUnifiedFormat(args.size(), sketch_unified);
+        auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_unified);
+        auto &struct_entries = StructVector::GetEntries(result);
+
+        for (idx_t row = 0; row < args.size(); row++)
+        {
+            auto sketch_idx = sketch_unified.sel->get_index(row);
+            if (!sketch_unified.validity.RowIsValid(sketch_idx))
+            {
+                FlatVector::SetNull(result, row, true);
+                continue;
+            }
+            auto sketch_data = sketch_entries[sketch_idx];
+            
+            auto sketch = [&]() {
+                try {
+                    return DSKLLSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize KLL sketch: %s", e.what());
+                }
+            }();
+            
+            FlatVector::GetData<uint16_t>(*struct_entries[0])[row] = sketch.get_k();
+            FlatVector::GetData<uint64_t>(*struct_entries[1])[row] = sketch.get_n();
+            FlatVector::GetData<bool>(*struct_entries[2])[row] = sketch.is_empty();
+            FlatVector::GetData<bool>(*struct_entries[3])[row] = sketch.is_estimation_mode();
+            FlatVector::GetData<uint64_t>(*struct_entries[4])[row] = sketch.get_num_retained();
+            if (sketch.is_empty())
+            {
+                FlatVector::SetNull(*struct_entries[5], row, true);
+            }
+            else
+            {
+                FlatVector::GetData<T>(*struct_entries[5])[row] = DSQuantileItem<T>::ToDuckDB(*struct_entries[5], sketch.get_min_item());
+            }
+            if (sketch.is_empty())
+            {
+                FlatVector::SetNull(*struct_entries[6], row, true);
+            }
+            else
+            {
+                FlatVector::GetData<T>(*struct_entries[6])[row] = DSQuantileItem<T>::ToDuckDB(*struct_entries[6], sketch.get_max_item());
+            }
+            FlatVector::GetData<double>(*struct_entries[7])[row] = sketch.get_normalized_rank_error(false);
+            FlatVector::GetData<double>(*struct_entries[8])[row] = sketch.get_normalized_rank_error(true);
+        }
+
+        if (args.AllConstant())
+        {
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        }
+
+}
+
+    
+
+
     
     template <typename T>
     auto static DSKLLMergeAggregate(const LogicalType &type, const LogicalType &result_type) -> AggregateFunction
     
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSKLLState<T>, string_t, string_t, DSQuantilesMergeOperation<DSKLLBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSKLLState<T>, string_t, string_t, DSQuantilesMergeOperation<DSKLLBindData>, AggregateDestructorType::LEGACY>(
             result_type, result_type);
+        fun.bind = DSTrackedBind<DSKLLBind<DSKLLState<T>, string_t, DSQuantilesMergeOperation<DSKLLBindData>>>;
+        return fun;
         
     }
 
@@ -3099,11 +5777,30 @@ return sketch.get_max_item();
     auto static DSKLLCreateAggregate(const LogicalType &type, const LogicalType &result_type) -> AggregateFunction
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSKLLState<T>, T, string_t, DSQuantilesCreateOperation<DSKLLBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSKLLState<T>, T, string_t, DSQuantilesCreateOperation<DSKLLBindData>, AggregateDestructorType::LEGACY>(
             type, result_type);
+        fun.bind = DSTrackedBind<DSKLLBind<DSKLLState<T>, T, DSQuantilesCreateOperation<DSKLLBindData>>>;
+        return fun;
         
     }
 
+    
+    static unique_ptr<FunctionData> DSKLLBindDecimal(ClientContext &context, AggregateFunction &function,
+                                                        vector<unique_ptr<Expression>> &arguments)
+    {
+        if (DSDecimalItemFits(arguments[1]->return_type)) {
+            return DSKLLBind<DSKLLState<hugeint_t>, hugeint_t, DSQuantilesCreateOperation<DSKLLBindData>>(context, function, arguments);
+        }
+        auto name = function.name;
+        auto k_type = function.arguments[0];
+        function = DSKLLCreateAggregate<double>(LogicalType::DOUBLE, DSSketchAliasType("sketch_kll_", LogicalType::DOUBLE));
+        function.name = name;
+        function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+        function.arguments.insert(function.arguments.begin(), k_type);
+        return function.bind(context, function, arguments);
+    }
+    
+
 
   void LoadKLLSketch(ExtensionLoader &loader) {
 
@@ -3111,16 +5808,44 @@ return sketch.get_max_item();
       
         std::unordered_map<LogicalTypeId, LogicalType> sketch_map_types;
         
-            sketch_map_types.insert({ LogicalTypeId::TINYINT, CreateKLLSketchType(loader, LogicalType(LogicalTypeId::TINYINT))});
-            sketch_map_types.insert({ LogicalTypeId::SMALLINT, CreateKLLSketchType(loader, LogicalType(LogicalTypeId::SMALLINT))});
-            sketch_map_types.insert({ LogicalTypeId::INTEGER, CreateKLLSketchType(loader, LogicalType(LogicalTypeId::INTEGER))});
-            sketch_map_types.insert({ LogicalTypeId::BIGINT, CreateKLLSketchType(loader, LogicalType(LogicalTypeId::BIGINT))});
-            sketch_map_types.insert({ LogicalTypeId::FLOAT, CreateKLLSketchType(loader, LogicalType(LogicalTypeId::FLOAT))});
-            sketch_map_types.insert({ LogicalTypeId::DOUBLE, CreateKLLSketchType(loader, LogicalType(LogicalTypeId::DOUBLE))});
-            sketch_map_types.insert({ LogicalTypeId::UTINYINT, CreateKLLSketchType(loader, LogicalType(LogicalTypeId::UTINYINT))});
-            sketch_map_types.insert({ LogicalTypeId::USMALLINT, CreateKLLSketchType(loader, LogicalType(LogicalTypeId::USMALLINT))});
-            sketch_map_types.insert({ LogicalTypeId::UINTEGER, CreateKLLSketchType(loader, LogicalType(LogicalTypeId::UINTEGER))});
-            sketch_map_types.insert({ LogicalTypeId::UBIGINT, CreateKLLSketchType(loader, LogicalType(LogicalTypeId::UBIGINT))});
+            sketch_map_types.insert({ LogicalTypeId::TINYINT, CreateKLLSketchType(loader, LogicalType::TINYINT)});
+            sketch_map_types.insert({ LogicalTypeId::SMALLINT, CreateKLLSketchType(loader, LogicalType::SMALLINT)});
+            sketch_map_types.insert({ LogicalTypeId::INTEGER, CreateKLLSketchType(loader, LogicalType::INTEGER)});
+            sketch_map_types.insert({ LogicalTypeId::BIGINT, CreateKLLSketchType(loader, LogicalType::BIGINT)});
+            sketch_map_types.insert({ LogicalTypeId::FLOAT, CreateKLLSketchType(loader, LogicalType::FLOAT)});
+            sketch_map_types.insert({ LogicalTypeId::DOUBLE, CreateKLLSketchType(loader, LogicalType::DOUBLE)});
+            sketch_map_types.insert({ LogicalTypeId::UTINYINT, CreateKLLSketchType(loader, LogicalType::UTINYINT)});
+            sketch_map_types.insert({ LogicalTypeId::USMALLINT, CreateKLLSketchType(loader, LogicalType::USMALLINT)});
+            sketch_map_types.insert({ LogicalTypeId::UINTEGER, CreateKLLSketchType(loader, LogicalType::UINTEGER)});
+            sketch_map_types.insert({ LogicalTypeId::UBIGINT, CreateKLLSketchType(loader, LogicalType::UBIGINT)});
+            sketch_map_types.insert({ LogicalTypeId::DATE, CreateKLLSketchType(loader, LogicalType::DATE)});
+            sketch_map_types.insert({ LogicalTypeId::TIME, CreateKLLSketchType(loader, LogicalType::TIME)});
+            sketch_map_types.insert({ LogicalTypeId::TIMESTAMP, CreateKLLSketchType(loader, LogicalType::TIMESTAMP)});
+            sketch_map_types.insert({ LogicalTypeId::TIMESTAMP_TZ, CreateKLLSketchType(loader, LogicalType::TIMESTAMP_TZ)});
+            sketch_map_types.insert({ LogicalTypeId::HUGEINT, CreateKLLSketchType(loader, LogicalType::HUGEINT)});
+            sketch_map_types.insert({ LogicalTypeId::DECIMAL, CreateKLLSketchType(loader, LogicalType::DECIMAL(38, 18))});
+            sketch_map_types.insert({ LogicalTypeId::VARCHAR, CreateKLLSketchType(loader, LogicalType::VARCHAR)});
+      
+
+      
+        std::unordered_map<LogicalTypeId, LogicalType> sorted_view_map_types;
+        
+            sorted_view_map_types.insert({ LogicalTypeId::TINYINT, CreateKLLSortedViewType(loader, LogicalType::TINYINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::SMALLINT, CreateKLLSortedViewType(loader, LogicalType::SMALLINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::INTEGER, CreateKLLSortedViewType(loader, LogicalType::INTEGER)});
+            sorted_view_map_types.insert({ LogicalTypeId::BIGINT, CreateKLLSortedViewType(loader, LogicalType::BIGINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::FLOAT, CreateKLLSortedViewType(loader, LogicalType::FLOAT)});
+            sorted_view_map_types.insert({ LogicalTypeId::DOUBLE, CreateKLLSortedViewType(loader, LogicalType::DOUBLE)});
+            sorted_view_map_types.insert({ LogicalTypeId::UTINYINT, CreateKLLSortedViewType(loader, LogicalType::UTINYINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::USMALLINT, CreateKLLSortedViewType(loader, LogicalType::USMALLINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::UINTEGER, CreateKLLSortedViewType(loader, LogicalType::UINTEGER)});
+            sorted_view_map_types.insert({ LogicalTypeId::UBIGINT, CreateKLLSortedViewType(loader, LogicalType::UBIGINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::DATE, CreateKLLSortedViewType(loader, LogicalType::DATE)});
+            sorted_view_map_types.insert({ LogicalTypeId::TIME, CreateKLLSortedViewType(loader, LogicalType::TIME)});
+            sorted_view_map_types.insert({ LogicalTypeId::TIMESTAMP, CreateKLLSortedViewType(loader, LogicalType::TIMESTAMP)});
+            sorted_view_map_types.insert({ LogicalTypeId::TIMESTAMP_TZ, CreateKLLSortedViewType(loader, LogicalType::TIMESTAMP_TZ)});
+            sorted_view_map_types.insert({ LogicalTypeId::HUGEINT, CreateKLLSortedViewType(loader, LogicalType::HUGEINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::DECIMAL, CreateKLLSortedViewType(loader, LogicalType::DECIMAL(38, 18))});
       
 
       
@@ -3128,36 +5853,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_is_empty");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_empty<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_empty<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_empty<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_empty<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::BOOLEAN
-                ,    DSKLLis_empty<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_empty<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_empty<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::BOOLEAN
-                ,    DSKLLis_empty<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_empty<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::BOOLEAN
-                ,    DSKLLis_empty<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_empty<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_empty<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_empty<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_empty<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_empty<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::BOOLEAN
-                ,    DSKLLis_empty<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_empty<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_empty<uint64_t>));
+                ,    DSKLLis_empty<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::BOOLEAN
+                ,    DSKLLis_empty<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::BOOLEAN
+                ,    DSKLLis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::BOOLEAN
+                ,    DSKLLis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::BOOLEAN
+                ,    DSKLLis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::BOOLEAN
+                ,    DSKLLis_empty<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::BOOLEAN
+                ,    DSKLLis_empty<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::BOOLEAN
+                ,    DSKLLis_empty<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3177,36 +5924,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_k");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::USMALLINT
-                ,    DSKLLk<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLk<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::USMALLINT
-                ,    DSKLLk<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLk<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::USMALLINT
-                ,    DSKLLk<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLk<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::USMALLINT
-                ,    DSKLLk<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::USMALLINT
-                ,    DSKLLk<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLk<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::USMALLINT
-                ,    DSKLLk<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLk<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::USMALLINT
-                ,    DSKLLk<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLk<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::USMALLINT
-                ,    DSKLLk<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLk<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::USMALLINT
-                ,    DSKLLk<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLk<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::USMALLINT
-                ,    DSKLLk<uint64_t>));
+                ,    DSKLLk<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::USMALLINT
+                ,    DSKLLk<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::USMALLINT
+                ,    DSKLLk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::USMALLINT
+                ,    DSKLLk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::USMALLINT
+                ,    DSKLLk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::USMALLINT
+                ,    DSKLLk<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::USMALLINT
+                ,    DSKLLk<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::USMALLINT
+                ,    DSKLLk<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3226,36 +5995,107 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_cdf");
         
             
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TINYINT)
-                ,    DSKLLcdf<int8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::SMALLINT)
-                ,    DSKLLcdf<int16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::INTEGER)
-                ,    DSKLLcdf<int32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::BIGINT)
-                ,    DSKLLcdf<int64_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::FLOAT)
-                ,    DSKLLcdf<float>));
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
-                ,    DSKLLcdf<double>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UTINYINT)
-                ,    DSKLLcdf<uint8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::USMALLINT)
-                ,    DSKLLcdf<uint16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UINTEGER)
-                ,    DSKLLcdf<uint32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UBIGINT)
-                ,    DSKLLcdf<uint64_t>));
+                ,    DSKLLcdf<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::VARCHAR),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf<string_t>), DSUnitIntervalListStatistics));
+            
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLcdf_sorted_view<hugeint_t>), DSUnitIntervalListStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3275,36 +6115,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_pmf");
         
             
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TINYINT)
-                ,    DSKLLpmf<int8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::SMALLINT)
-                ,    DSKLLpmf<int16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::INTEGER)
-                ,    DSKLLpmf<int32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::BIGINT)
-                ,    DSKLLpmf<int64_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::FLOAT)
-                ,    DSKLLpmf<float>));
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
-                ,    DSKLLpmf<double>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UTINYINT)
-                ,    DSKLLpmf<uint8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::USMALLINT)
-                ,    DSKLLpmf<uint16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UINTEGER)
-                ,    DSKLLpmf<uint32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UBIGINT)
-                ,    DSKLLpmf<uint64_t>));
+                ,    DSKLLpmf<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::VARCHAR),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLpmf<string_t>), DSUnitIntervalListStatistics));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3324,36 +6186,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_normalized_rank_error");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLnormalized_rank_error<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnormalized_rank_error<int8_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLnormalized_rank_error<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnormalized_rank_error<int16_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLnormalized_rank_error<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnormalized_rank_error<int32_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLnormalized_rank_error<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnormalized_rank_error<int64_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLnormalized_rank_error<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnormalized_rank_error<float>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLnormalized_rank_error<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnormalized_rank_error<double>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLnormalized_rank_error<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnormalized_rank_error<uint8_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLnormalized_rank_error<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnormalized_rank_error<uint16_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLnormalized_rank_error<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnormalized_rank_error<uint32_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLnormalized_rank_error<uint64_t>));
+                ,    DSKLLnormalized_rank_error<uint64_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLnormalized_rank_error<int32_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLnormalized_rank_error<int64_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLnormalized_rank_error<int64_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLnormalized_rank_error<int64_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLnormalized_rank_error<hugeint_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLnormalized_rank_error<hugeint_t>), DSNonNegativeStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLnormalized_rank_error<string_t>), DSNonNegativeStatistics));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3373,36 +6257,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_describe");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSKLLdescribe<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLdescribe<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSKLLdescribe<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLdescribe<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSKLLdescribe<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLdescribe<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSKLLdescribe<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSKLLdescribe<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLdescribe<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSKLLdescribe<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLdescribe<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSKLLdescribe<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLdescribe<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSKLLdescribe<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLdescribe<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSKLLdescribe<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLdescribe<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSKLLdescribe<uint64_t>));
+                ,    DSKLLdescribe<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSKLLdescribe<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSKLLdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSKLLdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSKLLdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSKLLdescribe<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSKLLdescribe<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSKLLdescribe<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3422,36 +6328,107 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_rank");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::TINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLrank<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLrank<int8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::SMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLrank<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLrank<int16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::INTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLrank<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLrank<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::BIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLrank<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::FLOAT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLrank<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLrank<float>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLrank<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLrank<double>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::UTINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLrank<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLrank<uint8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::USMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLrank<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLrank<uint16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::UINTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLrank<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLrank<uint32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::UBIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLrank<uint64_t>));
+                ,    DSKLLrank<uint64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::DATE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::TIME,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::TIMESTAMP,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::TIMESTAMP_TZ,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::HUGEINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank<hugeint_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::DECIMAL(38, 18),LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank<hugeint_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::VARCHAR,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank<string_t>), DSUnitIntervalStatistics));
+            
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TINYINT],LogicalType::TINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<int8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::SMALLINT],LogicalType::SMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<int16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::INTEGER],LogicalType::INTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::BIGINT],LogicalType::BIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::FLOAT],LogicalType::FLOAT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<float>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<double>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UTINYINT],LogicalType::UTINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<uint8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::USMALLINT],LogicalType::USMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<uint16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UINTEGER],LogicalType::UINTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<uint32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UBIGINT],LogicalType::UBIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<uint64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DATE],LogicalType::DATE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIME],LogicalType::TIME,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP],LogicalType::TIMESTAMP,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::TIMESTAMP_TZ,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::HUGEINT],LogicalType::HUGEINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<hugeint_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DECIMAL],LogicalType::DECIMAL(38, 18),LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLrank_sorted_view<hugeint_t>), DSUnitIntervalStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3471,36 +6448,107 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_quantile");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TINYINT
-                ,    DSKLLquantile<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLquantile<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::SMALLINT
-                ,    DSKLLquantile<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLquantile<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::INTEGER
-                ,    DSKLLquantile<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLquantile<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::BIGINT
-                ,    DSKLLquantile<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::FLOAT
-                ,    DSKLLquantile<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLquantile<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSKLLquantile<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLquantile<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UTINYINT
-                ,    DSKLLquantile<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLquantile<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::USMALLINT
-                ,    DSKLLquantile<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLquantile<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UINTEGER
-                ,    DSKLLquantile<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLquantile<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UBIGINT
-                ,    DSKLLquantile<uint64_t>));
+                ,    DSKLLquantile<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DATE
+                ,    DSKLLquantile<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIME
+                ,    DSKLLquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP
+                ,    DSKLLquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP_TZ
+                ,    DSKLLquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::HUGEINT
+                ,    DSKLLquantile<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DECIMAL(38, 18)
+                ,    DSKLLquantile<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSKLLquantile<string_t>), nullptr));
+            
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TINYINT
+                ,    DSKLLquantile_sorted_view<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::SMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::SMALLINT
+                ,    DSKLLquantile_sorted_view<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::INTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::INTEGER
+                ,    DSKLLquantile_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::BIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::BIGINT
+                ,    DSKLLquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::FLOAT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::FLOAT
+                ,    DSKLLquantile_sorted_view<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSKLLquantile_sorted_view<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UTINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UTINYINT
+                ,    DSKLLquantile_sorted_view<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::USMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::USMALLINT
+                ,    DSKLLquantile_sorted_view<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UINTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UINTEGER
+                ,    DSKLLquantile_sorted_view<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UBIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UBIGINT
+                ,    DSKLLquantile_sorted_view<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DATE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DATE
+                ,    DSKLLquantile_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIME],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIME
+                ,    DSKLLquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP
+                ,    DSKLLquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP_TZ
+                ,    DSKLLquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::HUGEINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::HUGEINT
+                ,    DSKLLquantile_sorted_view<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DECIMAL],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DECIMAL(38, 18)
+                ,    DSKLLquantile_sorted_view<hugeint_t>), nullptr));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3515,41 +6563,205 @@ return sketch.get_max_item();
         loader.RegisterFunction(info);
 
 
+      }
+      {
+        ScalarFunctionSet fs("datasketch_kll_quantiles");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TINYINT)
+                ,    DSKLLquantiles<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::SMALLINT)
+                ,    DSKLLquantiles<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::INTEGER)
+                ,    DSKLLquantiles<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::BIGINT)
+                ,    DSKLLquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::FLOAT)
+                ,    DSKLLquantiles<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLquantiles<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UTINYINT)
+                ,    DSKLLquantiles<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::USMALLINT)
+                ,    DSKLLquantiles<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UINTEGER)
+                ,    DSKLLquantiles<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UBIGINT)
+                ,    DSKLLquantiles<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DATE)
+                ,    DSKLLquantiles<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TIME)
+                ,    DSKLLquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TIMESTAMP)
+                ,    DSKLLquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TIMESTAMP_TZ)
+                ,    DSKLLquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::HUGEINT)
+                ,    DSKLLquantiles<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DECIMAL(38, 18))
+                ,    DSKLLquantiles<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::VARCHAR)
+                ,    DSKLLquantiles<string_t>), nullptr));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return the quantiles of a list of ranks in the sketch, computed from a single sorted view";
+            desc.examples.push_back("datasketch_kll_quantiles(sketch, ranks, inclusive)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
+      }
+      {
+        ScalarFunctionSet fs("datasketch_kll_ranks");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::VARCHAR),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSKLLranks<string_t>), DSUnitIntervalListStatistics));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return the ranks of a list of items in the sketch, computed from a single sorted view";
+            desc.examples.push_back("datasketch_kll_ranks(sketch, items, inclusive)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
       }
       {
         ScalarFunctionSet fs("datasketch_kll_n");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::UBIGINT
-                ,    DSKLLn<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLn<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::UBIGINT
-                ,    DSKLLn<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLn<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::UBIGINT
-                ,    DSKLLn<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLn<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::UBIGINT
-                ,    DSKLLn<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::UBIGINT
-                ,    DSKLLn<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLn<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::UBIGINT
-                ,    DSKLLn<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLn<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UBIGINT
-                ,    DSKLLn<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLn<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::UBIGINT
-                ,    DSKLLn<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLn<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UBIGINT
-                ,    DSKLLn<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLn<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSKLLn<uint64_t>));
+                ,    DSKLLn<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::UBIGINT
+                ,    DSKLLn<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::UBIGINT
+                ,    DSKLLn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::UBIGINT
+                ,    DSKLLn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::UBIGINT
+                ,    DSKLLn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::UBIGINT
+                ,    DSKLLn<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::UBIGINT
+                ,    DSKLLn<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::UBIGINT
+                ,    DSKLLn<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3569,36 +6781,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_is_estimation_mode");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_estimation_mode<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_estimation_mode<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_estimation_mode<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_estimation_mode<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::BOOLEAN
-                ,    DSKLLis_estimation_mode<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_estimation_mode<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_estimation_mode<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::BOOLEAN
-                ,    DSKLLis_estimation_mode<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_estimation_mode<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::BOOLEAN
-                ,    DSKLLis_estimation_mode<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_estimation_mode<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_estimation_mode<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_estimation_mode<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_estimation_mode<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_estimation_mode<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::BOOLEAN
-                ,    DSKLLis_estimation_mode<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLis_estimation_mode<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::BOOLEAN
-                ,    DSKLLis_estimation_mode<uint64_t>));
+                ,    DSKLLis_estimation_mode<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::BOOLEAN
+                ,    DSKLLis_estimation_mode<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::BOOLEAN
+                ,    DSKLLis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::BOOLEAN
+                ,    DSKLLis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::BOOLEAN
+                ,    DSKLLis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::BOOLEAN
+                ,    DSKLLis_estimation_mode<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::BOOLEAN
+                ,    DSKLLis_estimation_mode<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::BOOLEAN
+                ,    DSKLLis_estimation_mode<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3618,36 +6852,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_num_retained");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::UBIGINT
-                ,    DSKLLnum_retained<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnum_retained<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::UBIGINT
-                ,    DSKLLnum_retained<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnum_retained<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::UBIGINT
-                ,    DSKLLnum_retained<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnum_retained<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::UBIGINT
-                ,    DSKLLnum_retained<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::UBIGINT
-                ,    DSKLLnum_retained<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnum_retained<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::UBIGINT
-                ,    DSKLLnum_retained<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnum_retained<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UBIGINT
-                ,    DSKLLnum_retained<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnum_retained<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::UBIGINT
-                ,    DSKLLnum_retained<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnum_retained<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UBIGINT
-                ,    DSKLLnum_retained<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLnum_retained<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSKLLnum_retained<uint64_t>));
+                ,    DSKLLnum_retained<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::UBIGINT
+                ,    DSKLLnum_retained<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::UBIGINT
+                ,    DSKLLnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::UBIGINT
+                ,    DSKLLnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::UBIGINT
+                ,    DSKLLnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::UBIGINT
+                ,    DSKLLnum_retained<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::UBIGINT
+                ,    DSKLLnum_retained<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::UBIGINT
+                ,    DSKLLnum_retained<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3667,36 +6923,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_min_item");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::TINYINT
-                ,    DSKLLmin_item<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmin_item<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::SMALLINT
-                ,    DSKLLmin_item<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmin_item<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::INTEGER
-                ,    DSKLLmin_item<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmin_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BIGINT
-                ,    DSKLLmin_item<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::FLOAT
-                ,    DSKLLmin_item<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmin_item<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::DOUBLE
-                ,    DSKLLmin_item<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmin_item<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UTINYINT
-                ,    DSKLLmin_item<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmin_item<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::USMALLINT
-                ,    DSKLLmin_item<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmin_item<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UINTEGER
-                ,    DSKLLmin_item<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmin_item<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSKLLmin_item<uint64_t>));
+                ,    DSKLLmin_item<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::DATE
+                ,    DSKLLmin_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::TIME
+                ,    DSKLLmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::TIMESTAMP
+                ,    DSKLLmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::TIMESTAMP_TZ
+                ,    DSKLLmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::HUGEINT
+                ,    DSKLLmin_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::DECIMAL(38, 18)
+                ,    DSKLLmin_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::VARCHAR
+                ,    DSKLLmin_item<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3716,36 +6994,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_kll_max_item");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::TINYINT
-                ,    DSKLLmax_item<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmax_item<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::SMALLINT
-                ,    DSKLLmax_item<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmax_item<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::INTEGER
-                ,    DSKLLmax_item<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmax_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BIGINT
-                ,    DSKLLmax_item<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::FLOAT
-                ,    DSKLLmax_item<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmax_item<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::DOUBLE
-                ,    DSKLLmax_item<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmax_item<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UTINYINT
-                ,    DSKLLmax_item<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmax_item<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::USMALLINT
-                ,    DSKLLmax_item<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmax_item<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UINTEGER
-                ,    DSKLLmax_item<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSKLLmax_item<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSKLLmax_item<uint64_t>));
+                ,    DSKLLmax_item<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::DATE
+                ,    DSKLLmax_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::TIME
+                ,    DSKLLmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::TIMESTAMP
+                ,    DSKLLmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::TIMESTAMP_TZ
+                ,    DSKLLmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::HUGEINT
+                ,    DSKLLmax_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::DECIMAL(38, 18)
+                ,    DSKLLmax_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::VARCHAR
+                ,    DSKLLmax_item<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -3760,6 +7060,145 @@ return sketch.get_max_item();
         loader.RegisterFunction(info);
 
 
+      }
+      {
+        ScalarFunctionSet fs("datasketch_kll_to_sorted_view");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT]},sorted_view_map_types[LogicalTypeId::TINYINT]
+                ,    DSKLLto_sorted_view<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT]},sorted_view_map_types[LogicalTypeId::SMALLINT]
+                ,    DSKLLto_sorted_view<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER]},sorted_view_map_types[LogicalTypeId::INTEGER]
+                ,    DSKLLto_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT]},sorted_view_map_types[LogicalTypeId::BIGINT]
+                ,    DSKLLto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT]},sorted_view_map_types[LogicalTypeId::FLOAT]
+                ,    DSKLLto_sorted_view<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE]},sorted_view_map_types[LogicalTypeId::DOUBLE]
+                ,    DSKLLto_sorted_view<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT]},sorted_view_map_types[LogicalTypeId::UTINYINT]
+                ,    DSKLLto_sorted_view<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT]},sorted_view_map_types[LogicalTypeId::USMALLINT]
+                ,    DSKLLto_sorted_view<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER]},sorted_view_map_types[LogicalTypeId::UINTEGER]
+                ,    DSKLLto_sorted_view<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT]},sorted_view_map_types[LogicalTypeId::UBIGINT]
+                ,    DSKLLto_sorted_view<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},sorted_view_map_types[LogicalTypeId::DATE]
+                ,    DSKLLto_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},sorted_view_map_types[LogicalTypeId::TIME]
+                ,    DSKLLto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},sorted_view_map_types[LogicalTypeId::TIMESTAMP]
+                ,    DSKLLto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ]
+                ,    DSKLLto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},sorted_view_map_types[LogicalTypeId::HUGEINT]
+                ,    DSKLLto_sorted_view<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},sorted_view_map_types[LogicalTypeId::DECIMAL]
+                ,    DSKLLto_sorted_view<hugeint_t>), nullptr));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return a precomputed sorted view of the sketch that answers quantile, rank and cdf queries without deserializing";
+            desc.examples.push_back("datasketch_kll_to_sorted_view(sketch)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
+      }
+      {
+        ScalarFunctionSet fs("datasketch_kll_summary");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TINYINT},{"max_item", LogicalType::TINYINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::SMALLINT},{"max_item", LogicalType::SMALLINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::INTEGER},{"max_item", LogicalType::INTEGER},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::BIGINT},{"max_item", LogicalType::BIGINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::FLOAT},{"max_item", LogicalType::FLOAT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::DOUBLE},{"max_item", LogicalType::DOUBLE},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::UTINYINT},{"max_item", LogicalType::UTINYINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::USMALLINT},{"max_item", LogicalType::USMALLINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::UINTEGER},{"max_item", LogicalType::UINTEGER},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::UBIGINT},{"max_item", LogicalType::UBIGINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::DATE},{"max_item", LogicalType::DATE},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TIME},{"max_item", LogicalType::TIME},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TIMESTAMP},{"max_item", LogicalType::TIMESTAMP},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TIMESTAMP_TZ},{"max_item", LogicalType::TIMESTAMP_TZ},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::HUGEINT},{"max_item", LogicalType::HUGEINT},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::DECIMAL(38, 18)},{"max_item", LogicalType::DECIMAL(38, 18)},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::VARCHAR},{"max_item", LogicalType::VARCHAR},{"normalized_rank_error", LogicalType::DOUBLE},{"normalized_rank_error_pmf", LogicalType::DOUBLE}})
+                ,    DSKLLsummary<string_t>), nullptr));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return a struct of the metadata and estimates of the sketch from a single deserialization";
+            desc.examples.push_back("datasketch_kll_summary(sketch)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
       }
 
       // This funciton creates the sketches.
@@ -3769,7 +7208,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSKLLCreateAggregate<int8_t>(LogicalType::TINYINT, sketch_map_types[LogicalTypeId::TINYINT]);
-                fun.bind = DSKLLBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3777,7 +7216,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSKLLCreateAggregate<int8_t>(LogicalType::TINYINT, sketch_map_types[LogicalTypeId::TINYINT]));
             {
                 auto fun = DSKLLMergeAggregate<int8_t>(LogicalType::TINYINT, sketch_map_types[LogicalTypeId::TINYINT]);
-                fun.bind = DSKLLBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3787,7 +7225,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSKLLCreateAggregate<int16_t>(LogicalType::SMALLINT, sketch_map_types[LogicalTypeId::SMALLINT]);
-                fun.bind = DSKLLBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3795,7 +7233,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSKLLCreateAggregate<int16_t>(LogicalType::SMALLINT, sketch_map_types[LogicalTypeId::SMALLINT]));
             {
                 auto fun = DSKLLMergeAggregate<int16_t>(LogicalType::SMALLINT, sketch_map_types[LogicalTypeId::SMALLINT]);
-                fun.bind = DSKLLBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3805,7 +7242,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSKLLCreateAggregate<int32_t>(LogicalType::INTEGER, sketch_map_types[LogicalTypeId::INTEGER]);
-                fun.bind = DSKLLBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3813,7 +7250,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSKLLCreateAggregate<int32_t>(LogicalType::INTEGER, sketch_map_types[LogicalTypeId::INTEGER]));
             {
                 auto fun = DSKLLMergeAggregate<int32_t>(LogicalType::INTEGER, sketch_map_types[LogicalTypeId::INTEGER]);
-                fun.bind = DSKLLBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3823,7 +7259,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSKLLCreateAggregate<int64_t>(LogicalType::BIGINT, sketch_map_types[LogicalTypeId::BIGINT]);
-                fun.bind = DSKLLBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3831,7 +7267,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSKLLCreateAggregate<int64_t>(LogicalType::BIGINT, sketch_map_types[LogicalTypeId::BIGINT]));
             {
                 auto fun = DSKLLMergeAggregate<int64_t>(LogicalType::BIGINT, sketch_map_types[LogicalTypeId::BIGINT]);
-                fun.bind = DSKLLBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3841,7 +7276,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSKLLCreateAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]);
-                fun.bind = DSKLLBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3849,7 +7284,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSKLLCreateAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]));
             {
                 auto fun = DSKLLMergeAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]);
-                fun.bind = DSKLLBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3859,7 +7293,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSKLLCreateAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]);
-                fun.bind = DSKLLBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3867,7 +7301,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSKLLCreateAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]));
             {
                 auto fun = DSKLLMergeAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]);
-                fun.bind = DSKLLBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3877,7 +7310,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSKLLCreateAggregate<uint8_t>(LogicalType::UTINYINT, sketch_map_types[LogicalTypeId::UTINYINT]);
-                fun.bind = DSKLLBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3885,7 +7318,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSKLLCreateAggregate<uint8_t>(LogicalType::UTINYINT, sketch_map_types[LogicalTypeId::UTINYINT]));
             {
                 auto fun = DSKLLMergeAggregate<uint8_t>(LogicalType::UTINYINT, sketch_map_types[LogicalTypeId::UTINYINT]);
-                fun.bind = DSKLLBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3895,7 +7327,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSKLLCreateAggregate<uint16_t>(LogicalType::USMALLINT, sketch_map_types[LogicalTypeId::USMALLINT]);
-                fun.bind = DSKLLBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3903,7 +7335,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSKLLCreateAggregate<uint16_t>(LogicalType::USMALLINT, sketch_map_types[LogicalTypeId::USMALLINT]));
             {
                 auto fun = DSKLLMergeAggregate<uint16_t>(LogicalType::USMALLINT, sketch_map_types[LogicalTypeId::USMALLINT]);
-                fun.bind = DSKLLBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3913,7 +7344,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSKLLCreateAggregate<uint32_t>(LogicalType::UINTEGER, sketch_map_types[LogicalTypeId::UINTEGER]);
-                fun.bind = DSKLLBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3921,7 +7352,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSKLLCreateAggregate<uint32_t>(LogicalType::UINTEGER, sketch_map_types[LogicalTypeId::UINTEGER]));
             {
                 auto fun = DSKLLMergeAggregate<uint32_t>(LogicalType::UINTEGER, sketch_map_types[LogicalTypeId::UINTEGER]);
-                fun.bind = DSKLLBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3931,7 +7361,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSKLLCreateAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]);
-                fun.bind = DSKLLBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -3939,13 +7369,134 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSKLLCreateAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]));
             {
                 auto fun = DSKLLMergeAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]);
-                fun.bind = DSKLLBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
             }
             //sketch.AddFunction(DSKLLMergeAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]));
         
+        
+            {
+                auto fun = DSKLLCreateAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLCreateAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]));
+            {
+                auto fun = DSKLLMergeAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLMergeAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]));
+        
+        
+            {
+                auto fun = DSKLLCreateAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLCreateAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]));
+            {
+                auto fun = DSKLLMergeAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLMergeAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]));
+        
+        
+            {
+                auto fun = DSKLLCreateAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLCreateAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]));
+            {
+                auto fun = DSKLLMergeAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLMergeAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]));
+        
+        
+            {
+                auto fun = DSKLLCreateAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLCreateAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]));
+            {
+                auto fun = DSKLLMergeAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLMergeAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]));
+        
+        
+            {
+                auto fun = DSKLLCreateAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLCreateAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]));
+            {
+                auto fun = DSKLLMergeAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLMergeAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]));
+        
+        
+            {
+                auto fun = DSKLLCreateAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]);
+                
+                // Any DECIMAL binds here, see DSDecimalItemFits.
+                fun.bind = DSTrackedBind<DSKLLBindDecimal>;
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLCreateAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]));
+            {
+                auto fun = DSKLLMergeAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLMergeAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]));
+        
+        
+            {
+                auto fun = DSKLLCreateAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLCreateAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]));
+            {
+                auto fun = DSKLLMergeAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSKLLMergeAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]));
+        
       CreateAggregateFunctionInfo sketch_info(sketch);
 
 
@@ -3953,6 +7504,7 @@ return sketch.get_max_item();
         FunctionDescription desc;
         desc.description = "Creates a sketch_kll data sketch by aggregating values or by aggregating other KLL data sketches";
         desc.examples.push_back("datasketch_kll(k, data)");
+        
         sketch_info.descriptions.push_back(desc);
     }
 
@@ -3989,7 +7541,7 @@ static inline void DSREQis_empty(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
                 }
@@ -4023,7 +7575,7 @@ static inline void DSREQk(DataChunk &args, ExpressionState &state, Vector &resul
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
                 }
@@ -4038,69 +7590,169 @@ return sketch.get_k();
 
 template <class T>
 
-static inline void DSREQcdf(DataChunk &args, ExpressionState &state, Vector &result)
+static inline void DSREQcdf(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sketch_vector = args.data[0];
+        auto &split_points_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+                    auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
+                    UnifiedVectorFormat split_points_children_unified;
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
+                    const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
+
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
+                    
+        TernaryExecutor::Execute
+        <string_t,list_entry_t,bool,list_entry_t>
+        (
+        sketch_vector,split_points_vector,inclusive_vector,result,args.size(),
+        [&](string_t sketch_data,list_entry_t split_points_data,bool inclusive_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
+                }
+            }();
+
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
+                    {
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
+                    {
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
+                    }
+                    
+auto cdf_result = sketch.get_CDF(split_points_ptr, split_points_data.length, inclusive_data);
+                auto current_size = ListVector::GetListSize(result);
+                auto new_size = current_size + cdf_result.size();
+                if (ListVector::GetListCapacity(result) < new_size)
+                {
+                    ListVector::Reserve(result, new_size);
+                }
+
+                auto &child_entry = ListVector::GetEntry(result);
+                auto child_vals = FlatVector::GetData<double>(child_entry);
+                //auto &child_validity = FlatVector::Validity(child_entry);
+                for (idx_t i = 0; i < cdf_result.size(); i++)
+                {
+                    child_vals[current_size + i] = cdf_result[i];
+                }
+                ListVector::SetListSize(result, new_size);
+                return list_entry_t{current_size, cdf_result.size()};
+                
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSREQcdf_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
 {
     // Get the references to the incoming vectors.
     D_ASSERT(args.ColumnCount() == 3);
 
     
-        auto &sketch_vector = args.data[0];
+        auto &sorted_view_vector = args.data[0];
         auto &split_points_vector = args.data[1];
         auto &inclusive_vector = args.data[2];
 
     
         
-                    UnifiedVectorFormat unified_split_points;
-                    split_points_vector.ToUnifiedFormat(args.size(), unified_split_points);
-
-                    // auto split_points_list_entries = UnifiedVectorFormat::GetData<list_entry_t>(unified_split_points);
-                    //         auto split_points_validitiy = FlatVector::Validity(split_points_vector);
-
                     auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
-
                     UnifiedVectorFormat split_points_children_unified;
-                    split_points_list_children.ToUnifiedFormat(args.size(), split_points_children_unified);
-
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
                     const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
+
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
                     
         TernaryExecutor::Execute
         <string_t,list_entry_t,bool,list_entry_t>
         (
-        sketch_vector,split_points_vector,inclusive_vector,result,args.size(),
-        [&](string_t sketch_data,list_entry_t split_points_data,bool inclusive_data) {
+        sorted_view_vector,split_points_vector,inclusive_vector,result,args.size(),
+        [&](string_t sorted_view_data,list_entry_t split_points_data,bool inclusive_data) {
 
-            
-            auto sketch = [&]() {
-                try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
-                } catch (const std::exception &e) {
-                    throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
-                }
-            }();
+            DSSortedView<T> sorted_view(sorted_view_data);
 
-                    std::vector<T> passing_points(split_points_data.length);
-                    for (idx_t i = 0; i < split_points_data.length; i++)
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
+                    {
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
                     {
-                        passing_points[i] = split_points_list_children_data[i + split_points_data.offset];
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
                     }
                     
-auto cdf_result = sketch.get_CDF(passing_points.data(), split_points_data.length, inclusive_data);
+
                 auto current_size = ListVector::GetListSize(result);
-                auto new_size = current_size + cdf_result.size();
+                auto new_size = current_size + split_points_data.length + 1;
                 if (ListVector::GetListCapacity(result) < new_size)
                 {
                     ListVector::Reserve(result, new_size);
                 }
 
                 auto &child_entry = ListVector::GetEntry(result);
-                auto child_vals = FlatVector::GetData<T>(child_entry);
-                //auto &child_validity = FlatVector::Validity(child_entry);
-                for (idx_t i = 0; i < cdf_result.size(); i++)
-                {
-                    child_vals[current_size + i] = cdf_result[i];
-                }
+                auto child_vals = FlatVector::GetData<double>(child_entry);
+                sorted_view.GetCDF(split_points_ptr, split_points_data.length, inclusive_data, child_vals + current_size);
                 ListVector::SetListSize(result, new_size);
-                return list_entry_t{current_size, cdf_result.size()};
+                return list_entry_t{current_size, split_points_data.length + 1};
                 
         });
 
@@ -4123,18 +7775,21 @@ static inline void DSREQpmf(DataChunk &args, ExpressionState &state, Vector &res
 
     
         
-                    UnifiedVectorFormat unified_split_points;
-                    split_points_vector.ToUnifiedFormat(args.size(), unified_split_points);
-
-                    // auto split_points_list_entries = UnifiedVectorFormat::GetData<list_entry_t>(unified_split_points);
-                    //         auto split_points_validitiy = FlatVector::Validity(split_points_vector);
-
                     auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
-
                     UnifiedVectorFormat split_points_children_unified;
-                    split_points_list_children.ToUnifiedFormat(args.size(), split_points_children_unified);
-
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
                     const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
+
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
                     
         TernaryExecutor::Execute
         <string_t,list_entry_t,bool,list_entry_t>
@@ -4145,19 +7800,35 @@ static inline void DSREQpmf(DataChunk &args, ExpressionState &state, Vector &res
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
                 }
             }();
 
-                    std::vector<T> passing_points(split_points_data.length);
-                    for (idx_t i = 0; i < split_points_data.length; i++)
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
                     {
-                        passing_points[i] = split_points_list_children_data[i + split_points_data.offset];
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
+                    {
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
                     }
                     
-auto pmf_result = sketch.get_PMF(passing_points.data(), split_points_data.length, inclusive_data);
+auto pmf_result = sketch.get_PMF(split_points_ptr, split_points_data.length, inclusive_data);
                 auto current_size = ListVector::GetListSize(result);
                 auto new_size = current_size + pmf_result.size();
                 if (ListVector::GetListCapacity(result) < new_size)
@@ -4205,7 +7876,7 @@ static inline void DSREQdescribe(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
                 }
@@ -4241,12 +7912,41 @@ static inline void DSREQrank(DataChunk &args, ExpressionState &state, Vector &re
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
                 }
             }();
-return sketch.get_rank(item_data, inclusive_data);
+return sketch.get_rank(DSQuantileItem<T>::FromDuckDB(item_data), inclusive_data);
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSREQrank_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sorted_view_vector = args.data[0];
+        auto &item_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+        TernaryExecutor::Execute
+        <string_t,T,bool,double>
+        (
+        sorted_view_vector,item_vector,inclusive_vector,result,args.size(),
+        [&](string_t sorted_view_data,T item_data,bool inclusive_data) {
+
+            DSSortedView<T> sorted_view(sorted_view_data);
+return sorted_view.GetRank(item_data, inclusive_data);
         });
 
 }
@@ -4277,12 +7977,183 @@ static inline void DSREQquantile(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
+                }
+            }();
+return DSQuantileItem<T>::ToDuckDB(result, sketch.get_quantile(rank_data, inclusive_data));
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSREQquantile_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sorted_view_vector = args.data[0];
+        auto &rank_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+        TernaryExecutor::Execute
+        <string_t,double,bool,T>
+        (
+        sorted_view_vector,rank_vector,inclusive_vector,result,args.size(),
+        [&](string_t sorted_view_data,double rank_data,bool inclusive_data) {
+
+            DSSortedView<T> sorted_view(sorted_view_data);
+return sorted_view.GetQuantile(rank_data, inclusive_data);
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSREQquantiles(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sketch_vector = args.data[0];
+        auto &ranks_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+                    auto &ranks_list_children = ListVector::GetEntry(ranks_vector);
+                    UnifiedVectorFormat ranks_children_unified;
+                    ranks_list_children.ToUnifiedFormat(ListVector::GetListSize(ranks_vector), ranks_children_unified);
+                    const double *ranks_list_children_data = UnifiedVectorFormat::GetData<double>(ranks_children_unified);
+                    
+        TernaryExecutor::Execute
+        <string_t,list_entry_t,bool,list_entry_t>
+        (
+        sketch_vector,ranks_vector,inclusive_vector,result,args.size(),
+        [&](string_t sketch_data,list_entry_t ranks_data,bool inclusive_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
+                }
+            }();
+
+                if (sketch.is_empty())
+                {
+                    throw InvalidInputException("Cannot query an empty REQ sketch");
+                }
+                auto sorted_view = sketch.get_sorted_view();
+
+                auto current_size = ListVector::GetListSize(result);
+                auto new_size = current_size + ranks_data.length;
+                if (ListVector::GetListCapacity(result) < new_size)
+                {
+                    ListVector::Reserve(result, new_size);
+                }
+
+                auto &child_entry = ListVector::GetEntry(result);
+                auto child_vals = FlatVector::GetData<T>(child_entry);
+                for (idx_t i = 0; i < ranks_data.length; i++)
+                {
+                    auto point_idx = ranks_children_unified.sel->get_index(ranks_data.offset + i);
+                    if (!ranks_children_unified.validity.RowIsValid(point_idx))
+                    {
+                        throw InvalidInputException("ranks cannot contain NULL values");
+                    }
+                    const auto &point = ranks_list_children_data[point_idx];
+                    if (!(point >= 0.0 && point <= 1.0))
+                    {
+                        throw InvalidInputException("Normalized rank must be between 0 and 1, got: %f", point);
+                    }
+                    child_vals[current_size + i] = DSQuantileItem<T>::ToDuckDB(child_entry, sorted_view.get_quantile(point, inclusive_data));
+                }
+                ListVector::SetListSize(result, new_size);
+                return list_entry_t{current_size, ranks_data.length};
+                
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSREQranks(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sketch_vector = args.data[0];
+        auto &items_vector = args.data[1];
+        auto &inclusive_vector = args.data[2];
+
+    
+        
+                    auto &items_list_children = ListVector::GetEntry(items_vector);
+                    UnifiedVectorFormat items_children_unified;
+                    items_list_children.ToUnifiedFormat(ListVector::GetListSize(items_vector), items_children_unified);
+                    const T *items_list_children_data = UnifiedVectorFormat::GetData<T>(items_children_unified);
+                    
+        TernaryExecutor::Execute
+        <string_t,list_entry_t,bool,list_entry_t>
+        (
+        sketch_vector,items_vector,inclusive_vector,result,args.size(),
+        [&](string_t sketch_data,list_entry_t items_data,bool inclusive_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
                 }
             }();
-return sketch.get_quantile(rank_data, inclusive_data);
+
+                if (sketch.is_empty())
+                {
+                    throw InvalidInputException("Cannot query an empty REQ sketch");
+                }
+                auto sorted_view = sketch.get_sorted_view();
+
+                auto current_size = ListVector::GetListSize(result);
+                auto new_size = current_size + items_data.length;
+                if (ListVector::GetListCapacity(result) < new_size)
+                {
+                    ListVector::Reserve(result, new_size);
+                }
+
+                auto &child_entry = ListVector::GetEntry(result);
+                auto child_vals = FlatVector::GetData<double>(child_entry);
+                for (idx_t i = 0; i < items_data.length; i++)
+                {
+                    auto point_idx = items_children_unified.sel->get_index(items_data.offset + i);
+                    if (!items_children_unified.validity.RowIsValid(point_idx))
+                    {
+                        throw InvalidInputException("items cannot contain NULL values");
+                    }
+                    const auto &point = items_list_children_data[point_idx];
+                    child_vals[current_size + i] = sorted_view.get_rank(DSQuantileItem<T>::FromDuckDB(point), inclusive_data);
+                }
+                ListVector::SetListSize(result, new_size);
+                return list_entry_t{current_size, items_data.length};
+                
         });
 
 }
@@ -4311,7 +8182,7 @@ static inline void DSREQn(DataChunk &args, ExpressionState &state, Vector &resul
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
                 }
@@ -4345,7 +8216,7 @@ static inline void DSREQis_estimation_mode(DataChunk &args, ExpressionState &sta
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
                 }
@@ -4379,7 +8250,7 @@ static inline void DSREQnum_retained(DataChunk &args, ExpressionState &state, Ve
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
                 }
@@ -4413,12 +8284,12 @@ static inline void DSREQmin_item(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
                 }
             }();
-return sketch.get_min_item();
+return DSQuantileItem<T>::ToDuckDB(result, sketch.get_min_item());
         });
 
 }
@@ -4447,12 +8318,46 @@ static inline void DSREQmax_item(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::req_sketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
+                }
+            }();
+return DSQuantileItem<T>::ToDuckDB(result, sketch.get_max_item());
+        });
+
+}
+
+    
+
+
+template <class T>
+
+static inline void DSREQto_sorted_view(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 1);
+
+    
+        auto &sketch_vector = args.data[0];
+
+    
+        
+        UnaryExecutor::Execute
+        <string_t,string_t>
+        (
+        sketch_vector,result,args.size(),
+        [&](string_t sketch_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
                 }
             }();
-return sketch.get_max_item();
+return DSSortedView<T>::Serialize(result, sketch);
         });
 
 }
@@ -4460,14 +8365,83 @@ return sketch.get_max_item();
     
 
 
+template <class T>
+
+static inline void DSREQsummary(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 1);
+
+    
+        auto &sketch_vector = args.data[0];
+
+    
+        UnifiedVectorFormat sketch_unified;
+        sketch_vector.ToUnifiedFormat(args.size(), sketch_unified);
+        auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_unified);
+        auto &struct_entries = StructVector::GetEntries(result);
+
+        for (idx_t row = 0; row < args.size(); row++)
+        {
+            auto sketch_idx = sketch_unified.sel->get_index(row);
+            if (!sketch_unified.validity.RowIsValid(sketch_idx))
+            {
+                FlatVector::SetNull(result, row, true);
+                continue;
+            }
+            auto sketch_data = sketch_entries[sketch_idx];
+            
+            auto sketch = [&]() {
+                try {
+                    return DSREQSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize REQ sketch: %s", e.what());
+                }
+            }();
+            
+            FlatVector::GetData<uint16_t>(*struct_entries[0])[row] = sketch.get_k();
+            FlatVector::GetData<uint64_t>(*struct_entries[1])[row] = sketch.get_n();
+            FlatVector::GetData<bool>(*struct_entries[2])[row] = sketch.is_empty();
+            FlatVector::GetData<bool>(*struct_entries[3])[row] = sketch.is_estimation_mode();
+            FlatVector::GetData<uint64_t>(*struct_entries[4])[row] = sketch.get_num_retained();
+            if (sketch.is_empty())
+            {
+                FlatVector::SetNull(*struct_entries[5], row, true);
+            }
+            else
+            {
+                FlatVector::GetData<T>(*struct_entries[5])[row] = DSQuantileItem<T>::ToDuckDB(*struct_entries[5], sketch.get_min_item());
+            }
+            if (sketch.is_empty())
+            {
+                FlatVector::SetNull(*struct_entries[6], row, true);
+            }
+            else
+            {
+                FlatVector::GetData<T>(*struct_entries[6])[row] = DSQuantileItem<T>::ToDuckDB(*struct_entries[6], sketch.get_max_item());
+            }
+        }
+
+        if (args.AllConstant())
+        {
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        }
+
+}
+
+    
+
+
     
     template <typename T>
     auto static DSREQMergeAggregate(const LogicalType &type, const LogicalType &result_type) -> AggregateFunction
     
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSREQState<T>, string_t, string_t, DSQuantilesMergeOperation<DSREQBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSREQState<T>, string_t, string_t, DSQuantilesMergeOperation<DSREQBindData>, AggregateDestructorType::LEGACY>(
             result_type, result_type);
+        fun.bind = DSTrackedBind<DSREQBind<DSREQState<T>, string_t, DSQuantilesMergeOperation<DSREQBindData>>>;
+        return fun;
         
     }
 
@@ -4477,11 +8451,30 @@ return sketch.get_max_item();
     auto static DSREQCreateAggregate(const LogicalType &type, const LogicalType &result_type) -> AggregateFunction
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSREQState<T>, T, string_t, DSQuantilesCreateOperation<DSREQBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSREQState<T>, T, string_t, DSQuantilesCreateOperation<DSREQBindData>, AggregateDestructorType::LEGACY>(
             type, result_type);
+        fun.bind = DSTrackedBind<DSREQBind<DSREQState<T>, T, DSQuantilesCreateOperation<DSREQBindData>>>;
+        return fun;
         
     }
 
+    
+    static unique_ptr<FunctionData> DSREQBindDecimal(ClientContext &context, AggregateFunction &function,
+                                                        vector<unique_ptr<Expression>> &arguments)
+    {
+        if (DSDecimalItemFits(arguments[1]->return_type)) {
+            return DSREQBind<DSREQState<hugeint_t>, hugeint_t, DSQuantilesCreateOperation<DSREQBindData>>(context, function, arguments);
+        }
+        auto name = function.name;
+        auto k_type = function.arguments[0];
+        function = DSREQCreateAggregate<double>(LogicalType::DOUBLE, DSSketchAliasType("sketch_req_", LogicalType::DOUBLE));
+        function.name = name;
+        function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+        function.arguments.insert(function.arguments.begin(), k_type);
+        return function.bind(context, function, arguments);
+    }
+    
+
 
   void LoadREQSketch(ExtensionLoader &loader) {
 
@@ -4489,16 +8482,44 @@ return sketch.get_max_item();
       
         std::unordered_map<LogicalTypeId, LogicalType> sketch_map_types;
         
-            sketch_map_types.insert({ LogicalTypeId::TINYINT, CreateREQSketchType(loader, LogicalType(LogicalTypeId::TINYINT))});
-            sketch_map_types.insert({ LogicalTypeId::SMALLINT, CreateREQSketchType(loader, LogicalType(LogicalTypeId::SMALLINT))});
-            sketch_map_types.insert({ LogicalTypeId::INTEGER, CreateREQSketchType(loader, LogicalType(LogicalTypeId::INTEGER))});
-            sketch_map_types.insert({ LogicalTypeId::BIGINT, CreateREQSketchType(loader, LogicalType(LogicalTypeId::BIGINT))});
-            sketch_map_types.insert({ LogicalTypeId::FLOAT, CreateREQSketchType(loader, LogicalType(LogicalTypeId::FLOAT))});
-            sketch_map_types.insert({ LogicalTypeId::DOUBLE, CreateREQSketchType(loader, LogicalType(LogicalTypeId::DOUBLE))});
-            sketch_map_types.insert({ LogicalTypeId::UTINYINT, CreateREQSketchType(loader, LogicalType(LogicalTypeId::UTINYINT))});
-            sketch_map_types.insert({ LogicalTypeId::USMALLINT, CreateREQSketchType(loader, LogicalType(LogicalTypeId::USMALLINT))});
-            sketch_map_types.insert({ LogicalTypeId::UINTEGER, CreateREQSketchType(loader, LogicalType(LogicalTypeId::UINTEGER))});
-            sketch_map_types.insert({ LogicalTypeId::UBIGINT, CreateREQSketchType(loader, LogicalType(LogicalTypeId::UBIGINT))});
+            sketch_map_types.insert({ LogicalTypeId::TINYINT, CreateREQSketchType(loader, LogicalType::TINYINT)});
+            sketch_map_types.insert({ LogicalTypeId::SMALLINT, CreateREQSketchType(loader, LogicalType::SMALLINT)});
+            sketch_map_types.insert({ LogicalTypeId::INTEGER, CreateREQSketchType(loader, LogicalType::INTEGER)});
+            sketch_map_types.insert({ LogicalTypeId::BIGINT, CreateREQSketchType(loader, LogicalType::BIGINT)});
+            sketch_map_types.insert({ LogicalTypeId::FLOAT, CreateREQSketchType(loader, LogicalType::FLOAT)});
+            sketch_map_types.insert({ LogicalTypeId::DOUBLE, CreateREQSketchType(loader, LogicalType::DOUBLE)});
+            sketch_map_types.insert({ LogicalTypeId::UTINYINT, CreateREQSketchType(loader, LogicalType::UTINYINT)});
+            sketch_map_types.insert({ LogicalTypeId::USMALLINT, CreateREQSketchType(loader, LogicalType::USMALLINT)});
+            sketch_map_types.insert({ LogicalTypeId::UINTEGER, CreateREQSketchType(loader, LogicalType::UINTEGER)});
+            sketch_map_types.insert({ LogicalTypeId::UBIGINT, CreateREQSketchType(loader, LogicalType::UBIGINT)});
+            sketch_map_types.insert({ LogicalTypeId::DATE, CreateREQSketchType(loader, LogicalType::DATE)});
+            sketch_map_types.insert({ LogicalTypeId::TIME, CreateREQSketchType(loader, LogicalType::TIME)});
+            sketch_map_types.insert({ LogicalTypeId::TIMESTAMP, CreateREQSketchType(loader, LogicalType::TIMESTAMP)});
+            sketch_map_types.insert({ LogicalTypeId::TIMESTAMP_TZ, CreateREQSketchType(loader, LogicalType::TIMESTAMP_TZ)});
+            sketch_map_types.insert({ LogicalTypeId::HUGEINT, CreateREQSketchType(loader, LogicalType::HUGEINT)});
+            sketch_map_types.insert({ LogicalTypeId::DECIMAL, CreateREQSketchType(loader, LogicalType::DECIMAL(38, 18))});
+            sketch_map_types.insert({ LogicalTypeId::VARCHAR, CreateREQSketchType(loader, LogicalType::VARCHAR)});
+      
+
+      
+        std::unordered_map<LogicalTypeId, LogicalType> sorted_view_map_types;
+        
+            sorted_view_map_types.insert({ LogicalTypeId::TINYINT, CreateREQSortedViewType(loader, LogicalType::TINYINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::SMALLINT, CreateREQSortedViewType(loader, LogicalType::SMALLINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::INTEGER, CreateREQSortedViewType(loader, LogicalType::INTEGER)});
+            sorted_view_map_types.insert({ LogicalTypeId::BIGINT, CreateREQSortedViewType(loader, LogicalType::BIGINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::FLOAT, CreateREQSortedViewType(loader, LogicalType::FLOAT)});
+            sorted_view_map_types.insert({ LogicalTypeId::DOUBLE, CreateREQSortedViewType(loader, LogicalType::DOUBLE)});
+            sorted_view_map_types.insert({ LogicalTypeId::UTINYINT, CreateREQSortedViewType(loader, LogicalType::UTINYINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::USMALLINT, CreateREQSortedViewType(loader, LogicalType::USMALLINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::UINTEGER, CreateREQSortedViewType(loader, LogicalType::UINTEGER)});
+            sorted_view_map_types.insert({ LogicalTypeId::UBIGINT, CreateREQSortedViewType(loader, LogicalType::UBIGINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::DATE, CreateREQSortedViewType(loader, LogicalType::DATE)});
+            sorted_view_map_types.insert({ LogicalTypeId::TIME, CreateREQSortedViewType(loader, LogicalType::TIME)});
+            sorted_view_map_types.insert({ LogicalTypeId::TIMESTAMP, CreateREQSortedViewType(loader, LogicalType::TIMESTAMP)});
+            sorted_view_map_types.insert({ LogicalTypeId::TIMESTAMP_TZ, CreateREQSortedViewType(loader, LogicalType::TIMESTAMP_TZ)});
+            sorted_view_map_types.insert({ LogicalTypeId::HUGEINT, CreateREQSortedViewType(loader, LogicalType::HUGEINT)});
+            sorted_view_map_types.insert({ LogicalTypeId::DECIMAL, CreateREQSortedViewType(loader, LogicalType::DECIMAL(38, 18))});
       
 
       
@@ -4506,36 +8527,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_req_is_empty");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::BOOLEAN
-                ,    DSREQis_empty<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_empty<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::BOOLEAN
-                ,    DSREQis_empty<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_empty<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::BOOLEAN
-                ,    DSREQis_empty<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_empty<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BOOLEAN
-                ,    DSREQis_empty<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::BOOLEAN
-                ,    DSREQis_empty<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_empty<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::BOOLEAN
-                ,    DSREQis_empty<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_empty<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::BOOLEAN
-                ,    DSREQis_empty<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_empty<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::BOOLEAN
-                ,    DSREQis_empty<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_empty<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::BOOLEAN
-                ,    DSREQis_empty<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_empty<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::BOOLEAN
-                ,    DSREQis_empty<uint64_t>));
+                ,    DSREQis_empty<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::BOOLEAN
+                ,    DSREQis_empty<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::BOOLEAN
+                ,    DSREQis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::BOOLEAN
+                ,    DSREQis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::BOOLEAN
+                ,    DSREQis_empty<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::BOOLEAN
+                ,    DSREQis_empty<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::BOOLEAN
+                ,    DSREQis_empty<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::BOOLEAN
+                ,    DSREQis_empty<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -4555,36 +8598,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_req_k");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::USMALLINT
-                ,    DSREQk<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQk<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::USMALLINT
-                ,    DSREQk<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQk<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::USMALLINT
-                ,    DSREQk<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQk<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::USMALLINT
-                ,    DSREQk<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::USMALLINT
-                ,    DSREQk<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQk<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::USMALLINT
-                ,    DSREQk<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQk<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::USMALLINT
-                ,    DSREQk<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQk<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::USMALLINT
-                ,    DSREQk<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQk<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::USMALLINT
-                ,    DSREQk<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQk<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::USMALLINT
-                ,    DSREQk<uint64_t>));
+                ,    DSREQk<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::USMALLINT
+                ,    DSREQk<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::USMALLINT
+                ,    DSREQk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::USMALLINT
+                ,    DSREQk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::USMALLINT
+                ,    DSREQk<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::USMALLINT
+                ,    DSREQk<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::USMALLINT
+                ,    DSREQk<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::USMALLINT
+                ,    DSREQk<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -4604,36 +8669,107 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_req_cdf");
         
             
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TINYINT)
-                ,    DSREQcdf<int8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::SMALLINT)
-                ,    DSREQcdf<int16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::INTEGER)
-                ,    DSREQcdf<int32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::BIGINT)
-                ,    DSREQcdf<int64_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::FLOAT)
-                ,    DSREQcdf<float>));
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
-                ,    DSREQcdf<double>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UTINYINT)
-                ,    DSREQcdf<uint8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::USMALLINT)
-                ,    DSREQcdf<uint16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UINTEGER)
-                ,    DSREQcdf<uint32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UBIGINT)
-                ,    DSREQcdf<uint64_t>));
+                ,    DSREQcdf<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::VARCHAR),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf<string_t>), DSUnitIntervalListStatistics));
+            
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQcdf_sorted_view<hugeint_t>), DSUnitIntervalListStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -4653,36 +8789,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_req_pmf");
         
             
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TINYINT)
-                ,    DSREQpmf<int8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::SMALLINT)
-                ,    DSREQpmf<int16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::INTEGER)
-                ,    DSREQpmf<int32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::BIGINT)
-                ,    DSREQpmf<int64_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::FLOAT)
-                ,    DSREQpmf<float>));
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
-                ,    DSREQpmf<double>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UTINYINT)
-                ,    DSREQpmf<uint8_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::USMALLINT)
-                ,    DSREQpmf<uint16_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UINTEGER)
-                ,    DSREQpmf<uint32_t>));
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UBIGINT)
-                ,    DSREQpmf<uint64_t>));
+                ,    DSREQpmf<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::VARCHAR),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQpmf<string_t>), DSUnitIntervalListStatistics));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -4702,36 +8860,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_req_describe");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSREQdescribe<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQdescribe<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSREQdescribe<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQdescribe<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSREQdescribe<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQdescribe<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSREQdescribe<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSREQdescribe<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQdescribe<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSREQdescribe<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQdescribe<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSREQdescribe<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQdescribe<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSREQdescribe<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQdescribe<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSREQdescribe<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQdescribe<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSREQdescribe<uint64_t>));
+                ,    DSREQdescribe<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSREQdescribe<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSREQdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSREQdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSREQdescribe<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSREQdescribe<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSREQdescribe<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSREQdescribe<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -4751,36 +8931,107 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_req_rank");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::TINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSREQrank<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQrank<int8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::SMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSREQrank<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQrank<int16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::INTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSREQrank<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQrank<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::BIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSREQrank<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::FLOAT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSREQrank<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQrank<float>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSREQrank<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQrank<double>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::UTINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSREQrank<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQrank<uint8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::USMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSREQrank<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQrank<uint16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::UINTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSREQrank<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQrank<uint32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::UBIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSREQrank<uint64_t>));
+                ,    DSREQrank<uint64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::DATE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::TIME,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::TIMESTAMP,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::TIMESTAMP_TZ,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::HUGEINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank<hugeint_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::DECIMAL(38, 18),LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank<hugeint_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::VARCHAR,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank<string_t>), DSUnitIntervalStatistics));
+            
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TINYINT],LogicalType::TINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<int8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::SMALLINT],LogicalType::SMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<int16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::INTEGER],LogicalType::INTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::BIGINT],LogicalType::BIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::FLOAT],LogicalType::FLOAT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<float>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<double>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UTINYINT],LogicalType::UTINYINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<uint8_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::USMALLINT],LogicalType::USMALLINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<uint16_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UINTEGER],LogicalType::UINTEGER,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<uint32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UBIGINT],LogicalType::UBIGINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<uint64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DATE],LogicalType::DATE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<int32_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIME],LogicalType::TIME,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP],LogicalType::TIMESTAMP,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::TIMESTAMP_TZ,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<int64_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::HUGEINT],LogicalType::HUGEINT,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<hugeint_t>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DECIMAL],LogicalType::DECIMAL(38, 18),LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQrank_sorted_view<hugeint_t>), DSUnitIntervalStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -4800,36 +9051,107 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_req_quantile");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TINYINT
-                ,    DSREQquantile<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQquantile<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::SMALLINT
-                ,    DSREQquantile<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQquantile<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::INTEGER
-                ,    DSREQquantile<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQquantile<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::BIGINT
-                ,    DSREQquantile<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::FLOAT
-                ,    DSREQquantile<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQquantile<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
-                ,    DSREQquantile<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQquantile<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UTINYINT
-                ,    DSREQquantile<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQquantile<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::USMALLINT
-                ,    DSREQquantile<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQquantile<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UINTEGER
-                ,    DSREQquantile<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQquantile<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UBIGINT
-                ,    DSREQquantile<uint64_t>));
+                ,    DSREQquantile<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DATE
+                ,    DSREQquantile<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIME
+                ,    DSREQquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP
+                ,    DSREQquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP_TZ
+                ,    DSREQquantile<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::HUGEINT
+                ,    DSREQquantile<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DECIMAL(38, 18)
+                ,    DSREQquantile<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::VARCHAR
+                ,    DSREQquantile<string_t>), nullptr));
+            
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TINYINT
+                ,    DSREQquantile_sorted_view<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::SMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::SMALLINT
+                ,    DSREQquantile_sorted_view<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::INTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::INTEGER
+                ,    DSREQquantile_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::BIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::BIGINT
+                ,    DSREQquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::FLOAT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::FLOAT
+                ,    DSREQquantile_sorted_view<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DOUBLE
+                ,    DSREQquantile_sorted_view<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UTINYINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UTINYINT
+                ,    DSREQquantile_sorted_view<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::USMALLINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::USMALLINT
+                ,    DSREQquantile_sorted_view<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UINTEGER],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UINTEGER
+                ,    DSREQquantile_sorted_view<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::UBIGINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::UBIGINT
+                ,    DSREQquantile_sorted_view<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DATE],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DATE
+                ,    DSREQquantile_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIME],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIME
+                ,    DSREQquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP
+                ,    DSREQquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::TIMESTAMP_TZ
+                ,    DSREQquantile_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::HUGEINT],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::HUGEINT
+                ,    DSREQquantile_sorted_view<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sorted_view_map_types[LogicalTypeId::DECIMAL],LogicalType::DOUBLE,LogicalType::BOOLEAN},LogicalType::DECIMAL(38, 18)
+                ,    DSREQquantile_sorted_view<hugeint_t>), nullptr));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -4844,41 +9166,205 @@ return sketch.get_max_item();
         loader.RegisterFunction(info);
 
 
+      }
+      {
+        ScalarFunctionSet fs("datasketch_req_quantiles");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TINYINT)
+                ,    DSREQquantiles<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::SMALLINT)
+                ,    DSREQquantiles<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::INTEGER)
+                ,    DSREQquantiles<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::BIGINT)
+                ,    DSREQquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::FLOAT)
+                ,    DSREQquantiles<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQquantiles<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UTINYINT)
+                ,    DSREQquantiles<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::USMALLINT)
+                ,    DSREQquantiles<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UINTEGER)
+                ,    DSREQquantiles<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::UBIGINT)
+                ,    DSREQquantiles<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DATE)
+                ,    DSREQquantiles<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TIME)
+                ,    DSREQquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TIMESTAMP)
+                ,    DSREQquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::TIMESTAMP_TZ)
+                ,    DSREQquantiles<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::HUGEINT)
+                ,    DSREQquantiles<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DECIMAL(38, 18))
+                ,    DSREQquantiles<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::VARCHAR)
+                ,    DSREQquantiles<string_t>), nullptr));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return the quantiles of a list of ranks in the sketch, computed from a single sorted view";
+            desc.examples.push_back("datasketch_req_quantiles(sketch, ranks, inclusive)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
+      }
+      {
+        ScalarFunctionSet fs("datasketch_req_ranks");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT],LogicalType::LIST(LogicalType::TINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<int8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT],LogicalType::LIST(LogicalType::SMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<int16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER],LogicalType::LIST(LogicalType::INTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT],LogicalType::LIST(LogicalType::BIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<double>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT],LogicalType::LIST(LogicalType::UTINYINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<uint8_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT],LogicalType::LIST(LogicalType::USMALLINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<uint16_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER],LogicalType::LIST(LogicalType::UINTEGER),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<uint32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT],LogicalType::LIST(LogicalType::UBIGINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<uint64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE],LogicalType::LIST(LogicalType::DATE),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<int32_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME],LogicalType::LIST(LogicalType::TIME),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP],LogicalType::LIST(LogicalType::TIMESTAMP),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ],LogicalType::LIST(LogicalType::TIMESTAMP_TZ),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<int64_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT],LogicalType::LIST(LogicalType::HUGEINT),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL],LogicalType::LIST(LogicalType::DECIMAL(38, 18)),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<hugeint_t>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR],LogicalType::LIST(LogicalType::VARCHAR),LogicalType::BOOLEAN},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSREQranks<string_t>), DSUnitIntervalListStatistics));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return the ranks of a list of items in the sketch, computed from a single sorted view";
+            desc.examples.push_back("datasketch_req_ranks(sketch, items, inclusive)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
       }
       {
         ScalarFunctionSet fs("datasketch_req_n");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::UBIGINT
-                ,    DSREQn<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQn<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::UBIGINT
-                ,    DSREQn<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQn<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::UBIGINT
-                ,    DSREQn<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQn<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::UBIGINT
-                ,    DSREQn<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::UBIGINT
-                ,    DSREQn<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQn<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::UBIGINT
-                ,    DSREQn<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQn<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UBIGINT
-                ,    DSREQn<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQn<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::UBIGINT
-                ,    DSREQn<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQn<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UBIGINT
-                ,    DSREQn<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQn<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSREQn<uint64_t>));
+                ,    DSREQn<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::UBIGINT
+                ,    DSREQn<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::UBIGINT
+                ,    DSREQn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::UBIGINT
+                ,    DSREQn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::UBIGINT
+                ,    DSREQn<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::UBIGINT
+                ,    DSREQn<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::UBIGINT
+                ,    DSREQn<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::UBIGINT
+                ,    DSREQn<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -4898,36 +9384,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_req_is_estimation_mode");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::BOOLEAN
-                ,    DSREQis_estimation_mode<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_estimation_mode<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::BOOLEAN
-                ,    DSREQis_estimation_mode<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_estimation_mode<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::BOOLEAN
-                ,    DSREQis_estimation_mode<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_estimation_mode<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BOOLEAN
-                ,    DSREQis_estimation_mode<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::BOOLEAN
-                ,    DSREQis_estimation_mode<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_estimation_mode<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::BOOLEAN
-                ,    DSREQis_estimation_mode<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_estimation_mode<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::BOOLEAN
-                ,    DSREQis_estimation_mode<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_estimation_mode<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::BOOLEAN
-                ,    DSREQis_estimation_mode<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_estimation_mode<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::BOOLEAN
-                ,    DSREQis_estimation_mode<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQis_estimation_mode<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::BOOLEAN
-                ,    DSREQis_estimation_mode<uint64_t>));
+                ,    DSREQis_estimation_mode<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::BOOLEAN
+                ,    DSREQis_estimation_mode<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::BOOLEAN
+                ,    DSREQis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::BOOLEAN
+                ,    DSREQis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::BOOLEAN
+                ,    DSREQis_estimation_mode<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::BOOLEAN
+                ,    DSREQis_estimation_mode<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::BOOLEAN
+                ,    DSREQis_estimation_mode<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::BOOLEAN
+                ,    DSREQis_estimation_mode<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -4947,36 +9455,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_req_num_retained");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::UBIGINT
-                ,    DSREQnum_retained<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQnum_retained<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::UBIGINT
-                ,    DSREQnum_retained<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQnum_retained<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::UBIGINT
-                ,    DSREQnum_retained<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQnum_retained<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::UBIGINT
-                ,    DSREQnum_retained<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::UBIGINT
-                ,    DSREQnum_retained<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQnum_retained<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::UBIGINT
-                ,    DSREQnum_retained<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQnum_retained<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UBIGINT
-                ,    DSREQnum_retained<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQnum_retained<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::UBIGINT
-                ,    DSREQnum_retained<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQnum_retained<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UBIGINT
-                ,    DSREQnum_retained<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQnum_retained<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSREQnum_retained<uint64_t>));
+                ,    DSREQnum_retained<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::UBIGINT
+                ,    DSREQnum_retained<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::UBIGINT
+                ,    DSREQnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::UBIGINT
+                ,    DSREQnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::UBIGINT
+                ,    DSREQnum_retained<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::UBIGINT
+                ,    DSREQnum_retained<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::UBIGINT
+                ,    DSREQnum_retained<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::UBIGINT
+                ,    DSREQnum_retained<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -4996,36 +9526,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_req_min_item");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::TINYINT
-                ,    DSREQmin_item<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmin_item<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::SMALLINT
-                ,    DSREQmin_item<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmin_item<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::INTEGER
-                ,    DSREQmin_item<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmin_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BIGINT
-                ,    DSREQmin_item<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::FLOAT
-                ,    DSREQmin_item<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmin_item<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::DOUBLE
-                ,    DSREQmin_item<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmin_item<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UTINYINT
-                ,    DSREQmin_item<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmin_item<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::USMALLINT
-                ,    DSREQmin_item<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmin_item<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UINTEGER
-                ,    DSREQmin_item<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmin_item<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSREQmin_item<uint64_t>));
+                ,    DSREQmin_item<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::DATE
+                ,    DSREQmin_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::TIME
+                ,    DSREQmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::TIMESTAMP
+                ,    DSREQmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::TIMESTAMP_TZ
+                ,    DSREQmin_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::HUGEINT
+                ,    DSREQmin_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::DECIMAL(38, 18)
+                ,    DSREQmin_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::VARCHAR
+                ,    DSREQmin_item<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -5045,36 +9597,58 @@ return sketch.get_max_item();
         ScalarFunctionSet fs("datasketch_req_max_item");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::TINYINT
-                ,    DSREQmax_item<int8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmax_item<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::SMALLINT
-                ,    DSREQmax_item<int16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmax_item<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::INTEGER
-                ,    DSREQmax_item<int32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmax_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::BIGINT
-                ,    DSREQmax_item<int64_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::FLOAT
-                ,    DSREQmax_item<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmax_item<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::DOUBLE
-                ,    DSREQmax_item<double>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmax_item<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::UTINYINT
-                ,    DSREQmax_item<uint8_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmax_item<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::USMALLINT
-                ,    DSREQmax_item<uint16_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmax_item<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::UINTEGER
-                ,    DSREQmax_item<uint32_t>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSREQmax_item<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::UBIGINT
-                ,    DSREQmax_item<uint64_t>));
+                ,    DSREQmax_item<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::DATE
+                ,    DSREQmax_item<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::TIME
+                ,    DSREQmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::TIMESTAMP
+                ,    DSREQmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::TIMESTAMP_TZ
+                ,    DSREQmax_item<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::HUGEINT
+                ,    DSREQmax_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::DECIMAL(38, 18)
+                ,    DSREQmax_item<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::VARCHAR
+                ,    DSREQmax_item<string_t>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -5089,6 +9663,145 @@ return sketch.get_max_item();
         loader.RegisterFunction(info);
 
 
+      }
+      {
+        ScalarFunctionSet fs("datasketch_req_to_sorted_view");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT]},sorted_view_map_types[LogicalTypeId::TINYINT]
+                ,    DSREQto_sorted_view<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT]},sorted_view_map_types[LogicalTypeId::SMALLINT]
+                ,    DSREQto_sorted_view<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER]},sorted_view_map_types[LogicalTypeId::INTEGER]
+                ,    DSREQto_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT]},sorted_view_map_types[LogicalTypeId::BIGINT]
+                ,    DSREQto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT]},sorted_view_map_types[LogicalTypeId::FLOAT]
+                ,    DSREQto_sorted_view<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE]},sorted_view_map_types[LogicalTypeId::DOUBLE]
+                ,    DSREQto_sorted_view<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT]},sorted_view_map_types[LogicalTypeId::UTINYINT]
+                ,    DSREQto_sorted_view<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT]},sorted_view_map_types[LogicalTypeId::USMALLINT]
+                ,    DSREQto_sorted_view<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER]},sorted_view_map_types[LogicalTypeId::UINTEGER]
+                ,    DSREQto_sorted_view<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT]},sorted_view_map_types[LogicalTypeId::UBIGINT]
+                ,    DSREQto_sorted_view<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},sorted_view_map_types[LogicalTypeId::DATE]
+                ,    DSREQto_sorted_view<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},sorted_view_map_types[LogicalTypeId::TIME]
+                ,    DSREQto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},sorted_view_map_types[LogicalTypeId::TIMESTAMP]
+                ,    DSREQto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},sorted_view_map_types[LogicalTypeId::TIMESTAMP_TZ]
+                ,    DSREQto_sorted_view<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},sorted_view_map_types[LogicalTypeId::HUGEINT]
+                ,    DSREQto_sorted_view<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},sorted_view_map_types[LogicalTypeId::DECIMAL]
+                ,    DSREQto_sorted_view<hugeint_t>), nullptr));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return a precomputed sorted view of the sketch that answers quantile, rank and cdf queries without deserializing";
+            desc.examples.push_back("datasketch_req_to_sorted_view(sketch)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
+      }
+      {
+        ScalarFunctionSet fs("datasketch_req_summary");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TINYINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TINYINT},{"max_item", LogicalType::TINYINT}})
+                ,    DSREQsummary<int8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::SMALLINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::SMALLINT},{"max_item", LogicalType::SMALLINT}})
+                ,    DSREQsummary<int16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::INTEGER]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::INTEGER},{"max_item", LogicalType::INTEGER}})
+                ,    DSREQsummary<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::BIGINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::BIGINT},{"max_item", LogicalType::BIGINT}})
+                ,    DSREQsummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::FLOAT},{"max_item", LogicalType::FLOAT}})
+                ,    DSREQsummary<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::DOUBLE},{"max_item", LogicalType::DOUBLE}})
+                ,    DSREQsummary<double>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UTINYINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::UTINYINT},{"max_item", LogicalType::UTINYINT}})
+                ,    DSREQsummary<uint8_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::USMALLINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::USMALLINT},{"max_item", LogicalType::USMALLINT}})
+                ,    DSREQsummary<uint16_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UINTEGER]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::UINTEGER},{"max_item", LogicalType::UINTEGER}})
+                ,    DSREQsummary<uint32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::UBIGINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::UBIGINT},{"max_item", LogicalType::UBIGINT}})
+                ,    DSREQsummary<uint64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DATE]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::DATE},{"max_item", LogicalType::DATE}})
+                ,    DSREQsummary<int32_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIME]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TIME},{"max_item", LogicalType::TIME}})
+                ,    DSREQsummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TIMESTAMP},{"max_item", LogicalType::TIMESTAMP}})
+                ,    DSREQsummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::TIMESTAMP_TZ},{"max_item", LogicalType::TIMESTAMP_TZ}})
+                ,    DSREQsummary<int64_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::HUGEINT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::HUGEINT},{"max_item", LogicalType::HUGEINT}})
+                ,    DSREQsummary<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DECIMAL]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::DECIMAL(38, 18)},{"max_item", LogicalType::DECIMAL(38, 18)}})
+                ,    DSREQsummary<hugeint_t>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::VARCHAR]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"n", LogicalType::UBIGINT},{"is_empty", LogicalType::BOOLEAN},{"is_estimation_mode", LogicalType::BOOLEAN},{"num_retained", LogicalType::UBIGINT},{"min_item", LogicalType::VARCHAR},{"max_item", LogicalType::VARCHAR}})
+                ,    DSREQsummary<string_t>), nullptr));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return a struct of the metadata and estimates of the sketch from a single deserialization";
+            desc.examples.push_back("datasketch_req_summary(sketch)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
       }
 
       // This funciton creates the sketches.
@@ -5098,7 +9811,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSREQCreateAggregate<int8_t>(LogicalType::TINYINT, sketch_map_types[LogicalTypeId::TINYINT]);
-                fun.bind = DSREQBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5106,7 +9819,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSREQCreateAggregate<int8_t>(LogicalType::TINYINT, sketch_map_types[LogicalTypeId::TINYINT]));
             {
                 auto fun = DSREQMergeAggregate<int8_t>(LogicalType::TINYINT, sketch_map_types[LogicalTypeId::TINYINT]);
-                fun.bind = DSREQBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5116,7 +9828,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSREQCreateAggregate<int16_t>(LogicalType::SMALLINT, sketch_map_types[LogicalTypeId::SMALLINT]);
-                fun.bind = DSREQBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5124,7 +9836,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSREQCreateAggregate<int16_t>(LogicalType::SMALLINT, sketch_map_types[LogicalTypeId::SMALLINT]));
             {
                 auto fun = DSREQMergeAggregate<int16_t>(LogicalType::SMALLINT, sketch_map_types[LogicalTypeId::SMALLINT]);
-                fun.bind = DSREQBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5134,7 +9845,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSREQCreateAggregate<int32_t>(LogicalType::INTEGER, sketch_map_types[LogicalTypeId::INTEGER]);
-                fun.bind = DSREQBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5142,7 +9853,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSREQCreateAggregate<int32_t>(LogicalType::INTEGER, sketch_map_types[LogicalTypeId::INTEGER]));
             {
                 auto fun = DSREQMergeAggregate<int32_t>(LogicalType::INTEGER, sketch_map_types[LogicalTypeId::INTEGER]);
-                fun.bind = DSREQBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5152,7 +9862,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSREQCreateAggregate<int64_t>(LogicalType::BIGINT, sketch_map_types[LogicalTypeId::BIGINT]);
-                fun.bind = DSREQBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5160,7 +9870,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSREQCreateAggregate<int64_t>(LogicalType::BIGINT, sketch_map_types[LogicalTypeId::BIGINT]));
             {
                 auto fun = DSREQMergeAggregate<int64_t>(LogicalType::BIGINT, sketch_map_types[LogicalTypeId::BIGINT]);
-                fun.bind = DSREQBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5170,7 +9879,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSREQCreateAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]);
-                fun.bind = DSREQBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5178,7 +9887,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSREQCreateAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]));
             {
                 auto fun = DSREQMergeAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]);
-                fun.bind = DSREQBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5188,7 +9896,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSREQCreateAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]);
-                fun.bind = DSREQBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5196,7 +9904,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSREQCreateAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]));
             {
                 auto fun = DSREQMergeAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]);
-                fun.bind = DSREQBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5206,7 +9913,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSREQCreateAggregate<uint8_t>(LogicalType::UTINYINT, sketch_map_types[LogicalTypeId::UTINYINT]);
-                fun.bind = DSREQBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5214,7 +9921,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSREQCreateAggregate<uint8_t>(LogicalType::UTINYINT, sketch_map_types[LogicalTypeId::UTINYINT]));
             {
                 auto fun = DSREQMergeAggregate<uint8_t>(LogicalType::UTINYINT, sketch_map_types[LogicalTypeId::UTINYINT]);
-                fun.bind = DSREQBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5224,7 +9930,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSREQCreateAggregate<uint16_t>(LogicalType::USMALLINT, sketch_map_types[LogicalTypeId::USMALLINT]);
-                fun.bind = DSREQBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5232,7 +9938,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSREQCreateAggregate<uint16_t>(LogicalType::USMALLINT, sketch_map_types[LogicalTypeId::USMALLINT]));
             {
                 auto fun = DSREQMergeAggregate<uint16_t>(LogicalType::USMALLINT, sketch_map_types[LogicalTypeId::USMALLINT]);
-                fun.bind = DSREQBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5242,7 +9947,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSREQCreateAggregate<uint32_t>(LogicalType::UINTEGER, sketch_map_types[LogicalTypeId::UINTEGER]);
-                fun.bind = DSREQBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5250,7 +9955,6 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSREQCreateAggregate<uint32_t>(LogicalType::UINTEGER, sketch_map_types[LogicalTypeId::UINTEGER]));
             {
                 auto fun = DSREQMergeAggregate<uint32_t>(LogicalType::UINTEGER, sketch_map_types[LogicalTypeId::UINTEGER]);
-                fun.bind = DSREQBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5260,7 +9964,7 @@ return sketch.get_max_item();
         
             {
                 auto fun = DSREQCreateAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]);
-                fun.bind = DSREQBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5268,13 +9972,134 @@ return sketch.get_max_item();
             //sketch.AddFunction(DSREQCreateAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]));
             {
                 auto fun = DSREQMergeAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]);
-                fun.bind = DSREQBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
             }
             //sketch.AddFunction(DSREQMergeAggregate<uint64_t>(LogicalType::UBIGINT, sketch_map_types[LogicalTypeId::UBIGINT]));
         
+        
+            {
+                auto fun = DSREQCreateAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQCreateAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]));
+            {
+                auto fun = DSREQMergeAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQMergeAggregate<int32_t>(LogicalType::DATE, sketch_map_types[LogicalTypeId::DATE]));
+        
+        
+            {
+                auto fun = DSREQCreateAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQCreateAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]));
+            {
+                auto fun = DSREQMergeAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQMergeAggregate<int64_t>(LogicalType::TIME, sketch_map_types[LogicalTypeId::TIME]));
+        
+        
+            {
+                auto fun = DSREQCreateAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQCreateAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]));
+            {
+                auto fun = DSREQMergeAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQMergeAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_map_types[LogicalTypeId::TIMESTAMP]));
+        
+        
+            {
+                auto fun = DSREQCreateAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQCreateAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]));
+            {
+                auto fun = DSREQMergeAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQMergeAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_map_types[LogicalTypeId::TIMESTAMP_TZ]));
+        
+        
+            {
+                auto fun = DSREQCreateAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQCreateAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]));
+            {
+                auto fun = DSREQMergeAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQMergeAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_map_types[LogicalTypeId::HUGEINT]));
+        
+        
+            {
+                auto fun = DSREQCreateAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]);
+                
+                // Any DECIMAL binds here, see DSDecimalItemFits.
+                fun.bind = DSTrackedBind<DSREQBindDecimal>;
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQCreateAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]));
+            {
+                auto fun = DSREQMergeAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQMergeAggregate<hugeint_t>(LogicalType::DECIMAL(38, 18), sketch_map_types[LogicalTypeId::DECIMAL]));
+        
+        
+            {
+                auto fun = DSREQCreateAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]);
+                
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQCreateAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]));
+            {
+                auto fun = DSREQMergeAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+            }
+            //sketch.AddFunction(DSREQMergeAggregate<string_t>(LogicalType::VARCHAR, sketch_map_types[LogicalTypeId::VARCHAR]));
+        
       CreateAggregateFunctionInfo sketch_info(sketch);
 
 
@@ -5282,6 +10107,7 @@ return sketch.get_max_item();
         FunctionDescription desc;
         desc.description = "Creates a sketch_req data sketch by aggregating values or by aggregating other REQ data sketches";
         desc.examples.push_back("datasketch_req(k, data)");
+        
         sketch_info.descriptions.push_back(desc);
     }
 
@@ -5318,7 +10144,7 @@ static inline void DSTDigestis_empty(DataChunk &args, ExpressionState &state, Ve
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::tdigest<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSTDigestSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize TDigest sketch: %s", e.what());
                 }
@@ -5352,7 +10178,7 @@ static inline void DSTDigestk(DataChunk &args, ExpressionState &state, Vector &r
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::tdigest<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSTDigestSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize TDigest sketch: %s", e.what());
                 }
@@ -5378,18 +10204,21 @@ static inline void DSTDigestcdf(DataChunk &args, ExpressionState &state, Vector
 
     
         
-                    UnifiedVectorFormat unified_split_points;
-                    split_points_vector.ToUnifiedFormat(args.size(), unified_split_points);
-
-                    // auto split_points_list_entries = UnifiedVectorFormat::GetData<list_entry_t>(unified_split_points);
-                    //         auto split_points_validitiy = FlatVector::Validity(split_points_vector);
-
                     auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
-
                     UnifiedVectorFormat split_points_children_unified;
-                    split_points_list_children.ToUnifiedFormat(args.size(), split_points_children_unified);
-
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
                     const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
+
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
                     
         BinaryExecutor::Execute
         <string_t,list_entry_t,list_entry_t>
@@ -5400,19 +10229,35 @@ static inline void DSTDigestcdf(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::tdigest<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSTDigestSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize TDigest sketch: %s", e.what());
                 }
             }();
 
-                    std::vector<T> passing_points(split_points_data.length);
-                    for (idx_t i = 0; i < split_points_data.length; i++)
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
+                    {
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
                     {
-                        passing_points[i] = split_points_list_children_data[i + split_points_data.offset];
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
                     }
                     
-auto cdf_result = sketch.get_CDF(passing_points.data(), split_points_data.length);
+auto cdf_result = sketch.get_CDF(split_points_ptr, split_points_data.length);
                 auto current_size = ListVector::GetListSize(result);
                 auto new_size = current_size + cdf_result.size();
                 if (ListVector::GetListCapacity(result) < new_size)
@@ -5421,7 +10266,7 @@ auto cdf_result = sketch.get_CDF(passing_points.data(), split_points_data.length
                 }
 
                 auto &child_entry = ListVector::GetEntry(result);
-                auto child_vals = FlatVector::GetData<T>(child_entry);
+                auto child_vals = FlatVector::GetData<double>(child_entry);
                 //auto &child_validity = FlatVector::Validity(child_entry);
                 for (idx_t i = 0; i < cdf_result.size(); i++)
                 {
@@ -5450,18 +10295,21 @@ static inline void DSTDigestpmf(DataChunk &args, ExpressionState &state, Vector
 
     
         
-                    UnifiedVectorFormat unified_split_points;
-                    split_points_vector.ToUnifiedFormat(args.size(), unified_split_points);
-
-                    // auto split_points_list_entries = UnifiedVectorFormat::GetData<list_entry_t>(unified_split_points);
-                    //         auto split_points_validitiy = FlatVector::Validity(split_points_vector);
-
                     auto &split_points_list_children = ListVector::GetEntry(split_points_vector);
-
                     UnifiedVectorFormat split_points_children_unified;
-                    split_points_list_children.ToUnifiedFormat(args.size(), split_points_children_unified);
-
+                    split_points_list_children.ToUnifiedFormat(ListVector::GetListSize(split_points_vector), split_points_children_unified);
                     const T *split_points_list_children_data = UnifiedVectorFormat::GetData<T>(split_points_children_unified);
+                    const bool split_points_children_flat = split_points_list_children.GetVectorType() == VectorType::FLAT_VECTOR;
+
+                    std::vector<DSQuantileItemType<T>> split_points_scratch;
+                    const bool split_points_constant = split_points_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+                                                       !ConstantVector::IsNull(split_points_vector);
+                    if (split_points_constant)
+                    {
+                        auto constant_entry = ConstantVector::GetData<list_entry_t>(split_points_vector)[0];
+                        GatherSplitPoints(split_points_children_unified, split_points_list_children_data, constant_entry, split_points_scratch);
+                        ValidateSplitPoints(split_points_scratch.data(), constant_entry.length);
+                    }
                     
         BinaryExecutor::Execute
         <string_t,list_entry_t,list_entry_t>
@@ -5472,19 +10320,35 @@ static inline void DSTDigestpmf(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::tdigest<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSTDigestSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize TDigest sketch: %s", e.what());
                 }
             }();
 
-                    std::vector<T> passing_points(split_points_data.length);
-                    for (idx_t i = 0; i < split_points_data.length; i++)
+                    const DSQuantileItemType<T> *split_points_ptr = nullptr;
+                    if (split_points_constant)
                     {
-                        passing_points[i] = split_points_list_children_data[i + split_points_data.offset];
+                        split_points_ptr = split_points_scratch.data();
+                    }
+                    else
+                    {
+                        if constexpr (std::is_same<DSQuantileItemType<T>, T>::value)
+                        {
+                            if (split_points_children_flat && split_points_children_unified.validity.AllValid())
+                            {
+                                split_points_ptr = split_points_list_children_data + split_points_data.offset;
+                            }
+                        }
+                        if (!split_points_ptr)
+                        {
+                            GatherSplitPoints(split_points_children_unified, split_points_list_children_data, split_points_data, split_points_scratch);
+                            split_points_ptr = split_points_scratch.data();
+                        }
+                        ValidateSplitPoints(split_points_ptr, split_points_data.length);
                     }
                     
-auto pmf_result = sketch.get_PMF(passing_points.data(), split_points_data.length);
+auto pmf_result = sketch.get_PMF(split_points_ptr, split_points_data.length);
                 auto current_size = ListVector::GetListSize(result);
                 auto new_size = current_size + pmf_result.size();
                 if (ListVector::GetListCapacity(result) < new_size)
@@ -5531,7 +10395,7 @@ static inline void DSTDigestdescribe(DataChunk &args, ExpressionState &state, Ve
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::tdigest<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSTDigestSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize TDigest sketch: %s", e.what());
                 }
@@ -5566,7 +10430,7 @@ static inline void DSTDigestrank(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::tdigest<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSTDigestSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize TDigest sketch: %s", e.what());
                 }
@@ -5600,7 +10464,7 @@ static inline void DSTDigesttotal_weight(DataChunk &args, ExpressionState &state
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::tdigest<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSTDigestSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize TDigest sketch: %s", e.what());
                 }
@@ -5635,7 +10499,7 @@ static inline void DSTDigestquantile(DataChunk &args, ExpressionState &state, Ve
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::tdigest<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSTDigestSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize TDigest sketch: %s", e.what());
                 }
@@ -5648,14 +10512,81 @@ return sketch.get_quantile(rank_data);
     
 
 
+template <class T>
+
+static inline void DSTDigestsummary(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 1);
+
+    
+        auto &sketch_vector = args.data[0];
+
+    
+        UnifiedVectorFormat sketch_unified;
+        sketch_vector.ToUnifiedFormat(args.size(), sketch_unified);
+        auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_unified);
+        auto &struct_entries = StructVector::GetEntries(result);
+
+        for (idx_t row = 0; row < args.size(); row++)
+        {
+            auto sketch_idx = sketch_unified.sel->get_index(row);
+            if (!sketch_unified.validity.RowIsValid(sketch_idx))
+            {
+                FlatVector::SetNull(result, row, true);
+                continue;
+            }
+            auto sketch_data = sketch_entries[sketch_idx];
+            
+            auto sketch = [&]() {
+                try {
+                    return DSTDigestSketch<T>::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize TDigest sketch: %s", e.what());
+                }
+            }();
+            
+            FlatVector::GetData<uint16_t>(*struct_entries[0])[row] = sketch.get_k();
+            FlatVector::GetData<bool>(*struct_entries[1])[row] = sketch.is_empty();
+            FlatVector::GetData<uint64_t>(*struct_entries[2])[row] = sketch.get_total_weight();
+            if (sketch.is_empty())
+            {
+                FlatVector::SetNull(*struct_entries[3], row, true);
+            }
+            else
+            {
+                FlatVector::GetData<T>(*struct_entries[3])[row] = DSQuantileItem<T>::ToDuckDB(*struct_entries[3], sketch.get_min_value());
+            }
+            if (sketch.is_empty())
+            {
+                FlatVector::SetNull(*struct_entries[4], row, true);
+            }
+            else
+            {
+                FlatVector::GetData<T>(*struct_entries[4])[row] = DSQuantileItem<T>::ToDuckDB(*struct_entries[4], sketch.get_max_value());
+            }
+        }
+
+        if (args.AllConstant())
+        {
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        }
+
+}
+
+    
+
+
     
     template <typename T>
     auto static DSTDigestMergeAggregate(const LogicalType &type, const LogicalType &result_type) -> AggregateFunction
     
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSTDigestState<T>, string_t, string_t, DSQuantilesMergeOperation<DSTDigestBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSTDigestState<T>, string_t, string_t, DSQuantilesMergeOperation<DSTDigestBindData>, AggregateDestructorType::LEGACY>(
             result_type, result_type);
+        fun.bind = DSTrackedBind<DSTDigestBind<DSTDigestState<T>, string_t, DSQuantilesMergeOperation<DSTDigestBindData>>>;
+        return fun;
         
     }
 
@@ -5665,11 +10596,15 @@ return sketch.get_quantile(rank_data);
     auto static DSTDigestCreateAggregate(const LogicalType &type, const LogicalType &result_type) -> AggregateFunction
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSTDigestState<T>, T, string_t, DSQuantilesCreateOperation<DSTDigestBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSTDigestState<T>, T, string_t, DSQuantilesCreateOperation<DSTDigestBindData>, AggregateDestructorType::LEGACY>(
             type, result_type);
+        fun.bind = DSTrackedBind<DSTDigestBind<DSTDigestState<T>, T, DSQuantilesCreateOperation<DSTDigestBindData>>>;
+        return fun;
         
     }
 
+    
+
 
   void LoadTDigestSketch(ExtensionLoader &loader) {
 
@@ -5677,8 +10612,10 @@ return sketch.get_quantile(rank_data);
       
         std::unordered_map<LogicalTypeId, LogicalType> sketch_map_types;
         
-            sketch_map_types.insert({ LogicalTypeId::FLOAT, CreateTDigestSketchType(loader, LogicalType(LogicalTypeId::FLOAT))});
-            sketch_map_types.insert({ LogicalTypeId::DOUBLE, CreateTDigestSketchType(loader, LogicalType(LogicalTypeId::DOUBLE))});
+            sketch_map_types.insert({ LogicalTypeId::FLOAT, CreateTDigestSketchType(loader, LogicalType::FLOAT)});
+            sketch_map_types.insert({ LogicalTypeId::DOUBLE, CreateTDigestSketchType(loader, LogicalType::DOUBLE)});
+      
+
       
 
       
@@ -5686,12 +10623,13 @@ return sketch.get_quantile(rank_data);
         ScalarFunctionSet fs("datasketch_tdigest_is_empty");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::BOOLEAN
-                ,    DSTDigestis_empty<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSTDigestis_empty<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::BOOLEAN
-                ,    DSTDigestis_empty<double>));
+                ,    DSTDigestis_empty<double>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -5711,12 +10649,13 @@ return sketch.get_quantile(rank_data);
         ScalarFunctionSet fs("datasketch_tdigest_k");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::USMALLINT
-                ,    DSTDigestk<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSTDigestk<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::USMALLINT
-                ,    DSTDigestk<double>));
+                ,    DSTDigestk<double>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -5736,12 +10675,13 @@ return sketch.get_quantile(rank_data);
         ScalarFunctionSet fs("datasketch_tdigest_cdf");
         
             
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT)},LogicalType::LIST(LogicalType::FLOAT)
-                ,    DSTDigestcdf<float>));
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT)},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSTDigestcdf<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE)},LogicalType::LIST(LogicalType::DOUBLE)
-                ,    DSTDigestcdf<double>));
+                ,    DSTDigestcdf<double>), DSUnitIntervalListStatistics));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -5761,12 +10701,13 @@ return sketch.get_quantile(rank_data);
         ScalarFunctionSet fs("datasketch_tdigest_pmf");
         
             
-                fs.AddFunction(ScalarFunction(
-                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT)},LogicalType::LIST(LogicalType::FLOAT)
-                ,    DSTDigestpmf<float>));
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::LIST(LogicalType::FLOAT)},LogicalType::LIST(LogicalType::DOUBLE)
+                ,    DSTDigestpmf<float>), DSUnitIntervalListStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::LIST(LogicalType::DOUBLE)},LogicalType::LIST(LogicalType::DOUBLE)
-                ,    DSTDigestpmf<double>));
+                ,    DSTDigestpmf<double>), DSUnitIntervalListStatistics));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -5786,12 +10727,13 @@ return sketch.get_quantile(rank_data);
         ScalarFunctionSet fs("datasketch_tdigest_describe");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSTDigestdescribe<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSTDigestdescribe<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSTDigestdescribe<double>));
+                ,    DSTDigestdescribe<double>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -5811,12 +10753,13 @@ return sketch.get_quantile(rank_data);
         ScalarFunctionSet fs("datasketch_tdigest_rank");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::FLOAT},LogicalType::DOUBLE
-                ,    DSTDigestrank<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSTDigestrank<float>), DSUnitIntervalStatistics));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE},LogicalType::DOUBLE
-                ,    DSTDigestrank<double>));
+                ,    DSTDigestrank<double>), DSUnitIntervalStatistics));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -5836,12 +10779,13 @@ return sketch.get_quantile(rank_data);
         ScalarFunctionSet fs("datasketch_tdigest_total_weight");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::UBIGINT
-                ,    DSTDigesttotal_weight<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSTDigesttotal_weight<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::UBIGINT
-                ,    DSTDigesttotal_weight<double>));
+                ,    DSTDigesttotal_weight<double>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -5861,12 +10805,13 @@ return sketch.get_quantile(rank_data);
         ScalarFunctionSet fs("datasketch_tdigest_quantile");
         
             
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::FLOAT],LogicalType::DOUBLE},LogicalType::FLOAT
-                ,    DSTDigestquantile<float>));
-                fs.AddFunction(ScalarFunction(
+                ,    DSTDigestquantile<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_map_types[LogicalTypeId::DOUBLE],LogicalType::DOUBLE},LogicalType::DOUBLE
-                ,    DSTDigestquantile<double>));
+                ,    DSTDigestquantile<double>), nullptr));
+            
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -5881,6 +10826,32 @@ return sketch.get_quantile(rank_data);
         loader.RegisterFunction(info);
 
 
+      }
+      {
+        ScalarFunctionSet fs("datasketch_tdigest_summary");
+        
+            
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::FLOAT]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"is_empty", LogicalType::BOOLEAN},{"total_weight", LogicalType::UBIGINT},{"min_item", LogicalType::FLOAT},{"max_item", LogicalType::FLOAT}})
+                ,    DSTDigestsummary<float>), nullptr));
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_map_types[LogicalTypeId::DOUBLE]},LogicalType::STRUCT(child_list_t<LogicalType>{{"k", LogicalType::USMALLINT},{"is_empty", LogicalType::BOOLEAN},{"total_weight", LogicalType::UBIGINT},{"min_item", LogicalType::DOUBLE},{"max_item", LogicalType::DOUBLE}})
+                ,    DSTDigestsummary<double>), nullptr));
+            
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return a struct of the metadata and estimates of the sketch from a single deserialization";
+            desc.examples.push_back("datasketch_tdigest_summary(sketch)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
       }
 
       // This funciton creates the sketches.
@@ -5890,7 +10861,7 @@ return sketch.get_quantile(rank_data);
         
             {
                 auto fun = DSTDigestCreateAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]);
-                fun.bind = DSTDigestBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5898,7 +10869,6 @@ return sketch.get_quantile(rank_data);
             //sketch.AddFunction(DSTDigestCreateAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]));
             {
                 auto fun = DSTDigestMergeAggregate<float>(LogicalType::FLOAT, sketch_map_types[LogicalTypeId::FLOAT]);
-                fun.bind = DSTDigestBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5908,7 +10878,7 @@ return sketch.get_quantile(rank_data);
         
             {
                 auto fun = DSTDigestCreateAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]);
-                fun.bind = DSTDigestBind;
+                
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5916,7 +10886,6 @@ return sketch.get_quantile(rank_data);
             //sketch.AddFunction(DSTDigestCreateAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]));
             {
                 auto fun = DSTDigestMergeAggregate<double>(LogicalType::DOUBLE, sketch_map_types[LogicalTypeId::DOUBLE]);
-                fun.bind = DSTDigestBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
@@ -5930,6 +10899,7 @@ return sketch.get_quantile(rank_data);
         FunctionDescription desc;
         desc.description = "Creates a sketch_tdigest data sketch by aggregating values or by aggregating other TDigest data sketches";
         desc.examples.push_back("datasketch_tdigest(k, data)");
+        
         sketch_info.descriptions.push_back(desc);
     }
 
@@ -5964,7 +10934,7 @@ static inline void DSHLLis_empty(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::hll_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSHLLSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize HLL sketch: %s", e.what());
                 }
@@ -5998,7 +10968,7 @@ static inline void DSHLLdescribe(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::hll_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSHLLSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize HLL sketch: %s", e.what());
                 }
@@ -6030,7 +11000,7 @@ static inline void DSHLLlg_config_k(DataChunk &args, ExpressionState &state, Vec
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::hll_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSHLLSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize HLL sketch: %s", e.what());
                 }
@@ -6062,7 +11032,7 @@ static inline void DSHLLis_compact(DataChunk &args, ExpressionState &state, Vect
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::hll_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSHLLSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize HLL sketch: %s", e.what());
                 }
@@ -6075,6 +11045,82 @@ return sketch.is_compact();
     
 
 
+static inline void DSHLLtarget_type(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 1);
+
+    
+        auto &sketch_vector = args.data[0];
+
+    
+        
+        UnaryExecutor::Execute
+        <string_t,string_t>
+        (
+        sketch_vector,result,args.size(),
+        [&](string_t sketch_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSHLLSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize HLL sketch: %s", e.what());
+                }
+            }();
+switch (sketch.get_target_type())
+                    {
+                    case datasketches::target_hll_type::HLL_4:
+                        return StringVector::AddString(result, "HLL_4");
+                    case datasketches::target_hll_type::HLL_6:
+                        return StringVector::AddString(result, "HLL_6");
+                    default:
+                        return StringVector::AddString(result, "HLL_8");
+                    }
+        });
+
+}
+
+    
+
+
+static inline void DSHLLconvert(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 3);
+
+    
+        auto &sketch_vector = args.data[0];
+        auto &type_vector = args.data[1];
+        auto &compact_vector = args.data[2];
+
+    
+        
+        TernaryExecutor::Execute
+        <string_t,string_t,bool,string_t>
+        (
+        sketch_vector,type_vector,compact_vector,result,args.size(),
+        [&](string_t sketch_data,string_t type_data,bool compact_data) {
+
+            
+            auto sketch = [&]() {
+                try {
+                    return DSHLLSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize HLL sketch: %s", e.what());
+                }
+            }();
+DSHLLSketch converted(sketch, DSHLLTargetType(type_data.GetString()));
+                    auto serialized = compact_data ? converted.serialize_compact() : converted.serialize_updatable();
+                    return StringVector::AddStringOrBlob(result, std::string(serialized.begin(), serialized.end()));
+        });
+
+}
+
+    
+
+
 static inline void DSHLLestimate(DataChunk &args, ExpressionState &state, Vector &result)
 {
     // Get the references to the incoming vectors.
@@ -6094,7 +11140,7 @@ static inline void DSHLLestimate(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::hll_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSHLLSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize HLL sketch: %s", e.what());
                 }
@@ -6127,7 +11173,7 @@ static inline void DSHLLlower_bound(DataChunk &args, ExpressionState &state, Vec
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::hll_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSHLLSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize HLL sketch: %s", e.what());
                 }
@@ -6160,7 +11206,7 @@ static inline void DSHLLupper_bound(DataChunk &args, ExpressionState &state, Vec
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::hll_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSHLLSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize HLL sketch: %s", e.what());
                 }
@@ -6173,13 +11219,65 @@ return sketch.get_upper_bound(std_dev_data);
     
 
 
+static inline void DSHLLsummary(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 1);
+
+    
+        auto &sketch_vector = args.data[0];
+
+    
+        UnifiedVectorFormat sketch_unified;
+        sketch_vector.ToUnifiedFormat(args.size(), sketch_unified);
+        auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_unified);
+        auto &struct_entries = StructVector::GetEntries(result);
+
+        for (idx_t row = 0; row < args.size(); row++)
+        {
+            auto sketch_idx = sketch_unified.sel->get_index(row);
+            if (!sketch_unified.validity.RowIsValid(sketch_idx))
+            {
+                FlatVector::SetNull(result, row, true);
+                continue;
+            }
+            auto sketch_data = sketch_entries[sketch_idx];
+            
+            auto sketch = [&]() {
+                try {
+                    return DSHLLSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize HLL sketch: %s", e.what());
+                }
+            }();
+            
+            FlatVector::GetData<uint8_t>(*struct_entries[0])[row] = sketch.get_lg_config_k();
+            FlatVector::GetData<bool>(*struct_entries[1])[row] = sketch.is_empty();
+            FlatVector::GetData<bool>(*struct_entries[2])[row] = sketch.is_compact();
+            FlatVector::GetData<double>(*struct_entries[3])[row] = sketch.get_estimate();
+            FlatVector::GetData<double>(*struct_entries[4])[row] = sketch.get_lower_bound(2);
+            FlatVector::GetData<double>(*struct_entries[5])[row] = sketch.get_upper_bound(2);
+        }
+
+        if (args.AllConstant())
+        {
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        }
+
+}
+
+    
+
+
     
     auto static DSHLLMergeAggregate(const LogicalType &result_type) -> AggregateFunction
     
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSHLLState, string_t, string_t, DSHLLMergeOperation<DSHLLBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSHLLState, string_t, string_t, DSHLLMergeOperation<DSHLLBindData>, AggregateDestructorType::LEGACY>(
             result_type, result_type);
+        fun.bind = DSTrackedBind<DSHLLBind<DSHLLState, string_t, DSHLLMergeOperation<DSHLLBindData>>>;
+        return fun;
         
     }
 
@@ -6189,11 +11287,25 @@ return sketch.get_upper_bound(std_dev_data);
     auto static DSHLLCreateAggregate(const LogicalType &type, const LogicalType &result_type) -> AggregateFunction
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSHLLState, T, string_t, DSHLLCreateOperation<DSHLLBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSHLLState, T, string_t, DSHLLCreateOperation<DSHLLBindData>, AggregateDestructorType::LEGACY>(
             type, result_type);
+        fun.bind = DSTrackedBind<DSHLLBind<DSHLLState, T, DSHLLCreateOperation<DSHLLBindData>>>;
+        DSUseDistinctUpdate<DSHLLState, T, DSHLLCreateOperation<DSHLLBindData>>(fun);
+        return fun;
         
     }
 
+    
+    static unique_ptr<FunctionData> DSHLLBindDecimal(ClientContext &context, AggregateFunction &function,
+                                                        vector<unique_ptr<Expression>> &arguments)
+    {
+        return DSBindDecimalInput<DSHLLBindData>(context, function, arguments, 1,
+                                  [](auto tag, const LogicalType &type, const LogicalType &result_type) {
+                                      return DSHLLCreateAggregate<decltype(tag)>(type, result_type);
+                                  });
+    }
+    
+
 
   void LoadHLLSketch(ExtensionLoader &loader) {
 
@@ -6203,12 +11315,14 @@ return sketch.get_upper_bound(std_dev_data);
       
 
       
+
+      
       {
         ScalarFunctionSet fs("datasketch_hll_is_empty");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type},LogicalType::BOOLEAN
-                ,    DSHLLis_empty));
+                ,    DSHLLis_empty), nullptr));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6227,9 +11341,9 @@ return sketch.get_upper_bound(std_dev_data);
       {
         ScalarFunctionSet fs("datasketch_hll_describe");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type,LogicalType::BOOLEAN,LogicalType::BOOLEAN},LogicalType::VARCHAR
-                ,    DSHLLdescribe));
+                ,    DSHLLdescribe), nullptr));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6248,9 +11362,9 @@ return sketch.get_upper_bound(std_dev_data);
       {
         ScalarFunctionSet fs("datasketch_hll_lg_config_k");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type},LogicalType::UTINYINT
-                ,    DSHLLlg_config_k));
+                ,    DSHLLlg_config_k), DSHLLLgConfigKStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6269,9 +11383,9 @@ return sketch.get_upper_bound(std_dev_data);
       {
         ScalarFunctionSet fs("datasketch_hll_is_compact");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type},LogicalType::BOOLEAN
-                ,    DSHLLis_compact));
+                ,    DSHLLis_compact), nullptr));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6286,13 +11400,55 @@ return sketch.get_upper_bound(std_dev_data);
         loader.RegisterFunction(info);
 
 
+      }
+      {
+        ScalarFunctionSet fs("datasketch_hll_target_type");
+        
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_type},LogicalType::VARCHAR
+                ,    DSHLLtarget_type), nullptr));
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return the target type of the sketch: HLL_4, HLL_6 or HLL_8";
+            desc.examples.push_back("datasketch_hll_target_type(sketch)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
+      }
+      {
+        ScalarFunctionSet fs("datasketch_hll_convert");
+        
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_type,LogicalType::VARCHAR,LogicalType::BOOLEAN},sketch_type
+                ,    DSHLLconvert), nullptr));
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Convert the sketch to a target type (HLL_4, HLL_6 or HLL_8) and serialize it in compact or updatable form";
+            desc.examples.push_back("datasketch_hll_convert(sketch, 'HLL_8', true)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
       }
       {
         ScalarFunctionSet fs("datasketch_hll_estimate");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type},LogicalType::DOUBLE
-                ,    DSHLLestimate));
+                ,    DSHLLestimate), DSNonNegativeStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6311,9 +11467,9 @@ return sketch.get_upper_bound(std_dev_data);
       {
         ScalarFunctionSet fs("datasketch_hll_lower_bound");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type,LogicalType::UTINYINT},LogicalType::DOUBLE
-                ,    DSHLLlower_bound));
+                ,    DSHLLlower_bound), DSNonNegativeStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6332,9 +11488,9 @@ return sketch.get_upper_bound(std_dev_data);
       {
         ScalarFunctionSet fs("datasketch_hll_upper_bound");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type,LogicalType::UTINYINT},LogicalType::DOUBLE
-                ,    DSHLLupper_bound));
+                ,    DSHLLupper_bound), DSNonNegativeStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6349,6 +11505,27 @@ return sketch.get_upper_bound(std_dev_data);
         loader.RegisterFunction(info);
 
 
+      }
+      {
+        ScalarFunctionSet fs("datasketch_hll_summary");
+        
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_type},LogicalType::STRUCT(child_list_t<LogicalType>{{"lg_config_k", LogicalType::UTINYINT},{"is_empty", LogicalType::BOOLEAN},{"is_compact", LogicalType::BOOLEAN},{"estimate", LogicalType::DOUBLE},{"lower_bound", LogicalType::DOUBLE},{"upper_bound", LogicalType::DOUBLE}})
+                ,    DSHLLsummary), nullptr));
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return a struct of the metadata and estimates of the sketch from a single deserialization";
+            desc.examples.push_back("datasketch_hll_summary(sketch)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
       }
 
       // This funciton creates the sketches.
@@ -6357,111 +11534,303 @@ return sketch.get_upper_bound(std_dev_data);
       
         
             {
-                auto fun = DSHLLCreateAggregate<int8_t>(LogicalType::TINYINT, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<int8_t>(LogicalType::TINYINT, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSHLLCreateAggregate<int16_t>(LogicalType::SMALLINT, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSHLLCreateAggregate<int32_t>(LogicalType::INTEGER, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSHLLCreateAggregate<int64_t>(LogicalType::BIGINT, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSHLLCreateAggregate<float>(LogicalType::FLOAT, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSHLLCreateAggregate<double>(LogicalType::DOUBLE, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSHLLCreateAggregate<uint8_t>(LogicalType::UTINYINT, sketch_type);
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
-                auto fun = DSHLLCreateAggregate<int16_t>(LogicalType::SMALLINT, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<uint16_t>(LogicalType::USMALLINT, sketch_type);
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
-                auto fun = DSHLLCreateAggregate<int32_t>(LogicalType::INTEGER, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<uint32_t>(LogicalType::UINTEGER, sketch_type);
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
-                auto fun = DSHLLCreateAggregate<int64_t>(LogicalType::BIGINT, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<uint64_t>(LogicalType::UBIGINT, sketch_type);
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
-                auto fun = DSHLLCreateAggregate<float>(LogicalType::FLOAT, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<string_t>(LogicalType::VARCHAR, sketch_type);
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
-                auto fun = DSHLLCreateAggregate<double>(LogicalType::DOUBLE, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<string_t>(LogicalType::BLOB, sketch_type);
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
-                auto fun = DSHLLCreateAggregate<uint8_t>(LogicalType::UTINYINT, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<int32_t>(LogicalType::DATE, sketch_type);
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
-                auto fun = DSHLLCreateAggregate<uint16_t>(LogicalType::USMALLINT, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<int64_t>(LogicalType::TIME, sketch_type);
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
-                auto fun = DSHLLCreateAggregate<uint32_t>(LogicalType::UINTEGER, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_type);
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
-                auto fun = DSHLLCreateAggregate<uint64_t>(LogicalType::UBIGINT, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSHLLCreateAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_type);
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
-                auto fun = DSHLLCreateAggregate<string_t>(LogicalType::VARCHAR, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<uhugeint_t>(LogicalType::UHUGEINT, sketch_type);
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
-                auto fun = DSHLLCreateAggregate<string_t>(LogicalType::BLOB, sketch_type);
-                fun.bind = DSHLLBind;
+                auto fun = DSHLLCreateAggregate<DSUuid>(LogicalType::UUID, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
+            }
+            
+            {
+                // DECIMAL of any width, see DSBindDecimalInput.
+                auto fun = DSHLLCreateAggregate<int64_t>(LogicalType(LogicalTypeId::DECIMAL), sketch_type);
+                fun.bind = DSTrackedBind<DSHLLBindDecimal>;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+                fun.arguments.push_back(LogicalType::VARCHAR);
+                sketch.AddFunction(fun);
+                fun.arguments.push_back(LogicalType::BOOLEAN);
+                sketch.AddFunction(fun);
+                
             }
+            
         
       CreateAggregateFunctionInfo sketch_info(sketch);
 
@@ -6470,6 +11839,9 @@ return sketch.get_upper_bound(std_dev_data);
         FunctionDescription desc;
         desc.description = "Creates a sketch_hll data sketch by aggregating values or by aggregating other HLL data sketches";
         desc.examples.push_back("datasketch_hll(k, data)");
+        
+        desc.examples.push_back("datasketch_hll(k, data, 'HLL_8', true)");
+        
         sketch_info.descriptions.push_back(desc);
     }
 
@@ -6482,10 +11854,15 @@ return sketch.get_upper_bound(std_dev_data);
       {
       AggregateFunctionSet sketch("datasketch_hll_union");
       auto fun = DSHLLMergeAggregate(sketch_type);
-      fun.bind = DSHLLBind;
       fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
       fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
       sketch.AddFunction(fun);
+      
+      fun.arguments.push_back(LogicalType::VARCHAR);
+      sketch.AddFunction(fun);
+      fun.arguments.push_back(LogicalType::BOOLEAN);
+      sketch.AddFunction(fun);
+      
       CreateAggregateFunctionInfo sketch_info(sketch);
 
     {
@@ -6523,7 +11900,7 @@ static inline void DSCPCis_empty(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::cpc_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSCPCSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize CPC sketch: %s", e.what());
                 }
@@ -6555,7 +11932,7 @@ static inline void DSCPCdescribe(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::cpc_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSCPCSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize CPC sketch: %s", e.what());
                 }
@@ -6587,7 +11964,7 @@ static inline void DSCPCestimate(DataChunk &args, ExpressionState &state, Vector
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::cpc_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSCPCSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize CPC sketch: %s", e.what());
                 }
@@ -6620,7 +11997,7 @@ static inline void DSCPClower_bound(DataChunk &args, ExpressionState &state, Vec
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::cpc_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSCPCSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize CPC sketch: %s", e.what());
                 }
@@ -6653,7 +12030,7 @@ static inline void DSCPCupper_bound(DataChunk &args, ExpressionState &state, Vec
             
             auto sketch = [&]() {
                 try {
-                    return datasketches::cpc_sketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                    return DSCPCSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
                 } catch (const std::exception &e) {
                     throw InvalidInputException("Failed to deserialize CPC sketch: %s", e.what());
                 }
@@ -6666,13 +12043,64 @@ return sketch.get_upper_bound(std_dev_data);
     
 
 
+static inline void DSCPCsummary(DataChunk &args, ExpressionState &state, Vector &result)
+{
+    // Get the references to the incoming vectors.
+    D_ASSERT(args.ColumnCount() == 1);
+
+    
+        auto &sketch_vector = args.data[0];
+
+    
+        UnifiedVectorFormat sketch_unified;
+        sketch_vector.ToUnifiedFormat(args.size(), sketch_unified);
+        auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_unified);
+        auto &struct_entries = StructVector::GetEntries(result);
+
+        for (idx_t row = 0; row < args.size(); row++)
+        {
+            auto sketch_idx = sketch_unified.sel->get_index(row);
+            if (!sketch_unified.validity.RowIsValid(sketch_idx))
+            {
+                FlatVector::SetNull(result, row, true);
+                continue;
+            }
+            auto sketch_data = sketch_entries[sketch_idx];
+            
+            auto sketch = [&]() {
+                try {
+                    return DSCPCSketch::deserialize(sketch_data.GetDataUnsafe(), sketch_data.GetSize());
+                } catch (const std::exception &e) {
+                    throw InvalidInputException("Failed to deserialize CPC sketch: %s", e.what());
+                }
+            }();
+            
+            FlatVector::GetData<uint8_t>(*struct_entries[0])[row] = sketch.get_lg_k();
+            FlatVector::GetData<bool>(*struct_entries[1])[row] = sketch.is_empty();
+            FlatVector::GetData<double>(*struct_entries[2])[row] = sketch.get_estimate();
+            FlatVector::GetData<double>(*struct_entries[3])[row] = sketch.get_lower_bound(2);
+            FlatVector::GetData<double>(*struct_entries[4])[row] = sketch.get_upper_bound(2);
+        }
+
+        if (args.AllConstant())
+        {
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        }
+
+}
+
+    
+
+
     
     auto static DSCPCMergeAggregate(const LogicalType &result_type) -> AggregateFunction
     
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSCPCState, string_t, string_t, DSCPCMergeOperation<DSCPCBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSCPCState, string_t, string_t, DSCPCMergeOperation<DSCPCBindData>, AggregateDestructorType::LEGACY>(
             result_type, result_type);
+        fun.bind = DSTrackedBind<DSCPCBind<DSCPCState, string_t, DSCPCMergeOperation<DSCPCBindData>>>;
+        return fun;
         
     }
 
@@ -6682,11 +12110,25 @@ return sketch.get_upper_bound(std_dev_data);
     auto static DSCPCCreateAggregate(const LogicalType &type, const LogicalType &result_type) -> AggregateFunction
     {
         
-        return AggregateFunction::UnaryAggregateDestructor<DSCPCState, T, string_t, DSCPCCreateOperation<DSCPCBindData>, AggregateDestructorType::LEGACY>(
+        auto fun = AggregateFunction::UnaryAggregateDestructor<DSCPCState, T, string_t, DSCPCCreateOperation<DSCPCBindData>, AggregateDestructorType::LEGACY>(
             type, result_type);
+        fun.bind = DSTrackedBind<DSCPCBind<DSCPCState, T, DSCPCCreateOperation<DSCPCBindData>>>;
+        DSUseDistinctUpdate<DSCPCState, T, DSCPCCreateOperation<DSCPCBindData>>(fun);
+        return fun;
         
     }
 
+    
+    static unique_ptr<FunctionData> DSCPCBindDecimal(ClientContext &context, AggregateFunction &function,
+                                                        vector<unique_ptr<Expression>> &arguments)
+    {
+        return DSBindDecimalInput<DSCPCBindData>(context, function, arguments, 1,
+                                  [](auto tag, const LogicalType &type, const LogicalType &result_type) {
+                                      return DSCPCCreateAggregate<decltype(tag)>(type, result_type);
+                                  });
+    }
+    
+
 
   void LoadCPCSketch(ExtensionLoader &loader) {
 
@@ -6696,12 +12138,14 @@ return sketch.get_upper_bound(std_dev_data);
       
 
       
+
+      
       {
         ScalarFunctionSet fs("datasketch_cpc_is_empty");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type},LogicalType::BOOLEAN
-                ,    DSCPCis_empty));
+                ,    DSCPCis_empty), nullptr));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6720,9 +12164,9 @@ return sketch.get_upper_bound(std_dev_data);
       {
         ScalarFunctionSet fs("datasketch_cpc_describe");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type},LogicalType::VARCHAR
-                ,    DSCPCdescribe));
+                ,    DSCPCdescribe), nullptr));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6741,9 +12185,9 @@ return sketch.get_upper_bound(std_dev_data);
       {
         ScalarFunctionSet fs("datasketch_cpc_estimate");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type},LogicalType::DOUBLE
-                ,    DSCPCestimate));
+                ,    DSCPCestimate), DSNonNegativeStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6762,9 +12206,9 @@ return sketch.get_upper_bound(std_dev_data);
       {
         ScalarFunctionSet fs("datasketch_cpc_lower_bound");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type,LogicalType::UTINYINT},LogicalType::DOUBLE
-                ,    DSCPClower_bound));
+                ,    DSCPClower_bound), DSNonNegativeStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6783,9 +12227,9 @@ return sketch.get_upper_bound(std_dev_data);
       {
         ScalarFunctionSet fs("datasketch_cpc_upper_bound");
         
-                fs.AddFunction(ScalarFunction(
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
                 {sketch_type,LogicalType::UTINYINT},LogicalType::DOUBLE
-                ,    DSCPCupper_bound));
+                ,    DSCPCupper_bound), DSNonNegativeStatistics));
         
 
         CreateScalarFunctionInfo info(std::move(fs));
@@ -6800,6 +12244,27 @@ return sketch.get_upper_bound(std_dev_data);
         loader.RegisterFunction(info);
 
 
+      }
+      {
+        ScalarFunctionSet fs("datasketch_cpc_summary");
+        
+                fs.AddFunction(DSWithStatistics(ScalarFunction(
+                {sketch_type},LogicalType::STRUCT(child_list_t<LogicalType>{{"lg_k", LogicalType::UTINYINT},{"is_empty", LogicalType::BOOLEAN},{"estimate", LogicalType::DOUBLE},{"lower_bound", LogicalType::DOUBLE},{"upper_bound", LogicalType::DOUBLE}})
+                ,    DSCPCsummary), nullptr));
+        
+
+        CreateScalarFunctionInfo info(std::move(fs));
+
+        {
+            FunctionDescription desc;
+            desc.description = "Return a struct of the metadata and estimates of the sketch from a single deserialization";
+            desc.examples.push_back("datasketch_cpc_summary(sketch)");
+            info.descriptions.push_back(desc);
+        }
+
+        loader.RegisterFunction(info);
+
+
       }
 
       // This funciton creates the sketches.
@@ -6809,110 +12274,202 @@ return sketch.get_upper_bound(std_dev_data);
         
             {
                 auto fun = DSCPCCreateAggregate<int8_t>(LogicalType::TINYINT, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
                 auto fun = DSCPCCreateAggregate<int16_t>(LogicalType::SMALLINT, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
                 auto fun = DSCPCCreateAggregate<int32_t>(LogicalType::INTEGER, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
                 auto fun = DSCPCCreateAggregate<int64_t>(LogicalType::BIGINT, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
                 auto fun = DSCPCCreateAggregate<float>(LogicalType::FLOAT, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
                 auto fun = DSCPCCreateAggregate<double>(LogicalType::DOUBLE, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
                 auto fun = DSCPCCreateAggregate<uint8_t>(LogicalType::UTINYINT, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
                 auto fun = DSCPCCreateAggregate<uint16_t>(LogicalType::USMALLINT, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
                 auto fun = DSCPCCreateAggregate<uint32_t>(LogicalType::UINTEGER, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
                 auto fun = DSCPCCreateAggregate<uint64_t>(LogicalType::UBIGINT, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
                 auto fun = DSCPCCreateAggregate<string_t>(LogicalType::VARCHAR, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
             }
+            
         
         
             {
                 auto fun = DSCPCCreateAggregate<string_t>(LogicalType::BLOB, sketch_type);
-                fun.bind = DSCPCBind;
                 fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
                 fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
                 sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSCPCCreateAggregate<int32_t>(LogicalType::DATE, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSCPCCreateAggregate<int64_t>(LogicalType::TIME, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSCPCCreateAggregate<int64_t>(LogicalType::TIMESTAMP, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSCPCCreateAggregate<int64_t>(LogicalType::TIMESTAMP_TZ, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSCPCCreateAggregate<hugeint_t>(LogicalType::HUGEINT, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSCPCCreateAggregate<uhugeint_t>(LogicalType::UHUGEINT, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+            }
+            
+        
+        
+            {
+                auto fun = DSCPCCreateAggregate<DSUuid>(LogicalType::UUID, sketch_type);
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
+            }
+            
+            {
+                // DECIMAL of any width, see DSBindDecimalInput.
+                auto fun = DSCPCCreateAggregate<int64_t>(LogicalType(LogicalTypeId::DECIMAL), sketch_type);
+                fun.bind = DSTrackedBind<DSCPCBindDecimal>;
+                fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+                sketch.AddFunction(fun);
+                
             }
+            
         
       CreateAggregateFunctionInfo sketch_info(sketch);
 
@@ -6921,6 +12478,7 @@ return sketch.get_upper_bound(std_dev_data);
         FunctionDescription desc;
         desc.description = "Creates a sketch_cpc data sketch by aggregating values or by aggregating other CPC data sketches";
         desc.examples.push_back("datasketch_cpc(k, data)");
+        
         sketch_info.descriptions.push_back(desc);
     }
 
@@ -6933,10 +12491,10 @@ return sketch.get_upper_bound(std_dev_data);
       {
       AggregateFunctionSet sketch("datasketch_cpc_union");
       auto fun = DSCPCMergeAggregate(sketch_type);
-      fun.bind = DSCPCBind;
       fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
       fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
       sketch.AddFunction(fun);
+      
       CreateAggregateFunctionInfo sketch_info(sketch);
 
     {
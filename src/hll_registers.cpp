@@ -0,0 +1,158 @@
+#include "hll_registers.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define DS_HLL_REGISTERS_X86
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define DS_HLL_REGISTERS_NEON
+#endif
+
+namespace duckdb
+{
+    namespace
+    {
+        constexpr uint8_t HLL_FLAG_OUT_OF_ORDER = 16;
+        constexpr uint8_t HLL8_MAX_REGISTER = 63;
+
+        // ============================================================
+        // 1. Register Max Kernels
+        // ============================================================
+
+        void MaxRegistersScalar(uint8_t *target, const uint8_t *source, idx_t count)
+        {
+            for (idx_t i = 0; i < count; i++)
+            {
+                target[i] = MaxValue(target[i], source[i]);
+            }
+        }
+
+#ifdef DS_HLL_REGISTERS_X86
+        void MaxRegistersSSE2(uint8_t *target, const uint8_t *source, idx_t count)
+        {
+            idx_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                auto a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(target + i));
+                auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(target + i), _mm_max_epu8(a, b));
+            }
+            MaxRegistersScalar(target + i, source + i, count - i);
+        }
+
+#if defined(__GNUC__) || defined(__clang__)
+#define DS_HLL_REGISTERS_AVX2
+        __attribute__((target("avx2"))) void MaxRegistersAVX2(uint8_t *target, const uint8_t *source, idx_t count)
+        {
+            idx_t i = 0;
+            for (; i + 32 <= count; i += 32)
+            {
+                auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(target + i));
+                auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(target + i), _mm256_max_epu8(a, b));
+            }
+            MaxRegistersScalar(target + i, source + i, count - i);
+        }
+#endif
+#endif
+
+#ifdef DS_HLL_REGISTERS_NEON
+        void MaxRegistersNEON(uint8_t *target, const uint8_t *source, idx_t count)
+        {
+            idx_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                vst1q_u8(target + i, vmaxq_u8(vld1q_u8(target + i), vld1q_u8(source + i)));
+            }
+            MaxRegistersScalar(target + i, source + i, count - i);
+        }
+#endif
+
+        using max_registers_t = void (*)(uint8_t *, const uint8_t *, idx_t);
+
+        max_registers_t SelectMaxRegisters()
+        {
+#if defined(DS_HLL_REGISTERS_AVX2)
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return MaxRegistersAVX2;
+            }
+            return MaxRegistersSSE2;
+#elif defined(DS_HLL_REGISTERS_X86)
+            return MaxRegistersSSE2;
+#elif defined(DS_HLL_REGISTERS_NEON)
+            return MaxRegistersNEON;
+#else
+            return MaxRegistersScalar;
+#endif
+        }
+    } // namespace
+
+    // ============================================================
+    // 2. Dense HLL_8 Images
+    // ============================================================
+
+    const uint8_t *DSHLLDenseRegisters(const string_t &image, uint8_t lg_k)
+    {
+        auto data = const_data_ptr_cast(image.GetData());
+        if (image.GetSize() != HLL_REGISTERS_START + (idx_t(1) << lg_k) || data[0] != HLL_PREAMBLE_INTS ||
+            data[1] != HLL_SERIAL_VERSION || data[2] != HLL_FAMILY || data[HLL_LG_K_BYTE] != lg_k)
+        {
+            return nullptr;
+        }
+        auto mode = data[HLL_MODE_BYTE];
+        if ((mode & 0x3) != HLL_MODE_HLL || ((mode >> 2) & 0x3) != HLL_TYPE_HLL_8)
+        {
+            return nullptr;
+        }
+        return data + HLL_REGISTERS_START;
+    }
+
+    void DSHLLMaxRegisters(uint8_t *target, const uint8_t *source, idx_t count)
+    {
+        static const max_registers_t max_registers = SelectMaxRegisters();
+        max_registers(target, source, count);
+    }
+
+    vector<uint8_t> DSHLLRegistersImage(const uint8_t *registers, uint8_t lg_k)
+    {
+        auto count = idx_t(1) << lg_k;
+        vector<uint8_t> image(HLL_REGISTERS_START + count, 0);
+        image[0] = HLL_PREAMBLE_INTS;
+        image[1] = HLL_SERIAL_VERSION;
+        image[2] = HLL_FAMILY;
+        image[HLL_LG_K_BYTE] = lg_k;
+        image[HLL_FLAGS_BYTE] = HLL_FLAG_OUT_OF_ORDER;
+        image[HLL_MODE_BYTE] = HLL_MODE_HLL | (HLL_TYPE_HLL_8 << 2);
+
+        // HLL_8 keeps cur_min at 0, so num_at_cur_min counts the empty
+        // registers. The HIP accumulator is unused once out of order.
+        double kxq0 = 0;
+        double kxq1 = 0;
+        uint32_t num_at_cur_min = 0;
+        for (idx_t i = 0; i < count; i++)
+        {
+            auto value = MinValue(registers[i], HLL8_MAX_REGISTER);
+            num_at_cur_min += value == 0;
+            auto inverse_power = 1.0 / double(uint64_t(1) << value);
+            if (value < 32)
+            {
+                kxq0 += inverse_power;
+            }
+            else
+            {
+                kxq1 += inverse_power;
+            }
+        }
+        Store<double>(0, image.data() + 8);
+        Store<double>(kxq0, image.data() + 16);
+        Store<double>(kxq1, image.data() + 24);
+        Store<uint32_t>(num_at_cur_min, image.data() + 32);
+        Store<uint32_t>(0, image.data() + 36);
+        memcpy(image.data() + HLL_REGISTERS_START, registers, count);
+        return image;
+    }
+
+} // namespace duckdb
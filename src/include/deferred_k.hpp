@@ -0,0 +1,89 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+#include "distinct_update.hpp"
+
+namespace duckdb
+{
+
+    // Support for a K (or lg_k) argument given as a prepared statement
+    // parameter.
+    //
+    // Binding the value would force DuckDB to rebind the plan on every
+    // execution.  Instead the bind function leaves K as the first input
+    // column and installs these update functions, which record the value in
+    // each state before the sketch is created.  The sketch is created lazily
+    // anyway, so a cached plan can be executed with any precision.
+    //
+    // STATE must have an int32_t member k that is 0 until a value is seen,
+    // and a static CheckK(int32_t) that throws for values out of range.
+
+    template <class STATE>
+    static void DSSetDeferredK(STATE &state, const UnifiedVectorFormat &k_format, idx_t row)
+    {
+        auto k_idx = k_format.sel->get_index(row);
+        if (!k_format.validity.RowIsValid(k_idx))
+        {
+            throw InvalidInputException("K value cannot be NULL");
+        }
+        auto k = UnifiedVectorFormat::GetData<int32_t>(k_format)[k_idx];
+        if (state.k != k)
+        {
+            STATE::CheckK(k);
+            state.k = k;
+        }
+    }
+
+    template <class STATE, aggregate_update_t UPDATE>
+    static void DSDeferredKScatterUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                         Vector &states, idx_t count)
+    {
+        D_ASSERT(input_count >= 2);
+        UnifiedVectorFormat k_format;
+        inputs[0].ToUnifiedFormat(count, k_format);
+        UnifiedVectorFormat state_format;
+        states.ToUnifiedFormat(count, state_format);
+        auto state_data = UnifiedVectorFormat::GetData<STATE *>(state_format);
+        for (idx_t i = 0; i < count; i++)
+        {
+            DSSetDeferredK(*state_data[state_format.sel->get_index(i)], k_format, i);
+        }
+        UPDATE(inputs + 1, aggr_input_data, input_count - 1, states, count);
+    }
+
+    template <class STATE, aggregate_simple_update_t SIMPLE_UPDATE>
+    static void DSDeferredKSimpleUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                        data_ptr_t state_p, idx_t count)
+    {
+        D_ASSERT(input_count >= 2);
+        UnifiedVectorFormat k_format;
+        inputs[0].ToUnifiedFormat(count, k_format);
+        auto &state = *reinterpret_cast<STATE *>(state_p);
+        for (idx_t i = 0; i < count; i++)
+        {
+            DSSetDeferredK(state, k_format, i);
+        }
+        SIMPLE_UPDATE(inputs + 1, aggr_input_data, input_count - 1, state_p, count);
+    }
+
+    // Installs deferred update functions that record K and pass the other
+    // columns on to the given update functions, for aggregates whose update
+    // functions are written out rather than generated.
+    template <class STATE, aggregate_update_t UPDATE, aggregate_simple_update_t SIMPLE_UPDATE>
+    static void DSDeferKUpdates(AggregateFunction &function)
+    {
+        function.update = DSDeferredKScatterUpdate<STATE, UPDATE>;
+        function.simple_update = DSDeferredKSimpleUpdate<STATE, SIMPLE_UPDATE>;
+    }
+
+    // Installs the deferred update functions on an aggregate whose first
+    // argument is K.
+    template <class STATE, class INPUT_TYPE, class OP>
+    static void DSDeferK(AggregateFunction &function)
+    {
+        DSDeferKUpdates<STATE, DSUnaryScatterUpdate<STATE, INPUT_TYPE, OP>, DSUnaryUpdate<STATE, INPUT_TYPE, OP>>(
+            function);
+    }
+
+} // namespace duckdb
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+
+#include <type_traits>
+
+namespace duckdb
+{
+
+    // Canonical encodings of values inserted into the distinct counting
+    // sketches (HLL, CPC and Theta).  A sketch only stores hashes, so two
+    // engines agree on a count only if they hash the same bytes for a value:
+    //
+    //   * Integers hash by value as a 64-bit integer, which the library does
+    //     for every integer width.  DATE is its days and TIME, TIMESTAMP and
+    //     TIMESTAMP WITH TIME ZONE are their microseconds since the epoch (or
+    //     midnight).
+    //   * DECIMAL drops the trailing zeros of its fraction, so 1.5 and 1.50
+    //     agree.  A value that is then integral hashes like that integer;
+    //     any other hashes as its unscaled value in 16 bytes of two's
+    //     complement, little endian, followed by a byte holding the scale.
+    //   * HUGEINT and UHUGEINT values in the BIGINT (UBIGINT) range hash like
+    //     that type; wider values hash as 16 bytes of two's complement, little
+    //     endian.
+    //   * UUID hashes as its 16 bytes in RFC 4122 order, the order of its text.
+    //   * VARCHAR and BLOB hash their bytes, floating point values as the
+    //     library does.
+
+    // A UUID is stored as a hugeint_t with its top bit flipped, so it needs
+    // its own input type to be encoded differently from HUGEINT.
+    struct DSUuid
+    {
+        hugeint_t bits;
+
+        bool operator==(const DSUuid &other) const
+        {
+            return bits == other.bits;
+        }
+    };
+    static_assert(sizeof(DSUuid) == sizeof(hugeint_t), "DSUuid must have the layout of a UUID value");
+
+    // A DECIMAL is its unscaled integer of the physical type T.  The scale
+    // comes from the bind data, see DSBindDecimalInput.
+    template <class T>
+    struct DSDecimal
+    {
+        T unscaled;
+
+        bool operator==(const DSDecimal &other) const
+        {
+            return unscaled == other.unscaled;
+        }
+    };
+
+    static inline void DSStoreLittleEndian(uint64_t value, uint8_t *out)
+    {
+        for (idx_t i = 0; i < sizeof(uint64_t); i++)
+        {
+            out[i] = uint8_t(value >> (8 * i));
+        }
+    }
+
+    static inline void DSStoreBigEndian(uint64_t value, uint8_t *out)
+    {
+        for (idx_t i = 0; i < sizeof(uint64_t); i++)
+        {
+            out[i] = uint8_t(value >> (8 * (sizeof(uint64_t) - 1 - i)));
+        }
+    }
+
+    template <class SKETCH>
+    static inline void DSDistinctUpdateWide(SKETCH &sketch, uint64_t lower, uint64_t upper)
+    {
+        uint8_t bytes[16];
+        DSStoreLittleEndian(lower, bytes);
+        DSStoreLittleEndian(upper, bytes + 8);
+        sketch.update(bytes, sizeof(bytes));
+    }
+
+    template <class T>
+    struct DSIsDecimal : std::false_type
+    {
+    };
+
+    template <class T>
+    struct DSIsDecimal<DSDecimal<T>> : std::true_type
+    {
+    };
+
+    template <class SKETCH, class T>
+    static inline void DSDistinctUpdate(SKETCH &sketch, const T &value);
+
+    template <class SKETCH, class T>
+    static inline void DSDistinctUpdateDecimal(SKETCH &sketch, T unscaled, uint8_t scale)
+    {
+        while (scale > 0 && unscaled % T(10) == T(0))
+        {
+            unscaled /= T(10);
+            scale--;
+        }
+        if (scale == 0)
+        {
+            DSDistinctUpdate(sketch, unscaled);
+            return;
+        }
+        hugeint_t wide(unscaled);
+        uint8_t bytes[17];
+        DSStoreLittleEndian(wide.lower, bytes);
+        DSStoreLittleEndian(uint64_t(wide.upper), bytes + 8);
+        bytes[16] = scale;
+        sketch.update(bytes, sizeof(bytes));
+    }
+
+    // decimal_scale is only used for DECIMAL inputs.
+    template <class SKETCH, class T>
+    static inline void DSDistinctUpdate(SKETCH &sketch, const T &value, uint8_t decimal_scale)
+    {
+        if constexpr (DSIsDecimal<T>::value)
+        {
+            DSDistinctUpdateDecimal(sketch, value.unscaled, decimal_scale);
+        }
+        else
+        {
+            DSDistinctUpdate(sketch, value);
+        }
+    }
+
+    template <class SKETCH, class T>
+    static inline void DSDistinctUpdate(SKETCH &sketch, const T &value)
+    {
+        if constexpr (std::is_same_v<T, string_t>)
+        {
+            sketch.update(value.GetData(), value.GetSize());
+        }
+        else if constexpr (std::is_same_v<T, hugeint_t>)
+        {
+            const bool fits_bigint = (value.upper == 0 && value.lower <= uint64_t(NumericLimits<int64_t>::Maximum())) ||
+                                     (value.upper == -1 && value.lower > uint64_t(NumericLimits<int64_t>::Maximum()));
+            if (fits_bigint)
+            {
+                sketch.update(int64_t(value.lower));
+            }
+            else
+            {
+                DSDistinctUpdateWide(sketch, value.lower, uint64_t(value.upper));
+            }
+        }
+        else if constexpr (std::is_same_v<T, uhugeint_t>)
+        {
+            if (value.upper == 0)
+            {
+                sketch.update(value.lower);
+            }
+            else
+            {
+                DSDistinctUpdateWide(sketch, value.lower, value.upper);
+            }
+        }
+        else if constexpr (std::is_same_v<T, DSUuid>)
+        {
+            uint8_t bytes[16];
+            DSStoreBigEndian(uint64_t(value.bits.upper) ^ (uint64_t(1) << 63), bytes);
+            DSStoreBigEndian(value.bits.lower, bytes + 8);
+            sketch.update(bytes, sizeof(bytes));
+        }
+        else
+        {
+            sketch.update(value);
+        }
+    }
+
+    // DECIMAL is registered once for every width.  The bind swaps in the
+    // aggregate for the physical type of the actual argument, built by
+    // `create(tag, type, return_type)` where tag is a DSDecimal of that type,
+    // runs its bind and records the scale in its BIND_DATA.
+    template <class BIND_DATA, class CREATE>
+    static unique_ptr<FunctionData> DSBindDecimalInput(ClientContext &context, AggregateFunction &function,
+                                                      vector<unique_ptr<Expression>> &arguments, idx_t value_index,
+                                                      CREATE create)
+    {
+        auto decimal_type = arguments[value_index]->return_type;
+        auto name = function.name;
+        auto argument_types = function.arguments;
+        auto return_type = function.return_type;
+        argument_types[value_index] = decimal_type;
+        switch (decimal_type.InternalType())
+        {
+        case PhysicalType::INT16:
+            function = create(DSDecimal<int16_t>(), decimal_type, return_type);
+            break;
+        case PhysicalType::INT32:
+            function = create(DSDecimal<int32_t>(), decimal_type, return_type);
+            break;
+        case PhysicalType::INT64:
+            function = create(DSDecimal<int64_t>(), decimal_type, return_type);
+            break;
+        case PhysicalType::INT128:
+            function = create(DSDecimal<hugeint_t>(), decimal_type, return_type);
+            break;
+        default:
+            throw InternalException("Unsupported physical type for DECIMAL: %s", TypeIdToString(decimal_type.InternalType()));
+        }
+        function.name = name;
+        function.arguments = argument_types;
+        function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+        auto bind_data = function.bind(context, function, arguments);
+        bind_data->template Cast<BIND_DATA>().decimal_scale = DecimalType::GetScale(decimal_type);
+        return bind_data;
+    }
+
+} // namespace duckdb
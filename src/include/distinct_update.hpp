@@ -0,0 +1,141 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+
+#include <type_traits>
+
+namespace duckdb
+{
+
+    // Vector at a time updates for the distinct counting sketches (HLL, CPC
+    // and Theta).
+    //
+    // DataSketches hashes each value with MurmurHash3 inside update() and
+    // has no entry point that takes a precomputed hash, so the hashing stays
+    // in the library and the sketches stay interoperable by construction.
+    // What these updates save is the work around it: inserting a value
+    // into one of these sketches is idempotent, so a row that repeats the
+    // value of the previous row for the same state is skipped before it is
+    // hashed.  A constant vector is therefore inserted once, and runs of a
+    // value in sorted or clustered input cost a comparison each.
+    //
+    // An operation opts in with `static constexpr bool IDEMPOTENT = true`.
+
+    template <class OP, class = void>
+    struct DSIsIdempotent : std::false_type
+    {
+    };
+
+    template <class OP>
+    struct DSIsIdempotent<OP, std::void_t<decltype(OP::IDEMPOTENT)>> : std::bool_constant<OP::IDEMPOTENT>
+    {
+    };
+
+    template <class STATE, class INPUT_TYPE, class OP>
+    static void DSDistinctScatterUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                        Vector &states, idx_t count)
+    {
+        D_ASSERT(input_count == 1);
+        UnifiedVectorFormat input_format;
+        inputs[0].ToUnifiedFormat(count, input_format);
+        UnifiedVectorFormat state_format;
+        states.ToUnifiedFormat(count, state_format);
+        auto input_data = UnifiedVectorFormat::GetData<INPUT_TYPE>(input_format);
+        auto state_data = UnifiedVectorFormat::GetData<STATE *>(state_format);
+
+        AggregateUnaryInput unary_input(aggr_input_data, input_format.validity);
+        STATE *last_state = nullptr;
+        const INPUT_TYPE *last_value = nullptr;
+        for (idx_t i = 0; i < count; i++)
+        {
+            auto idx = input_format.sel->get_index(i);
+            if (!input_format.validity.RowIsValid(idx))
+            {
+                continue;
+            }
+            auto state = state_data[state_format.sel->get_index(i)];
+            auto &value = input_data[idx];
+            if (state == last_state && value == *last_value)
+            {
+                continue;
+            }
+            unary_input.input_idx = idx;
+            OP::template Operation<INPUT_TYPE, STATE, OP>(*state, value, unary_input);
+            last_state = state;
+            last_value = &value;
+        }
+    }
+
+    template <class STATE, class INPUT_TYPE, class OP>
+    static void DSDistinctSimpleUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                       data_ptr_t state_p, idx_t count)
+    {
+        D_ASSERT(input_count == 1);
+        UnifiedVectorFormat input_format;
+        inputs[0].ToUnifiedFormat(count, input_format);
+        auto input_data = UnifiedVectorFormat::GetData<INPUT_TYPE>(input_format);
+        auto &state = *reinterpret_cast<STATE *>(state_p);
+
+        AggregateUnaryInput unary_input(aggr_input_data, input_format.validity);
+        const INPUT_TYPE *last_value = nullptr;
+        for (idx_t i = 0; i < count; i++)
+        {
+            auto idx = input_format.sel->get_index(i);
+            if (!input_format.validity.RowIsValid(idx))
+            {
+                continue;
+            }
+            auto &value = input_data[idx];
+            if (last_value && value == *last_value)
+            {
+                continue;
+            }
+            unary_input.input_idx = idx;
+            OP::template Operation<INPUT_TYPE, STATE, OP>(state, value, unary_input);
+            last_value = &value;
+        }
+    }
+
+    // The update functions for an aggregate with one input column: the
+    // distinct updates above for idempotent operations, DuckDB's otherwise.
+    template <class STATE, class INPUT_TYPE, class OP>
+    static void DSUnaryScatterUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                     Vector &states, idx_t count)
+    {
+        if constexpr (DSIsIdempotent<OP>::value)
+        {
+            DSDistinctScatterUpdate<STATE, INPUT_TYPE, OP>(inputs, aggr_input_data, input_count, states, count);
+        }
+        else
+        {
+            AggregateFunction::UnaryScatterUpdate<STATE, INPUT_TYPE, OP>(inputs, aggr_input_data, input_count, states,
+                                                                        count);
+        }
+    }
+
+    template <class STATE, class INPUT_TYPE, class OP>
+    static void DSUnaryUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                              data_ptr_t state_p, idx_t count)
+    {
+        if constexpr (DSIsIdempotent<OP>::value)
+        {
+            DSDistinctSimpleUpdate<STATE, INPUT_TYPE, OP>(inputs, aggr_input_data, input_count, state_p, count);
+        }
+        else
+        {
+            AggregateFunction::UnaryUpdate<STATE, INPUT_TYPE, OP>(inputs, aggr_input_data, input_count, state_p, count);
+        }
+    }
+
+    // Installs the distinct updates on an aggregate built by
+    // AggregateFunction::UnaryAggregateDestructor.
+    template <class STATE, class INPUT_TYPE, class OP>
+    static void DSUseDistinctUpdate(AggregateFunction &function)
+    {
+        static_assert(DSIsIdempotent<OP>::value, "operation must be idempotent");
+        function.update = DSDistinctScatterUpdate<STATE, INPUT_TYPE, OP>;
+        function.simple_update = DSDistinctSimpleUpdate<STATE, INPUT_TYPE, OP>;
+    }
+
+} // namespace duckdb
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb
+{
+
+    // Layout of a serialized dense HLL sketch: a 40 byte preamble followed
+    // by the register array, which for HLL_8 is one byte per register.
+    constexpr uint8_t HLL_PREAMBLE_INTS = 10;
+    constexpr uint8_t HLL_SERIAL_VERSION = 1;
+    constexpr uint8_t HLL_FAMILY = 7;
+    constexpr idx_t HLL_LG_K_BYTE = 3;
+    constexpr idx_t HLL_FLAGS_BYTE = 5;
+    constexpr idx_t HLL_MODE_BYTE = 7;
+    constexpr idx_t HLL_REGISTERS_START = 40;
+    constexpr uint8_t HLL_MODE_HLL = 2;
+    constexpr uint8_t HLL_TYPE_HLL_8 = 2;
+
+    // Returns the registers of a serialized dense HLL_8 sketch with the given
+    // lg_k, or nullptr when the image is anything else.
+    const uint8_t *DSHLLDenseRegisters(const string_t &image, uint8_t lg_k);
+
+    // target[i] = max(target[i], source[i]), vectorized with AVX2, SSE2 or
+    // NEON depending on the CPU.
+    void DSHLLMaxRegisters(uint8_t *target, const uint8_t *source, idx_t count);
+
+    // Serializes HLL_8 registers as a dense sketch that DataSketches can
+    // deserialize. The sketch is marked out of order, as a union result is.
+    vector<uint8_t> DSHLLRegistersImage(const uint8_t *registers, uint8_t lg_k);
+
+} // namespace duckdb
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace duckdb
+{
+
+    // Calls func(data, size) with the bytes a Bloom filter or Count-Min
+    // sketch hashes for an item.  Integers of every width hash as BIGINT and
+    // FLOAT as DOUBLE, so a sketch built from one column can be probed with
+    // another of a different numeric type.  Values that are equal in SQL
+    // hash the same: -0.0 as 0.0 and every NaN as one NaN, so a probe never
+    // misses an item that was inserted.
+    template <class T, class FUNC>
+    static auto DSWithItemBytes(const T &item, FUNC &&func)
+    {
+        if constexpr (std::is_same_v<T, string_t>)
+        {
+            return func(item.GetData(), item.GetSize());
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            double value = item;
+            if (value == 0.0)
+            {
+                value = 0.0;
+            }
+            else if (std::isnan(value))
+            {
+                value = std::numeric_limits<double>::quiet_NaN();
+            }
+            return func(&value, sizeof(value));
+        }
+        else
+        {
+            int64_t value = (int64_t)item;
+            return func(&value, sizeof(value));
+        }
+    }
+
+} // namespace duckdb
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb
+{
+
+    // Combine for the aggregate states of Theta and tuple sketches.
+    //
+    // A state holds an update sketch while it consumes rows and a union once
+    // other states have been merged into it.  On the first merge the target's
+    // own update sketch moves into a new union, so that combining many states
+    // (for example the nodes of a window segment tree) does not rebuild a
+    // compact sketch after every merge.
+    //
+    // STATE must have update_sketch and union_sketch pointers and a
+    // CreateUnionSketch(uint8_t lg_k) that allocates the union.
+    template <class STATE>
+    static void DSSetSketchCombine(const STATE &source, STATE &target, uint8_t lg_k)
+    {
+        if (!source.update_sketch && !source.union_sketch)
+            return;
+
+        if (!target.union_sketch)
+        {
+            target.CreateUnionSketch(lg_k);
+            if (target.update_sketch)
+            {
+                target.union_sketch->update(*target.update_sketch);
+                delete target.update_sketch;
+                target.update_sketch = nullptr;
+            }
+        }
+        if (source.update_sketch)
+            target.union_sketch->update(*source.update_sketch);
+        // The union does not need the entries ordered, so skip sorting them.
+        if (source.union_sketch)
+            target.union_sketch->update(source.union_sketch->get_result(false));
+    }
+
+} // namespace duckdb
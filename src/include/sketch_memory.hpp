@@ -0,0 +1,172 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace duckdb
+{
+
+    // Accounts for the memory held by sketches in aggregate states.
+    //
+    // Sketch memory is allocated by the DataSketches library rather than by
+    // DuckDB, so it is reserved with the buffer manager of the database that
+    // runs the query in coarse chunks.  That makes it count against that
+    // database's memory_limit, lets DuckDB evict buffers or fail the query
+    // cleanly before the process runs out of memory, and shows it in
+    // duckdb_memory() under the EXTENSION tag.
+    //
+    // The aggregate callbacks run under a DSMemoryScope naming the accounts
+    // of the query's database and connection, and every allocation records
+    // them so that it is released against the same accounts on whichever
+    // thread frees it.  Sketches built outside an aggregate, by scalar
+    // functions, are short lived and not accounted for.
+
+    // Sketch memory of one database, kept in its object cache.
+    class DSMemoryAccount : public ObjectCacheEntry
+    {
+    public:
+        explicit DSMemoryAccount(DatabaseInstance &db);
+        ~DSMemoryAccount() override;
+
+        static shared_ptr<DSMemoryAccount> Get(DatabaseInstance &db);
+
+        static string ObjectType()
+        {
+            return "datasketches_memory_account";
+        }
+        string GetObjectType() override
+        {
+            return ObjectType();
+        }
+        // Not a cache: the account must live as long as the database.
+        optional_idx GetEstimatedCacheMemory() const
+        {
+            return optional_idx();
+        }
+
+        void Allocate(idx_t bytes);
+        void Free(idx_t bytes) noexcept;
+
+        idx_t GetAllocated() const;
+        idx_t GetPeak() const;
+
+    private:
+        void ReserveUpTo(idx_t target);
+        void ReleaseUnused() noexcept;
+
+        weak_ptr<DatabaseInstance> db;
+        std::atomic<idx_t> allocated_bytes{0};
+        std::atomic<idx_t> peak_bytes{0};
+
+        std::mutex reservation_lock;
+        // Guarded by reservation_lock.
+        idx_t reserved_bytes = 0;
+        // Copy of reserved_bytes for the lock free checks.
+        std::atomic<idx_t> reserved_hint{0};
+    };
+
+    // Sketch memory of the queries of one connection.
+    class DSQueryMemory
+    {
+    public:
+        void Allocate(idx_t bytes);
+        void Free(idx_t bytes) noexcept;
+
+        // Starts a new high-water mark at the bytes currently held.
+        void ResetPeak();
+        idx_t GetPeak() const;
+
+    private:
+        std::atomic<idx_t> allocated_bytes{0};
+        std::atomic<idx_t> peak_bytes{0};
+    };
+
+    // Base of the bind data of every sketch aggregate.  DSTrackedBind fills
+    // in the accounts of the binding connection and keeps the aggregate's own
+    // callbacks here, replacing them with ones that run under a DSMemoryScope.
+    // Derived bind data must copy it along, e.g. with its copy constructor.
+    struct DSSketchBindData : public FunctionData
+    {
+        shared_ptr<DSMemoryAccount> memory_account;
+        shared_ptr<DSQueryMemory> query_memory;
+
+        aggregate_update_t update = nullptr;
+        aggregate_simple_update_t simple_update = nullptr;
+        aggregate_combine_t combine = nullptr;
+        aggregate_finalize_t finalize = nullptr;
+    };
+
+    // Charges the allocations of the calling thread to the accounts of a
+    // sketch aggregate until the scope ends.
+    class DSMemoryScope
+    {
+    public:
+        explicit DSMemoryScope(const DSSketchBindData &bind_data);
+        ~DSMemoryScope();
+
+    private:
+        DSMemoryAccount *previous_account;
+        DSQueryMemory *previous_query;
+    };
+
+    void DSTrackSketchMemory(ClientContext &context, AggregateFunction &function, DSSketchBindData &bind_data);
+
+    // Wraps the bind function of a sketch aggregate, whose bind data must
+    // derive from DSSketchBindData, so that its memory is accounted for.
+    template <bind_aggregate_function_t BIND>
+    unique_ptr<FunctionData> DSTrackedBind(ClientContext &context, AggregateFunction &function,
+                                           vector<unique_ptr<Expression>> &arguments)
+    {
+        auto bind_data = BIND(context, function, arguments);
+        DSTrackSketchMemory(context, function, bind_data->template Cast<DSSketchBindData>());
+        return bind_data;
+    }
+
+    void *DSMemoryAllocate(idx_t bytes);
+    void DSMemoryFree(void *pointer, idx_t bytes) noexcept;
+
+    // Stateless allocator handed to the DataSketches templates so that every
+    // allocation they make on behalf of a sketch is tracked.
+    template <class T>
+    class DSTrackingAllocator
+    {
+    public:
+        using value_type = T;
+
+        DSTrackingAllocator() noexcept = default;
+
+        template <class U>
+        DSTrackingAllocator(const DSTrackingAllocator<U> &) noexcept
+        {
+        }
+
+        T *allocate(std::size_t n)
+        {
+            return static_cast<T *>(DSMemoryAllocate(n * sizeof(T)));
+        }
+
+        void deallocate(T *p, std::size_t n) noexcept
+        {
+            DSMemoryFree(p, n * sizeof(T));
+        }
+    };
+
+    template <class T, class U>
+    bool operator==(const DSTrackingAllocator<T> &, const DSTrackingAllocator<U> &) noexcept
+    {
+        return true;
+    }
+
+    template <class T, class U>
+    bool operator!=(const DSTrackingAllocator<T> &, const DSTrackingAllocator<U> &) noexcept
+    {
+        return false;
+    }
+
+} // namespace duckdb
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/storage/statistics/list_stats.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+
+namespace duckdb
+{
+
+    // Statistics callbacks for scalar results whose range follows from the
+    // function alone: ranks and CDF values lie in [0, 1] and estimates are
+    // never negative.  This lets the optimizer fold or prune filters on them
+    // at plan time.
+    //
+    // A sketch blob carries no statistics of the column it was built from,
+    // so results such as quantiles and min/max items cannot be bounded here.
+
+    static BaseStatistics DSRangeStatistics(const LogicalType &type, const Value &min, const Value &max)
+    {
+        auto stats = NumericStats::CreateUnknown(type);
+        if (!min.IsNull())
+        {
+            NumericStats::SetMin(stats, min.DefaultCastAs(type));
+        }
+        if (!max.IsNull())
+        {
+            NumericStats::SetMax(stats, max.DefaultCastAs(type));
+        }
+        return stats;
+    }
+
+    static unique_ptr<BaseStatistics> DSNonNegativeStatistics(ClientContext &context, FunctionStatisticsInput &input)
+    {
+        return DSRangeStatistics(input.expr.return_type, Value::DOUBLE(0), Value()).ToUnique();
+    }
+
+    static unique_ptr<BaseStatistics> DSUnitIntervalStatistics(ClientContext &context, FunctionStatisticsInput &input)
+    {
+        return DSRangeStatistics(input.expr.return_type, Value::DOUBLE(0), Value::DOUBLE(1)).ToUnique();
+    }
+
+    static unique_ptr<BaseStatistics> DSUnitIntervalListStatistics(ClientContext &context, FunctionStatisticsInput &input)
+    {
+        auto &type = input.expr.return_type;
+        auto &child_type = ListType::GetChildType(type);
+        if (!child_type.IsNumeric())
+        {
+            return nullptr;
+        }
+        auto stats = ListStats::CreateUnknown(type);
+        ListStats::SetChildStats(stats, DSRangeStatistics(child_type, Value::DOUBLE(0), Value::DOUBLE(1)).ToUnique());
+        return stats.ToUnique();
+    }
+
+    static unique_ptr<BaseStatistics> DSHLLLgConfigKStatistics(ClientContext &context, FunctionStatisticsInput &input)
+    {
+        return DSRangeStatistics(input.expr.return_type, Value::UTINYINT(4), Value::UTINYINT(21)).ToUnique();
+    }
+
+    static ScalarFunction DSWithStatistics(ScalarFunction function, function_statistics_t statistics)
+    {
+        function.statistics = statistics;
+        return function;
+    }
+
+} // namespace duckdb
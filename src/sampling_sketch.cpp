@@ -0,0 +1,857 @@
+#include "datasketches_extension.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_aggregate_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_type_info.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+#include <DataSketches/var_opt_sketch.hpp>
+#include <DataSketches/var_opt_union.hpp>
+#include <DataSketches/ebpps_sketch.hpp>
+#include <cmath>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+
+#include "sketch_memory.hpp"
+
+namespace duckdb
+{
+    namespace
+    {
+        // Sketches held in aggregate states allocate through the tracking allocator.
+        using VarOptStateSketch = datasketches::var_opt_sketch<std::string, DSTrackingAllocator<std::string>>;
+        using VarOptStateUnion = datasketches::var_opt_union<std::string, DSTrackingAllocator<std::string>>;
+        using VarOptSketch = datasketches::var_opt_sketch<std::string>;
+        using EbppsStateSketch = datasketches::ebpps_sketch<std::string, DSTrackingAllocator<std::string>>;
+        using EbppsSketch = datasketches::ebpps_sketch<std::string>;
+
+        // Sampling sketches keep a bounded, mergeable sample of the items with
+        // a weight each, from which sums over any subset of the items can be
+        // estimated later.  Items are kept as their text, as in the Frequent
+        // Items sketch, so one sketch type serves every input type.
+
+        // ============================================================
+        // 1. Helpers & Bind Data
+        // ============================================================
+        struct DSSamplingBindData : public DSSketchBindData
+        {
+            explicit DSSamplingBindData(uint32_t k) : k(k) {}
+            unique_ptr<FunctionData> Copy() const override { return make_uniq<DSSamplingBindData>(*this); }
+            bool Equals(const FunctionData &other_p) const override
+            {
+                return k == other_p.Cast<DSSamplingBindData>().k;
+            }
+            // 0 when merging without k: the k of the first sketch is used.
+            uint32_t k;
+        };
+
+        unique_ptr<FunctionData> DSSamplingBindWithK(ClientContext &context, AggregateFunction &function,
+                                                     vector<unique_ptr<Expression>> &arguments)
+        {
+            if (arguments[0]->HasParameter())
+                throw ParameterNotResolvedException();
+            if (!arguments[0]->IsFoldable())
+                throw BinderException("Sampling sketch k must be constant");
+            Value k_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+            if (k_val.IsNull())
+                throw BinderException("Sampling sketch k cannot be NULL");
+            auto k = k_val.GetValue<int64_t>();
+            if (k < 1 || k >= NumericLimits<int32_t>::Maximum())
+                throw InvalidInputException("Sampling sketch k must be between 1 and %d, got: %d",
+                                            NumericLimits<int32_t>::Maximum() - 1, k);
+            Function::EraseArgument(function, arguments, 0);
+            return make_uniq<DSSamplingBindData>((uint32_t)k);
+        }
+
+        unique_ptr<FunctionData> DSSamplingBindDefault(ClientContext &context, AggregateFunction &function,
+                                                       vector<unique_ptr<Expression>> &arguments)
+        {
+            return make_uniq<DSSamplingBindData>(0);
+        }
+
+        template <class T>
+        static std::string DSSampleItem(const T &item)
+        {
+            if constexpr (std::is_same_v<T, string_t>)
+            {
+                return item.GetString();
+            }
+            else
+            {
+                return Value::CreateValue(item).ToString();
+            }
+        }
+
+        static void DSCheckSampleWeight(double weight, const char *sketch_name)
+        {
+            if (!(weight >= 0) || std::isinf(weight))
+                throw InvalidInputException("%s weight must be non-negative and finite, got: %f", sketch_name, weight);
+        }
+
+        static VarOptSketch DSVarOptDeserialize(const string_t &blob)
+        {
+            try
+            {
+                return VarOptSketch::deserialize(blob.GetDataUnsafe(), blob.GetSize());
+            }
+            catch (const std::exception &e)
+            {
+                throw InvalidInputException("Failed to deserialize VarOpt sketch: %s", e.what());
+            }
+        }
+
+        static EbppsSketch DSEbppsDeserialize(const string_t &blob)
+        {
+            try
+            {
+                return EbppsSketch::deserialize(blob.GetDataUnsafe(), blob.GetSize());
+            }
+            catch (const std::exception &e)
+            {
+                throw InvalidInputException("Failed to deserialize EBPPS sketch: %s", e.what());
+            }
+        }
+
+        template <class SKETCH>
+        static string_t DSSamplingSerialize(Vector &result, const SKETCH &sketch)
+        {
+            auto serialized = sketch.serialize();
+            return StringVector::AddStringOrBlob(result, std::string(serialized.begin(), serialized.end()));
+        }
+
+        // Appends the (item, weight) pairs of a sample as the list of row i.
+        template <class SKETCH>
+        static void DSAppendSamples(Vector &result, idx_t row, const SKETCH &sketch)
+        {
+            auto offset = ListVector::GetListSize(result);
+            idx_t length = 0;
+            for (auto it = sketch.begin(); it != sketch.end(); ++it)
+                length++;
+            ListVector::Reserve(result, offset + length);
+
+            auto &child = ListVector::GetEntry(result);
+            auto &fields = StructVector::GetEntries(child);
+            auto items = FlatVector::GetData<string_t>(*fields[0]);
+            auto weights = FlatVector::GetData<double>(*fields[1]);
+            idx_t position = offset;
+            for (const auto &sample : sketch)
+            {
+                items[position] = StringVector::AddString(*fields[0], sample.first);
+                weights[position] = sample.second;
+                position++;
+            }
+
+            auto entries = FlatVector::GetData<list_entry_t>(result);
+            entries[row].offset = offset;
+            entries[row].length = length;
+            ListVector::SetListSize(result, offset + length);
+        }
+
+        // ============================================================
+        // 2. State & Operations
+        // ============================================================
+
+        // Holds a sketch while consuming rows and a union once other states
+        // or stored sketches have been merged into it.
+        struct DSVarOptState
+        {
+            VarOptStateSketch *sketch = nullptr;
+            VarOptStateUnion *union_sketch = nullptr;
+            // k of the sketch, or the maximum k of the union.
+            uint32_t k = 0;
+
+            ~DSVarOptState()
+            {
+                if (sketch)
+                    delete sketch;
+                if (union_sketch)
+                    delete union_sketch;
+            }
+
+            void CreateSketch(uint32_t k_p)
+            {
+                if (!sketch)
+                {
+                    sketch = new VarOptStateSketch(k_p);
+                    k = k_p;
+                }
+            }
+
+            // The union takes the k given to the aggregate, or else the
+            // largest k of the sketches merged into it, whatever order they
+            // arrive in.
+            void CreateUnion(uint32_t k_p)
+            {
+                if (union_sketch)
+                {
+                    if (k_p <= k)
+                        return;
+                    // A larger sample arrived: carry what was merged so far
+                    // into a union of its k.
+                    auto grown = new VarOptStateUnion(k_p);
+                    grown->update(union_sketch->get_result());
+                    delete union_sketch;
+                    union_sketch = grown;
+                    k = k_p;
+                    return;
+                }
+                union_sketch = new VarOptStateUnion(k_p);
+                k = k_p;
+                if (sketch)
+                {
+                    union_sketch->update(*sketch);
+                    delete sketch;
+                    sketch = nullptr;
+                }
+            }
+        };
+
+        struct DSVarOptOperationBase
+        {
+            template <class STATE>
+            static void Initialize(STATE &state)
+            {
+                state.sketch = nullptr;
+                state.union_sketch = nullptr;
+                state.k = 0;
+            }
+            template <class STATE>
+            static void Destroy(STATE &state, AggregateInputData &)
+            {
+                if (state.sketch)
+                    delete state.sketch;
+                if (state.union_sketch)
+                    delete state.union_sketch;
+            }
+            static bool IgnoreNull() { return true; }
+
+            template <class STATE, class OP>
+            static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data)
+            {
+                if (!source.sketch && !source.union_sketch)
+                    return;
+                auto &bind_data = aggr_input_data.bind_data->template Cast<DSSamplingBindData>();
+                target.CreateUnion(bind_data.k ? bind_data.k : source.k);
+                if (source.sketch)
+                    target.union_sketch->update(*source.sketch);
+                if (source.union_sketch)
+                    target.union_sketch->update(source.union_sketch->get_result());
+            }
+
+            template <class T, class STATE>
+            static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data)
+            {
+                if (state.union_sketch)
+                {
+                    target = DSSamplingSerialize(finalize_data.result, state.union_sketch->get_result());
+                }
+                else if (state.sketch)
+                {
+                    target = DSSamplingSerialize(finalize_data.result, *state.sketch);
+                }
+                else
+                {
+                    auto &bind_data = finalize_data.input.bind_data->template Cast<DSSamplingBindData>();
+                    if (!bind_data.k)
+                    {
+                        // Merging no sketches: k is unknown.
+                        finalize_data.ReturnNull();
+                        return;
+                    }
+                    target = DSSamplingSerialize(finalize_data.result, VarOptStateSketch(bind_data.k));
+                }
+            }
+
+            template <class ITEM_TYPE, class STATE>
+            static void Update(STATE &state, const ITEM_TYPE &item, double weight, const DSSamplingBindData &bind_data)
+            {
+                if (state.union_sketch)
+                {
+                    // Rows after a merge go through a one-row sketch.
+                    VarOptStateSketch row(bind_data.k);
+                    row.update(DSSampleItem(item), weight);
+                    state.union_sketch->update(row);
+                    return;
+                }
+                state.CreateSketch(bind_data.k);
+                state.sketch->update(DSSampleItem(item), weight);
+            }
+        };
+
+        // Uniform reservoir sample: every row has weight 1.
+        struct DSReservoirOperation : DSVarOptOperationBase
+        {
+            template <class A_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &input, AggregateUnaryInput &idata)
+            {
+                auto &bind_data = idata.input.bind_data->template Cast<DSSamplingBindData>();
+                Update(state, input, 1.0, bind_data);
+            }
+
+            template <class INPUT_TYPE, class STATE, class OP>
+            static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t count)
+            {
+                for (idx_t i = 0; i < count; i++)
+                {
+                    Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+                }
+            }
+        };
+
+        struct DSVarOptOperation : DSVarOptOperationBase
+        {
+            template <class A_TYPE, class B_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &input, const B_TYPE &weight, AggregateBinaryInput &idata)
+            {
+                DSCheckSampleWeight(weight, "VarOpt");
+                auto &bind_data = idata.input.bind_data->template Cast<DSSamplingBindData>();
+                Update(state, input, weight, bind_data);
+            }
+        };
+
+        struct DSVarOptMergeOperation : DSVarOptOperationBase
+        {
+            template <class A_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &input, AggregateUnaryInput &idata)
+            {
+                auto &bind_data = idata.input.bind_data->template Cast<DSSamplingBindData>();
+                auto sketch = [&]()
+                {
+                    try
+                    {
+                        return VarOptStateSketch::deserialize(input.GetDataUnsafe(), input.GetSize());
+                    }
+                    catch (const std::exception &e)
+                    {
+                        throw InvalidInputException("Failed to deserialize VarOpt sketch: %s", e.what());
+                    }
+                }();
+                state.CreateUnion(bind_data.k ? bind_data.k : sketch.get_k());
+                state.union_sketch->update(sketch);
+            }
+
+            template <class INPUT_TYPE, class STATE, class OP>
+            static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t count)
+            {
+                for (idx_t i = 0; i < count; i++)
+                {
+                    Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+                }
+            }
+        };
+
+        // EBPPS sketches merge directly, so the state needs no union.
+        struct DSEbppsState
+        {
+            EbppsStateSketch *sketch = nullptr;
+
+            ~DSEbppsState()
+            {
+                if (sketch)
+                    delete sketch;
+            }
+
+            void Merge(const EbppsStateSketch &other)
+            {
+                if (!sketch)
+                    sketch = new EbppsStateSketch(other);
+                else
+                    sketch->merge(other);
+            }
+        };
+
+        struct DSEbppsOperationBase
+        {
+            template <class STATE>
+            static void Initialize(STATE &state)
+            {
+                state.sketch = nullptr;
+            }
+            template <class STATE>
+            static void Destroy(STATE &state, AggregateInputData &)
+            {
+                if (state.sketch)
+                    delete state.sketch;
+            }
+            static bool IgnoreNull() { return true; }
+
+            template <class STATE, class OP>
+            static void Combine(const STATE &source, STATE &target, AggregateInputData &)
+            {
+                if (source.sketch)
+                    target.Merge(*source.sketch);
+            }
+
+            template <class T, class STATE>
+            static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data)
+            {
+                if (state.sketch)
+                {
+                    target = DSSamplingSerialize(finalize_data.result, *state.sketch);
+                    return;
+                }
+                auto &bind_data = finalize_data.input.bind_data->template Cast<DSSamplingBindData>();
+                if (!bind_data.k)
+                {
+                    // Merging no sketches: k is unknown.
+                    finalize_data.ReturnNull();
+                    return;
+                }
+                target = DSSamplingSerialize(finalize_data.result, EbppsStateSketch(bind_data.k));
+            }
+        };
+
+        struct DSEbppsOperation : DSEbppsOperationBase
+        {
+            template <class A_TYPE, class B_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &input, const B_TYPE &weight, AggregateBinaryInput &idata)
+            {
+                DSCheckSampleWeight(weight, "EBPPS");
+                auto &bind_data = idata.input.bind_data->template Cast<DSSamplingBindData>();
+                if (!state.sketch)
+                    state.sketch = new EbppsStateSketch(bind_data.k);
+                state.sketch->update(DSSampleItem(input), weight);
+            }
+        };
+
+        struct DSEbppsMergeOperation : DSEbppsOperationBase
+        {
+            template <class A_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &input, AggregateUnaryInput &)
+            {
+                auto sketch = [&]()
+                {
+                    try
+                    {
+                        return EbppsStateSketch::deserialize(input.GetDataUnsafe(), input.GetSize());
+                    }
+                    catch (const std::exception &e)
+                    {
+                        throw InvalidInputException("Failed to deserialize EBPPS sketch: %s", e.what());
+                    }
+                }();
+                state.Merge(sketch);
+            }
+
+            template <class INPUT_TYPE, class STATE, class OP>
+            static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t count)
+            {
+                for (idx_t i = 0; i < count; i++)
+                {
+                    Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+                }
+            }
+        };
+
+        // ============================================================
+        // 3. Scalar Functions
+        // ============================================================
+        static void DSVarOptSamples(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat sketch_data;
+            args.data[0].ToUnifiedFormat(count, sketch_data);
+            auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_data);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+                DSAppendSamples(result, i, DSVarOptDeserialize(sketch_entries[sketch_idx]));
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
+        // Estimated total weight of the items in the list, with bounds at
+        // two standard deviations, from the sample alone.
+        static void DSVarOptEstimateSubsetSum(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat sketch_data;
+            args.data[0].ToUnifiedFormat(count, sketch_data);
+            auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_data);
+            UnifiedVectorFormat list_data;
+            args.data[1].ToUnifiedFormat(count, list_data);
+            auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(list_data);
+            auto &child = ListVector::GetEntry(args.data[1]);
+            UnifiedVectorFormat child_data;
+            child.ToUnifiedFormat(ListVector::GetListSize(args.data[1]), child_data);
+            auto child_entries = UnifiedVectorFormat::GetData<string_t>(child_data);
+            auto &struct_entries = StructVector::GetEntries(result);
+
+            std::unordered_set<std::string> subset;
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                idx_t list_idx = list_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx) || !list_data.validity.RowIsValid(list_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+
+                subset.clear();
+                auto &entry = list_entries[list_idx];
+                for (idx_t j = 0; j < entry.length; j++)
+                {
+                    auto child_idx = child_data.sel->get_index(entry.offset + j);
+                    if (child_data.validity.RowIsValid(child_idx))
+                        subset.insert(child_entries[child_idx].GetString());
+                }
+
+                auto sketch = DSVarOptDeserialize(sketch_entries[sketch_idx]);
+                auto summary = sketch.estimate_subset_sum([&](const std::string &item)
+                                                          { return subset.count(item) > 0; });
+                FlatVector::GetData<double>(*struct_entries[0])[i] = summary.estimate;
+                FlatVector::GetData<double>(*struct_entries[1])[i] = summary.lower_bound;
+                FlatVector::GetData<double>(*struct_entries[2])[i] = summary.upper_bound;
+                FlatVector::GetData<double>(*struct_entries[3])[i] = summary.total_sketch_weight;
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
+        static void DSVarOptSummary(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat sketch_data;
+            args.data[0].ToUnifiedFormat(count, sketch_data);
+            auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_data);
+            auto &struct_entries = StructVector::GetEntries(result);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+
+                auto sketch = DSVarOptDeserialize(sketch_entries[sketch_idx]);
+                FlatVector::GetData<bool>(*struct_entries[0])[i] = sketch.is_empty();
+                FlatVector::GetData<int64_t>(*struct_entries[1])[i] = (int64_t)sketch.get_k();
+                FlatVector::GetData<int64_t>(*struct_entries[2])[i] = (int64_t)sketch.get_n();
+                FlatVector::GetData<int64_t>(*struct_entries[3])[i] = (int64_t)sketch.get_num_samples();
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
+        // The sample has get_c() items in expectation: every whole item, and
+        // the partial item with probability equal to its fraction, drawn on
+        // each call.
+        static void DSEbppsSamples(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat sketch_data;
+            args.data[0].ToUnifiedFormat(count, sketch_data);
+            auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_data);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+
+                auto sample = DSEbppsDeserialize(sketch_entries[sketch_idx]).get_result();
+                auto offset = ListVector::GetListSize(result);
+                ListVector::Reserve(result, offset + sample.size());
+                auto &child = ListVector::GetEntry(result);
+                auto items = FlatVector::GetData<string_t>(child);
+                for (idx_t j = 0; j < sample.size(); j++)
+                {
+                    items[offset + j] = StringVector::AddString(child, sample[j]);
+                }
+                auto entries = FlatVector::GetData<list_entry_t>(result);
+                entries[i].offset = offset;
+                entries[i].length = sample.size();
+                ListVector::SetListSize(result, offset + sample.size());
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
+        static void DSEbppsSummary(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat sketch_data;
+            args.data[0].ToUnifiedFormat(count, sketch_data);
+            auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_data);
+            auto &struct_entries = StructVector::GetEntries(result);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+
+                auto sketch = DSEbppsDeserialize(sketch_entries[sketch_idx]);
+                FlatVector::GetData<bool>(*struct_entries[0])[i] = sketch.is_empty();
+                FlatVector::GetData<int64_t>(*struct_entries[1])[i] = (int64_t)sketch.get_k();
+                FlatVector::GetData<int64_t>(*struct_entries[2])[i] = (int64_t)sketch.get_n();
+                FlatVector::GetData<double>(*struct_entries[3])[i] = sketch.get_c();
+                FlatVector::GetData<double>(*struct_entries[4])[i] = sketch.get_cumulative_weight();
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
+        // ============================================================
+        // 4. Registration Helpers
+        // ============================================================
+        static LogicalType CreateSamplingSketchType(ExtensionLoader &loader, const string &new_type_name, const string &comment)
+        {
+            auto new_type = LogicalType(LogicalTypeId::BLOB);
+            auto type_info = CreateTypeInfo(new_type_name, LogicalType::BLOB);
+            type_info.temporary = false;
+            type_info.internal = true;
+            type_info.comment = comment;
+            new_type.SetAlias(new_type_name);
+
+            auto &system_catalog = Catalog::GetSystemCatalog(loader.GetDatabaseInstance());
+            auto data = CatalogTransaction::GetSystemTransaction(loader.GetDatabaseInstance());
+            system_catalog.CreateType(data, type_info);
+
+            loader.RegisterCastFunction(LogicalType::BLOB, new_type, DefaultCasts::ReinterpretCast, 1);
+            loader.RegisterCastFunction(new_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast, 1);
+            return new_type;
+        }
+
+        static LogicalType SampleListType()
+        {
+            child_list_t<LogicalType> struct_fields;
+            struct_fields.push_back({"item", LogicalType::VARCHAR});
+            struct_fields.push_back({"weight", LogicalType::DOUBLE});
+            return LogicalType::LIST(LogicalType::STRUCT(struct_fields));
+        }
+
+        template <typename T>
+        void RegisterVarOpt(AggregateFunctionSet &varopt, AggregateFunctionSet &reservoir, const LogicalType &input_type,
+                            const LogicalType &sketch_type)
+        {
+            auto fun = AggregateFunction::BinaryAggregate<DSVarOptState, T, double, string_t, DSVarOptOperation, AggregateDestructorType::LEGACY>(
+                input_type, LogicalType::DOUBLE, sketch_type);
+            fun.destructor = AggregateFunction::StateDestroy<DSVarOptState, DSVarOptOperation>;
+            fun.bind = DSTrackedBind<DSSamplingBindWithK>;
+            fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            fun.arguments = {LogicalType::INTEGER, input_type, LogicalType::DOUBLE};
+            varopt.AddFunction(fun);
+
+            auto fun_reservoir = AggregateFunction::UnaryAggregateDestructor<DSVarOptState, T, string_t, DSReservoirOperation, AggregateDestructorType::LEGACY>(
+                input_type, sketch_type);
+            fun_reservoir.bind = DSTrackedBind<DSSamplingBindWithK>;
+            fun_reservoir.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            fun_reservoir.arguments = {LogicalType::INTEGER, input_type};
+            reservoir.AddFunction(fun_reservoir);
+        }
+
+        template <typename T>
+        void RegisterEbpps(AggregateFunctionSet &set, const LogicalType &input_type, const LogicalType &sketch_type)
+        {
+            auto fun = AggregateFunction::BinaryAggregate<DSEbppsState, T, double, string_t, DSEbppsOperation, AggregateDestructorType::LEGACY>(
+                input_type, LogicalType::DOUBLE, sketch_type);
+            fun.destructor = AggregateFunction::StateDestroy<DSEbppsState, DSEbppsOperation>;
+            fun.bind = DSTrackedBind<DSSamplingBindWithK>;
+            fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            fun.arguments = {LogicalType::INTEGER, input_type, LogicalType::DOUBLE};
+            set.AddFunction(fun);
+        }
+    }
+
+    // ============================================================
+    // 5. Main Loader
+    // ============================================================
+    static void LoadEbppsSketch(ExtensionLoader &loader)
+    {
+        auto sketch_type = CreateSamplingSketchType(loader, "sketch_ebpps", "Sketch type for EBPPS Sampling Sketch");
+
+        AggregateFunctionSet ebpps_agg("datasketch_ebpps");
+        // NOTE: Not for BLOB - it conflicts with the sketch merge operation.
+        RegisterEbpps<int8_t>(ebpps_agg, LogicalType::TINYINT, sketch_type);
+        RegisterEbpps<int16_t>(ebpps_agg, LogicalType::SMALLINT, sketch_type);
+        RegisterEbpps<int32_t>(ebpps_agg, LogicalType::INTEGER, sketch_type);
+        RegisterEbpps<int64_t>(ebpps_agg, LogicalType::BIGINT, sketch_type);
+        RegisterEbpps<uint8_t>(ebpps_agg, LogicalType::UTINYINT, sketch_type);
+        RegisterEbpps<uint16_t>(ebpps_agg, LogicalType::USMALLINT, sketch_type);
+        RegisterEbpps<uint32_t>(ebpps_agg, LogicalType::UINTEGER, sketch_type);
+        RegisterEbpps<uint64_t>(ebpps_agg, LogicalType::UBIGINT, sketch_type);
+        RegisterEbpps<float>(ebpps_agg, LogicalType::FLOAT, sketch_type);
+        RegisterEbpps<double>(ebpps_agg, LogicalType::DOUBLE, sketch_type);
+        RegisterEbpps<string_t>(ebpps_agg, LogicalType::VARCHAR, sketch_type);
+
+        auto fun_merge = AggregateFunction::UnaryAggregateDestructor<DSEbppsState, string_t, string_t, DSEbppsMergeOperation, AggregateDestructorType::LEGACY>(
+            sketch_type, sketch_type);
+        fun_merge.bind = DSTrackedBind<DSSamplingBindDefault>;
+        fun_merge.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+        ebpps_agg.AddFunction(fun_merge);
+
+        {
+            CreateAggregateFunctionInfo info(ebpps_agg);
+            FunctionDescription desc;
+            desc.description = "Creates an EBPPS sample of at most k items, each included with probability proportional to its weight, or merges such samples";
+            desc.examples.push_back("datasketch_ebpps(1000, event_id, weight)");
+            desc.examples.push_back("datasketch_ebpps(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            ScalarFunction fun("datasketch_ebpps_samples", {sketch_type}, LogicalType::LIST(LogicalType::VARCHAR),
+                               DSEbppsSamples);
+            // The partial item is drawn at random on every call, so calls
+            // must not be folded or deduplicated.
+            fun.stability = FunctionStability::VOLATILE;
+            CreateScalarFunctionInfo info(fun);
+            FunctionDescription desc;
+            desc.description = "Draws the sample: every whole item, and the partial item with probability equal to its fraction";
+            desc.examples.push_back("datasketch_ebpps_samples(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            child_list_t<LogicalType> struct_fields;
+            struct_fields.push_back({"is_empty", LogicalType::BOOLEAN});
+            struct_fields.push_back({"k", LogicalType::BIGINT});
+            struct_fields.push_back({"n", LogicalType::BIGINT});
+            struct_fields.push_back({"c", LogicalType::DOUBLE});
+            struct_fields.push_back({"cumulative_weight", LogicalType::DOUBLE});
+
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_ebpps_summary",
+                                                         {sketch_type}, LogicalType::STRUCT(struct_fields), DSEbppsSummary));
+            FunctionDescription desc;
+            desc.description = "Returns a struct of k, the number of items seen, the expected sample size c and the total weight seen";
+            desc.examples.push_back("datasketch_ebpps_summary(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+    }
+
+    void LoadSamplingSketches(ExtensionLoader &loader)
+    {
+        auto sketch_type = CreateSamplingSketchType(loader, "sketch_varopt", "Sketch type for VarOpt and Reservoir Sampling Sketch");
+
+        AggregateFunctionSet varopt_agg("datasketch_varopt");
+        AggregateFunctionSet reservoir_agg("datasketch_reservoir");
+
+        // NOTE: Not for BLOB - it conflicts with the sketch merge operation.
+        RegisterVarOpt<int8_t>(varopt_agg, reservoir_agg, LogicalType::TINYINT, sketch_type);
+        RegisterVarOpt<int16_t>(varopt_agg, reservoir_agg, LogicalType::SMALLINT, sketch_type);
+        RegisterVarOpt<int32_t>(varopt_agg, reservoir_agg, LogicalType::INTEGER, sketch_type);
+        RegisterVarOpt<int64_t>(varopt_agg, reservoir_agg, LogicalType::BIGINT, sketch_type);
+        RegisterVarOpt<uint8_t>(varopt_agg, reservoir_agg, LogicalType::UTINYINT, sketch_type);
+        RegisterVarOpt<uint16_t>(varopt_agg, reservoir_agg, LogicalType::USMALLINT, sketch_type);
+        RegisterVarOpt<uint32_t>(varopt_agg, reservoir_agg, LogicalType::UINTEGER, sketch_type);
+        RegisterVarOpt<uint64_t>(varopt_agg, reservoir_agg, LogicalType::UBIGINT, sketch_type);
+        RegisterVarOpt<float>(varopt_agg, reservoir_agg, LogicalType::FLOAT, sketch_type);
+        RegisterVarOpt<double>(varopt_agg, reservoir_agg, LogicalType::DOUBLE, sketch_type);
+        RegisterVarOpt<string_t>(varopt_agg, reservoir_agg, LogicalType::VARCHAR, sketch_type);
+
+        {
+            CreateAggregateFunctionInfo info(varopt_agg);
+            FunctionDescription desc;
+            desc.description = "Creates a VarOpt sample of at most k weighted items, from which subset sums can be estimated";
+            desc.examples.push_back("datasketch_varopt(1024, product_id, revenue)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateAggregateFunctionInfo info(reservoir_agg);
+            FunctionDescription desc;
+            desc.description = "Creates a uniform reservoir sample of at most k items";
+            desc.examples.push_back("datasketch_reservoir(1024, user_id)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            AggregateFunctionSet set("datasketch_varopt_union");
+            auto fun_merge = AggregateFunction::UnaryAggregateDestructor<DSVarOptState, string_t, string_t, DSVarOptMergeOperation, AggregateDestructorType::LEGACY>(
+                sketch_type, sketch_type);
+            fun_merge.bind = DSTrackedBind<DSSamplingBindDefault>;
+            fun_merge.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            set.AddFunction(fun_merge);
+            fun_merge.bind = DSTrackedBind<DSSamplingBindWithK>;
+            fun_merge.arguments = {LogicalType::INTEGER, sketch_type};
+            set.AddFunction(fun_merge);
+
+            CreateAggregateFunctionInfo info(set);
+            FunctionDescription desc;
+            desc.description = "Merges VarOpt or reservoir samples into a sample of at most k items (default: the k of the first sample)";
+            desc.examples.push_back("datasketch_varopt_union(sketch)");
+            desc.examples.push_back("datasketch_varopt_union(1024, sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+
+        // --- SCALAR FUNCTIONS ---
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_varopt_samples", {sketch_type}, SampleListType(), DSVarOptSamples));
+            FunctionDescription desc;
+            desc.description = "Returns the sampled items with their adjusted weights";
+            desc.examples.push_back("datasketch_varopt_samples(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            child_list_t<LogicalType> struct_fields;
+            struct_fields.push_back({"estimate", LogicalType::DOUBLE});
+            struct_fields.push_back({"lower_bound", LogicalType::DOUBLE});
+            struct_fields.push_back({"upper_bound", LogicalType::DOUBLE});
+            struct_fields.push_back({"total_sketch_weight", LogicalType::DOUBLE});
+
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_varopt_estimate_subset_sum",
+                                                         {sketch_type, LogicalType::LIST(LogicalType::VARCHAR)},
+                                                         LogicalType::STRUCT(struct_fields), DSVarOptEstimateSubsetSum));
+            FunctionDescription desc;
+            desc.description = "Returns the estimated total weight of the listed items, with bounds at two standard deviations";
+            desc.examples.push_back("datasketch_varopt_estimate_subset_sum(sketch, ['a', 'b'])");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            child_list_t<LogicalType> struct_fields;
+            struct_fields.push_back({"is_empty", LogicalType::BOOLEAN});
+            struct_fields.push_back({"k", LogicalType::BIGINT});
+            struct_fields.push_back({"n", LogicalType::BIGINT});
+            struct_fields.push_back({"num_samples", LogicalType::BIGINT});
+
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_varopt_summary",
+                                                         {sketch_type}, LogicalType::STRUCT(struct_fields), DSVarOptSummary));
+            FunctionDescription desc;
+            desc.description = "Returns a struct of k, the number of items seen and the number of samples kept";
+            desc.examples.push_back("datasketch_varopt_summary(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+
+        LoadEbppsSketch(loader);
+    }
+
+}
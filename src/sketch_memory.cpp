@@ -0,0 +1,387 @@
+#include "sketch_memory.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace duckdb
+{
+    namespace
+    {
+        // ============================================================
+        // 1. Helpers
+        // ============================================================
+
+        // Reservations are made with the buffer manager in chunks of this
+        // size, and only handed back once more than two chunks are unused,
+        // so that the allocator's fast path stays a pair of atomics.
+        constexpr idx_t RESERVATION_CHUNK = 1ULL << 20;
+        constexpr idx_t NO_RESERVATION = NumericLimits<idx_t>::Maximum();
+
+        constexpr const char *MEMORY_ACCOUNT_KEY = "datasketches_memory_account";
+        constexpr const char *MEMORY_STATE_KEY = "datasketches_memory";
+
+        idx_t RoundUpToChunk(idx_t bytes)
+        {
+            return (bytes + RESERVATION_CHUNK - 1) / RESERVATION_CHUNK * RESERVATION_CHUNK;
+        }
+
+        void UpdateMaximum(std::atomic<idx_t> &target, idx_t value)
+        {
+            auto current = target.load(std::memory_order_relaxed);
+            while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        // Every tracked block starts with the accounts it was charged to, so
+        // that it is released against them on whichever thread frees it.
+        struct DSMemoryHeader
+        {
+            DSMemoryAccount *account;
+            DSQueryMemory *query;
+        };
+
+        // Keeps the returned blocks aligned like those of operator new.
+        constexpr idx_t HEADER_SIZE = AlignValue<idx_t, alignof(std::max_align_t)>(sizeof(DSMemoryHeader));
+
+        thread_local DSMemoryAccount *current_account = nullptr;
+        thread_local DSQueryMemory *current_query = nullptr;
+
+        // ============================================================
+        // 2. Per connection state
+        // ============================================================
+
+        class DSMemoryQueryState : public ClientContextState
+        {
+        public:
+            void QueryBegin(ClientContext &context) override
+            {
+                memory->ResetPeak();
+            }
+
+            void QueryEnd(ClientContext &context) override
+            {
+                last_query_peak = memory->GetPeak();
+            }
+
+            shared_ptr<DSQueryMemory> memory = make_shared_ptr<DSQueryMemory>();
+            idx_t last_query_peak = 0;
+        };
+
+        // ============================================================
+        // 3. Scoped aggregate callbacks
+        // ============================================================
+
+        void DSTrackedUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count, Vector &states,
+                             idx_t count)
+        {
+            auto &bind_data = aggr_input_data.bind_data->Cast<DSSketchBindData>();
+            DSMemoryScope scope(bind_data);
+            bind_data.update(inputs, aggr_input_data, input_count, states, count);
+        }
+
+        void DSTrackedSimpleUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                   data_ptr_t state, idx_t count)
+        {
+            auto &bind_data = aggr_input_data.bind_data->Cast<DSSketchBindData>();
+            DSMemoryScope scope(bind_data);
+            bind_data.simple_update(inputs, aggr_input_data, input_count, state, count);
+        }
+
+        void DSTrackedCombine(Vector &state, Vector &combined, AggregateInputData &aggr_input_data, idx_t count)
+        {
+            auto &bind_data = aggr_input_data.bind_data->Cast<DSSketchBindData>();
+            DSMemoryScope scope(bind_data);
+            bind_data.combine(state, combined, aggr_input_data, count);
+        }
+
+        void DSTrackedFinalize(Vector &state, AggregateInputData &aggr_input_data, Vector &result, idx_t count,
+                               idx_t offset)
+        {
+            auto &bind_data = aggr_input_data.bind_data->Cast<DSSketchBindData>();
+            DSMemoryScope scope(bind_data);
+            bind_data.finalize(state, aggr_input_data, result, count, offset);
+        }
+
+        // ============================================================
+        // 4. Scalar Functions
+        // ============================================================
+
+        static void DSMemory(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            auto &context = state.GetContext();
+            auto account = DSMemoryAccount::Get(DatabaseInstance::GetDatabase(context));
+
+            idx_t last_query_peak = 0;
+            auto query_state = context.registered_state->Get<DSMemoryQueryState>(MEMORY_STATE_KEY);
+            if (query_state)
+            {
+                last_query_peak = query_state->last_query_peak;
+            }
+
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            auto &struct_entries = StructVector::GetEntries(result);
+            ConstantVector::GetData<uint64_t>(*struct_entries[0])[0] = account->GetAllocated();
+            ConstantVector::GetData<uint64_t>(*struct_entries[1])[0] = account->GetPeak();
+            ConstantVector::GetData<uint64_t>(*struct_entries[2])[0] = last_query_peak;
+        }
+    } // namespace
+
+    // ============================================================
+    // DSMemoryAccount
+    // ============================================================
+
+    DSMemoryAccount::DSMemoryAccount(DatabaseInstance &db) : db(db.shared_from_this())
+    {
+    }
+
+    DSMemoryAccount::~DSMemoryAccount()
+    {
+        auto database = db.lock();
+        if (database && reserved_bytes > 0)
+        {
+            BufferManager::GetBufferManager(*database).FreeReservedMemory(reserved_bytes);
+        }
+    }
+
+    shared_ptr<DSMemoryAccount> DSMemoryAccount::Get(DatabaseInstance &db)
+    {
+        return db.GetObjectCache().GetOrCreate<DSMemoryAccount>(MEMORY_ACCOUNT_KEY, db);
+    }
+
+    void DSMemoryAccount::Allocate(idx_t bytes)
+    {
+        auto now = allocated_bytes.fetch_add(bytes) + bytes;
+        if (now > reserved_hint.load())
+        {
+            try
+            {
+                ReserveUpTo(now);
+            }
+            catch (...)
+            {
+                allocated_bytes.fetch_sub(bytes);
+                throw;
+            }
+        }
+        UpdateMaximum(peak_bytes, now);
+    }
+
+    void DSMemoryAccount::Free(idx_t bytes) noexcept
+    {
+        auto now = allocated_bytes.fetch_sub(bytes) - bytes;
+        auto hint = reserved_hint.load();
+        if (hint != NO_RESERVATION && hint > now + 2 * RESERVATION_CHUNK)
+        {
+            ReleaseUnused();
+        }
+    }
+
+    idx_t DSMemoryAccount::GetAllocated() const
+    {
+        return allocated_bytes.load(std::memory_order_relaxed);
+    }
+
+    idx_t DSMemoryAccount::GetPeak() const
+    {
+        return peak_bytes.load(std::memory_order_relaxed);
+    }
+
+    void DSMemoryAccount::ReserveUpTo(idx_t target)
+    {
+        std::lock_guard<std::mutex> guard(reservation_lock);
+        auto database = db.lock();
+        if (!database)
+        {
+            reserved_bytes = 0;
+            reserved_hint = NO_RESERVATION;
+            return;
+        }
+        if (target <= reserved_bytes)
+        {
+            return;
+        }
+        auto extra = RoundUpToChunk(target - reserved_bytes);
+        // Evicts buffers to make room, or throws an OutOfMemoryException
+        // when memory_limit cannot accommodate the sketches.
+        BufferManager::GetBufferManager(*database).ReserveMemory(extra);
+        reserved_bytes += extra;
+        reserved_hint = reserved_bytes;
+    }
+
+    void DSMemoryAccount::ReleaseUnused() noexcept
+    {
+        std::lock_guard<std::mutex> guard(reservation_lock);
+        auto database = db.lock();
+        if (!database)
+        {
+            reserved_bytes = 0;
+            reserved_hint = NO_RESERVATION;
+            return;
+        }
+        // The target is taken under the lock, so allocations made since the
+        // caller's Free are not handed back.  Lowering the hint before
+        // reading allocated_bytes again closes the remaining window: an
+        // Allocate either counted its bytes before that read, or it sees the
+        // lowered hint and waits on the lock to reserve them.
+        auto keep = RoundUpToChunk(allocated_bytes.load());
+        if (reserved_bytes <= keep + RESERVATION_CHUNK)
+        {
+            return;
+        }
+        reserved_hint = keep;
+        keep = std::max(keep, RoundUpToChunk(allocated_bytes.load()));
+        if (reserved_bytes > keep + RESERVATION_CHUNK)
+        {
+            BufferManager::GetBufferManager(*database).FreeReservedMemory(reserved_bytes - keep);
+            reserved_bytes = keep;
+        }
+        reserved_hint = reserved_bytes;
+    }
+
+    // ============================================================
+    // DSQueryMemory
+    // ============================================================
+
+    void DSQueryMemory::Allocate(idx_t bytes)
+    {
+        auto now = allocated_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        UpdateMaximum(peak_bytes, now);
+    }
+
+    void DSQueryMemory::Free(idx_t bytes) noexcept
+    {
+        allocated_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    void DSQueryMemory::ResetPeak()
+    {
+        peak_bytes = allocated_bytes.load(std::memory_order_relaxed);
+    }
+
+    idx_t DSQueryMemory::GetPeak() const
+    {
+        return peak_bytes.load(std::memory_order_relaxed);
+    }
+
+    // ============================================================
+    // Scopes and allocation
+    // ============================================================
+
+    DSMemoryScope::DSMemoryScope(const DSSketchBindData &bind_data)
+        : previous_account(current_account), previous_query(current_query)
+    {
+        current_account = bind_data.memory_account.get();
+        current_query = bind_data.query_memory.get();
+    }
+
+    DSMemoryScope::~DSMemoryScope()
+    {
+        current_account = previous_account;
+        current_query = previous_query;
+    }
+
+    void DSTrackSketchMemory(ClientContext &context, AggregateFunction &function, DSSketchBindData &bind_data)
+    {
+        if (bind_data.memory_account)
+        {
+            // Already tracked by a bind function this one delegated to.
+            return;
+        }
+        bind_data.memory_account = DSMemoryAccount::Get(DatabaseInstance::GetDatabase(context));
+        bind_data.query_memory =
+            context.registered_state->GetOrCreate<DSMemoryQueryState>(MEMORY_STATE_KEY)->memory;
+
+        bind_data.update = function.update;
+        bind_data.simple_update = function.simple_update;
+        bind_data.combine = function.combine;
+        bind_data.finalize = function.finalize;
+        if (function.update)
+        {
+            function.update = DSTrackedUpdate;
+        }
+        if (function.simple_update)
+        {
+            function.simple_update = DSTrackedSimpleUpdate;
+        }
+        if (function.combine)
+        {
+            function.combine = DSTrackedCombine;
+        }
+        if (function.finalize)
+        {
+            function.finalize = DSTrackedFinalize;
+        }
+    }
+
+    void *DSMemoryAllocate(idx_t bytes)
+    {
+        auto account = current_account;
+        auto query = current_query;
+        if (account)
+        {
+            account->Allocate(bytes);
+        }
+        void *block;
+        try
+        {
+            block = ::operator new(HEADER_SIZE + bytes);
+        }
+        catch (...)
+        {
+            if (account)
+            {
+                account->Free(bytes);
+            }
+            throw;
+        }
+        if (query)
+        {
+            query->Allocate(bytes);
+        }
+        auto header = static_cast<DSMemoryHeader *>(block);
+        header->account = account;
+        header->query = query;
+        return static_cast<data_ptr_t>(block) + HEADER_SIZE;
+    }
+
+    void DSMemoryFree(void *pointer, idx_t bytes) noexcept
+    {
+        auto block = static_cast<data_ptr_t>(pointer) - HEADER_SIZE;
+        auto header = reinterpret_cast<DSMemoryHeader *>(block);
+        if (header->query)
+        {
+            header->query->Free(bytes);
+        }
+        if (header->account)
+        {
+            header->account->Free(bytes);
+        }
+        ::operator delete(block);
+    }
+
+    void LoadSketchMemory(ExtensionLoader &loader)
+    {
+        child_list_t<LogicalType> struct_fields;
+        struct_fields.push_back({"allocated_bytes", LogicalType::UBIGINT});
+        struct_fields.push_back({"peak_bytes", LogicalType::UBIGINT});
+        struct_fields.push_back({"last_query_peak_bytes", LogicalType::UBIGINT});
+
+        ScalarFunction fun("datasketch_memory", {}, LogicalType::STRUCT(struct_fields), DSMemory);
+        fun.stability = FunctionStability::VOLATILE;
+        CreateScalarFunctionInfo info(fun);
+        FunctionDescription desc;
+        desc.description = "Returns the bytes currently held by sketches in this database's aggregate states, their peak since the database was opened, and the peak during this connection's previous query";
+        desc.examples.push_back("datasketch_memory()");
+        info.descriptions.push_back(desc);
+        loader.RegisterFunction(info);
+    }
+
+} // namespace duckdb
@@ -0,0 +1,743 @@
+#include "datasketches_extension.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "hll_registers.hpp"
+
+#include <cstring>
+#include <string>
+
+namespace duckdb
+{
+    namespace
+    {
+        // ============================================================
+        // 1. Block Format
+        // ============================================================
+        //
+        // A packed block stores many serialized sketches of one family:
+        //
+        //   magic        uint32    "DSPK"
+        //   version      uint8
+        //   family       uint8     family id shared by every entry
+        //   offset_bits  uint8     width of each offset below
+        //   reserved     uint8
+        //   count        uint32
+        //   shared       8 bytes   preamble of the first entry
+        //   validity     1 bit per entry, set when the entry is not NULL
+        //   offsets      count + 1 bit packed offsets into the entry data
+        //   entry data
+        //
+        // Every entry starts with its codec and original length, then a mask
+        // of the shared preamble bytes it differs in followed by those bytes,
+        // then the codec payload for the rest of the image.  The offsets give
+        // random access to single entries and unpacking restores the original
+        // bytes exactly.
+
+        constexpr uint32_t PACK_MAGIC = 0x4B505344;
+        constexpr uint8_t PACK_VERSION = 1;
+        constexpr idx_t SHARED_PREAMBLE_SIZE = 8;
+        constexpr idx_t PACK_HEADER_SIZE = 12 + SHARED_PREAMBLE_SIZE;
+
+        // Every DataSketches image carries its family id in the third byte.
+        constexpr idx_t FAMILY_BYTE = 2;
+        constexpr uint8_t THETA_FAMILY = 3;
+
+        enum class PackCodec : uint8_t
+        {
+            RAW = 0,
+            // Ordered hashes of a compact theta sketch as Rice coded gaps.
+            THETA_HASHES = 1,
+            // Registers of a dense HLL_8 sketch at 6 bits each.
+            HLL8_REGISTERS = 2,
+        };
+
+        // Compact theta sketch, serial version 3.
+        constexpr uint8_t THETA_SERIAL_VERSION = 3;
+        constexpr uint8_t THETA_FLAG_COMPACT = 1 << 3;
+        constexpr uint8_t THETA_FLAG_ORDERED = 1 << 4;
+
+        // Dense HLL_8 registers never exceed 63.
+        constexpr idx_t HLL8_REGISTER_BITS = 6;
+
+        [[noreturn]] void ThrowCorrupt(const string &what)
+        {
+            throw InvalidInputException("Invalid packed sketch block: " + what);
+        }
+
+        // ============================================================
+        // 2. Bit and Byte Streams
+        // ============================================================
+
+        uint64_t LowBits(uint64_t value, idx_t bits)
+        {
+            return bits == 64 ? value : value & ((uint64_t(1) << bits) - 1);
+        }
+
+        class BitWriter
+        {
+        public:
+            explicit BitWriter(std::string &out) : out(out) {}
+
+            void Write(uint64_t value, idx_t bits)
+            {
+                if (bits > 32)
+                {
+                    Write(value, 32);
+                    Write(value >> 32, bits - 32);
+                    return;
+                }
+                buffer |= LowBits(value, bits) << filled;
+                filled += bits;
+                while (filled >= 8)
+                {
+                    out.push_back(char(buffer & 0xFF));
+                    buffer >>= 8;
+                    filled -= 8;
+                }
+            }
+
+            void WriteUnary(uint64_t value)
+            {
+                for (; value >= 32; value -= 32)
+                {
+                    Write(0xFFFFFFFF, 32);
+                }
+                Write((uint64_t(1) << value) - 1, value);
+                Write(0, 1);
+            }
+
+            void Flush()
+            {
+                if (filled)
+                {
+                    out.push_back(char(buffer & 0xFF));
+                    buffer = 0;
+                    filled = 0;
+                }
+            }
+
+        private:
+            std::string &out;
+            uint64_t buffer = 0;
+            idx_t filled = 0;
+        };
+
+        class BitReader
+        {
+        public:
+            BitReader(const_data_ptr_t data, idx_t size) : data(data), size(size) {}
+
+            uint64_t Read(idx_t bits)
+            {
+                if (bits > 32)
+                {
+                    auto low = Read(32);
+                    return low | (Read(bits - 32) << 32);
+                }
+                while (filled < bits)
+                {
+                    if (pos >= size)
+                    {
+                        ThrowCorrupt("bit stream is truncated");
+                    }
+                    buffer |= uint64_t(data[pos++]) << filled;
+                    filled += 8;
+                }
+                auto result = LowBits(buffer, bits);
+                buffer >>= bits;
+                filled -= bits;
+                return result;
+            }
+
+            uint64_t ReadUnary()
+            {
+                uint64_t result = 0;
+                while (Read(1))
+                {
+                    result++;
+                }
+                return result;
+            }
+
+            // Bytes consumed, including a partially read last byte.
+            idx_t BytesRead() const
+            {
+                return pos;
+            }
+
+        private:
+            const_data_ptr_t data;
+            idx_t size;
+            idx_t pos = 0;
+            uint64_t buffer = 0;
+            idx_t filled = 0;
+        };
+
+        class ByteReader
+        {
+        public:
+            ByteReader(const_data_ptr_t data, idx_t size) : data(data), size(size) {}
+
+            uint8_t ReadByte()
+            {
+                Require(1);
+                return data[pos++];
+            }
+
+            const_data_ptr_t ReadBytes(idx_t count)
+            {
+                Require(count);
+                auto result = data + pos;
+                pos += count;
+                return result;
+            }
+
+            uint64_t ReadVarint()
+            {
+                uint64_t result = 0;
+                for (idx_t shift = 0; shift < 64; shift += 7)
+                {
+                    auto byte = ReadByte();
+                    result |= uint64_t(byte & 0x7F) << shift;
+                    if (!(byte & 0x80))
+                    {
+                        return result;
+                    }
+                }
+                ThrowCorrupt("varint is too long");
+            }
+
+            const_data_ptr_t Current() const
+            {
+                return data + pos;
+            }
+
+            idx_t Remaining() const
+            {
+                return size - pos;
+            }
+
+            void Skip(idx_t count)
+            {
+                Require(count);
+                pos += count;
+            }
+
+        private:
+            void Require(idx_t count) const
+            {
+                if (size - pos < count)
+                {
+                    ThrowCorrupt("entry is truncated");
+                }
+            }
+
+            const_data_ptr_t data;
+            idx_t size;
+            idx_t pos = 0;
+        };
+
+        void WriteVarint(std::string &out, uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                out.push_back(char((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            out.push_back(char(value));
+        }
+
+        template <class T>
+        void WriteRaw(std::string &out, T value)
+        {
+            char buffer[sizeof(T)];
+            Store<T>(value, data_ptr_cast(buffer));
+            out.append(buffer, sizeof(T));
+        }
+
+        idx_t BitWidth(uint64_t value)
+        {
+            idx_t bits = 0;
+            while (value)
+            {
+                bits++;
+                value >>= 1;
+            }
+            return bits;
+        }
+
+        // ============================================================
+        // 3. Entry Codecs
+        // ============================================================
+
+        bool EncodeThetaHashes(const_data_ptr_t data, idx_t size, std::string &out)
+        {
+            if (size < 16 || data[1] != THETA_SERIAL_VERSION)
+            {
+                return false;
+            }
+            idx_t preamble_longs = data[0] & 0x3F;
+            auto flags = data[5];
+            if (preamble_longs < 2 || !(flags & THETA_FLAG_COMPACT) || !(flags & THETA_FLAG_ORDERED))
+            {
+                return false;
+            }
+            idx_t num_entries = Load<uint32_t>(data + 8);
+            auto hashes_start = preamble_longs * 8;
+            if (num_entries == 0 || size != hashes_start + num_entries * sizeof(uint64_t))
+            {
+                return false;
+            }
+
+            auto hashes = data + hashes_start;
+            uint64_t last = 0;
+            for (idx_t i = 0; i < num_entries; i++)
+            {
+                auto hash = Load<uint64_t>(hashes + i * sizeof(uint64_t));
+                if (i > 0 && hash <= last)
+                {
+                    return false;
+                }
+                last = hash;
+            }
+
+            // Hashes are uniform below theta, so the gaps are close to
+            // geometric and Rice coding with the mean gap is near optimal.
+            auto rice_bits = BitWidth(last / num_entries);
+            rice_bits = rice_bits ? rice_bits - 1 : 0;
+            idx_t encoded_bits = 0;
+            uint64_t previous = 0;
+            for (idx_t i = 0; i < num_entries; i++)
+            {
+                auto hash = Load<uint64_t>(hashes + i * sizeof(uint64_t));
+                auto quotient = (hash - previous) >> rice_bits;
+                if (quotient >= 64)
+                {
+                    return false;
+                }
+                encoded_bits += quotient + 1 + rice_bits;
+                previous = hash;
+            }
+            if (encoded_bits >= num_entries * 64)
+            {
+                return false;
+            }
+
+            out.append(const_char_ptr_cast(data + SHARED_PREAMBLE_SIZE), hashes_start - SHARED_PREAMBLE_SIZE);
+            out.push_back(char(rice_bits));
+            BitWriter writer(out);
+            previous = 0;
+            for (idx_t i = 0; i < num_entries; i++)
+            {
+                auto hash = Load<uint64_t>(hashes + i * sizeof(uint64_t));
+                auto gap = hash - previous;
+                writer.WriteUnary(gap >> rice_bits);
+                writer.Write(gap, rice_bits);
+                previous = hash;
+            }
+            writer.Flush();
+            return true;
+        }
+
+        void DecodeThetaHashes(ByteReader &reader, std::string &out)
+        {
+            idx_t preamble_longs = uint8_t(out[0]) & 0x3F;
+            if (preamble_longs < 2)
+            {
+                ThrowCorrupt("invalid theta preamble");
+            }
+            auto hashes_start = preamble_longs * 8;
+            out.append(const_char_ptr_cast(reader.ReadBytes(hashes_start - SHARED_PREAMBLE_SIZE)),
+                       hashes_start - SHARED_PREAMBLE_SIZE);
+            idx_t num_entries = Load<uint32_t>(const_data_ptr_cast(out.data()) + 8);
+            auto rice_bits = reader.ReadByte();
+            if (rice_bits >= 64)
+            {
+                ThrowCorrupt("invalid theta hash coding");
+            }
+
+            BitReader bits(reader.Current(), reader.Remaining());
+            uint64_t hash = 0;
+            for (idx_t i = 0; i < num_entries; i++)
+            {
+                auto quotient = bits.ReadUnary();
+                hash += (quotient << rice_bits) | bits.Read(rice_bits);
+                WriteRaw<uint64_t>(out, hash);
+            }
+            reader.Skip(bits.BytesRead());
+        }
+
+        bool EncodeHLL8Registers(const_data_ptr_t data, idx_t size, std::string &out)
+        {
+            if (size < HLL_REGISTERS_START || data[0] != HLL_PREAMBLE_INTS)
+            {
+                return false;
+            }
+            auto mode = data[HLL_MODE_BYTE];
+            if ((mode & 0x3) != HLL_MODE_HLL || ((mode >> 2) & 0x3) != HLL_TYPE_HLL_8)
+            {
+                return false;
+            }
+            auto lg_k = data[HLL_LG_K_BYTE];
+            if (lg_k > 26 || size != HLL_REGISTERS_START + (idx_t(1) << lg_k))
+            {
+                return false;
+            }
+            auto registers = data + HLL_REGISTERS_START;
+            auto num_registers = idx_t(1) << lg_k;
+            for (idx_t i = 0; i < num_registers; i++)
+            {
+                if (registers[i] >> HLL8_REGISTER_BITS)
+                {
+                    return false;
+                }
+            }
+
+            out.append(const_char_ptr_cast(data + SHARED_PREAMBLE_SIZE), HLL_REGISTERS_START - SHARED_PREAMBLE_SIZE);
+            BitWriter writer(out);
+            for (idx_t i = 0; i < num_registers; i++)
+            {
+                writer.Write(registers[i], HLL8_REGISTER_BITS);
+            }
+            writer.Flush();
+            return true;
+        }
+
+        void DecodeHLL8Registers(ByteReader &reader, std::string &out)
+        {
+            out.append(const_char_ptr_cast(reader.ReadBytes(HLL_REGISTERS_START - SHARED_PREAMBLE_SIZE)),
+                       HLL_REGISTERS_START - SHARED_PREAMBLE_SIZE);
+            auto lg_k = uint8_t(out[HLL_LG_K_BYTE]);
+            if (lg_k > 26)
+            {
+                ThrowCorrupt("invalid HLL register count");
+            }
+            auto num_registers = idx_t(1) << lg_k;
+            BitReader bits(reader.Current(), reader.Remaining());
+            for (idx_t i = 0; i < num_registers; i++)
+            {
+                out.push_back(char(bits.Read(HLL8_REGISTER_BITS)));
+            }
+            reader.Skip(bits.BytesRead());
+        }
+
+        void EncodeEntry(const string_t &image, const_data_ptr_t shared, std::string &out)
+        {
+            auto data = const_data_ptr_cast(image.GetData());
+            auto size = image.GetSize();
+            auto preamble_size = MinValue<idx_t>(size, SHARED_PREAMBLE_SIZE);
+
+            auto codec_pos = out.size();
+            out.push_back(char(PackCodec::RAW));
+            WriteVarint(out, size);
+
+            uint8_t differs = 0;
+            for (idx_t i = 0; i < preamble_size; i++)
+            {
+                if (data[i] != shared[i])
+                {
+                    differs |= uint8_t(1) << i;
+                }
+            }
+            out.push_back(char(differs));
+            for (idx_t i = 0; i < preamble_size; i++)
+            {
+                if (differs & (uint8_t(1) << i))
+                {
+                    out.push_back(char(data[i]));
+                }
+            }
+
+            auto payload_pos = out.size();
+            auto family = size > FAMILY_BYTE ? data[FAMILY_BYTE] : 0;
+            if (family == THETA_FAMILY && EncodeThetaHashes(data, size, out))
+            {
+                out[codec_pos] = char(PackCodec::THETA_HASHES);
+                return;
+            }
+            out.resize(payload_pos);
+            if (family == HLL_FAMILY && EncodeHLL8Registers(data, size, out))
+            {
+                out[codec_pos] = char(PackCodec::HLL8_REGISTERS);
+                return;
+            }
+            out.resize(payload_pos);
+            out.append(const_char_ptr_cast(data + preamble_size), size - preamble_size);
+        }
+
+        std::string DecodeEntry(const_data_ptr_t data, idx_t size, const_data_ptr_t shared)
+        {
+            ByteReader reader(data, size);
+            auto codec = PackCodec(reader.ReadByte());
+            auto original_size = reader.ReadVarint();
+            auto preamble_size = MinValue<idx_t>(original_size, SHARED_PREAMBLE_SIZE);
+
+            if (codec != PackCodec::RAW && original_size < SHARED_PREAMBLE_SIZE)
+            {
+                ThrowCorrupt("entry is too small for its codec");
+            }
+
+            std::string out;
+            auto differs = reader.ReadByte();
+            for (idx_t i = 0; i < preamble_size; i++)
+            {
+                out.push_back(char(differs & (uint8_t(1) << i) ? reader.ReadByte() : shared[i]));
+            }
+
+            switch (codec)
+            {
+            case PackCodec::RAW:
+                out.append(const_char_ptr_cast(reader.ReadBytes(original_size - preamble_size)), original_size - preamble_size);
+                break;
+            case PackCodec::THETA_HASHES:
+                DecodeThetaHashes(reader, out);
+                break;
+            case PackCodec::HLL8_REGISTERS:
+                DecodeHLL8Registers(reader, out);
+                break;
+            default:
+                ThrowCorrupt("unknown entry codec");
+            }
+            if (out.size() != original_size)
+            {
+                ThrowCorrupt("entry size does not match its header");
+            }
+            return out;
+        }
+
+        // ============================================================
+        // 4. Packed Block Reader
+        // ============================================================
+
+        class PackedBlock
+        {
+        public:
+            explicit PackedBlock(const string_t &block)
+                : data(const_data_ptr_cast(block.GetData())), size(block.GetSize())
+            {
+                if (size < PACK_HEADER_SIZE || Load<uint32_t>(data) != PACK_MAGIC)
+                {
+                    ThrowCorrupt("unrecognized header");
+                }
+                if (data[4] != PACK_VERSION)
+                {
+                    ThrowCorrupt("unsupported version " + std::to_string(data[4]));
+                }
+                offset_bits = data[6];
+                count = Load<uint32_t>(data + 8);
+                auto validity_size = (count + 7) / 8;
+                auto offsets_size = ((count + 1) * offset_bits + 7) / 8;
+                if (offset_bits == 0 || offset_bits > 64 || size - PACK_HEADER_SIZE < validity_size + offsets_size)
+                {
+                    ThrowCorrupt("size does not match its header");
+                }
+                shared = data + 12;
+                validity = data + PACK_HEADER_SIZE;
+                offsets = validity + validity_size;
+                entries = offsets + offsets_size;
+            }
+
+            idx_t Count() const
+            {
+                return count;
+            }
+
+            bool IsValid(idx_t index) const
+            {
+                return validity[index / 8] & (1 << (index % 8));
+            }
+
+            std::string Decode(idx_t index) const
+            {
+                auto start = Offset(index);
+                auto end = Offset(index + 1);
+                idx_t entries_size = data + size - entries;
+                if (start > end || end > entries_size)
+                {
+                    ThrowCorrupt("entry offsets are out of range");
+                }
+                return DecodeEntry(entries + start, end - start, shared);
+            }
+
+        private:
+            uint64_t Offset(idx_t index) const
+            {
+                auto bit_pos = index * offset_bits;
+                BitReader reader(offsets + bit_pos / 8, entries - offsets - bit_pos / 8);
+                reader.Read(bit_pos % 8);
+                return reader.Read(offset_bits);
+            }
+
+            const_data_ptr_t data;
+            idx_t size;
+            idx_t offset_bits;
+            idx_t count;
+            const_data_ptr_t shared;
+            const_data_ptr_t validity;
+            const_data_ptr_t offsets;
+            const_data_ptr_t entries;
+        };
+
+        // ============================================================
+        // 5. Scalar Functions
+        // ============================================================
+
+        static void DSPack(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            auto &list_vector = args.data[0];
+            auto &child_vector = ListVector::GetEntry(list_vector);
+            UnifiedVectorFormat child_format;
+            child_vector.ToUnifiedFormat(ListVector::GetListSize(list_vector), child_format);
+            auto child_data = UnifiedVectorFormat::GetData<string_t>(child_format);
+
+            UnaryExecutor::Execute<list_entry_t, string_t>(
+                list_vector, result, args.size(),
+                [&](list_entry_t list)
+                {
+                    uint8_t shared[SHARED_PREAMBLE_SIZE] = {};
+                    uint8_t family = 0;
+                    bool have_shared = false;
+                    std::string validity((list.length + 7) / 8, '\0');
+                    for (idx_t i = 0; i < list.length; i++)
+                    {
+                        auto idx = child_format.sel->get_index(list.offset + i);
+                        if (!child_format.validity.RowIsValid(idx))
+                        {
+                            continue;
+                        }
+                        validity[i / 8] |= char(1 << (i % 8));
+                        auto &image = child_data[idx];
+                        if (image.GetSize() <= FAMILY_BYTE)
+                        {
+                            throw InvalidInputException("datasketch_pack: entry " + std::to_string(i + 1) + " is not a serialized sketch");
+                        }
+                        auto image_family = const_data_ptr_cast(image.GetData())[FAMILY_BYTE];
+                        if (!have_shared)
+                        {
+                            family = image_family;
+                            memcpy(shared, image.GetData(), MinValue<idx_t>(image.GetSize(), SHARED_PREAMBLE_SIZE));
+                            have_shared = true;
+                        }
+                        else if (image_family != family)
+                        {
+                            throw InvalidInputException("datasketch_pack requires sketches of a single family");
+                        }
+                    }
+
+                    std::string entries;
+                    vector<idx_t> offsets;
+                    offsets.reserve(list.length + 1);
+                    offsets.push_back(0);
+                    for (idx_t i = 0; i < list.length; i++)
+                    {
+                        auto idx = child_format.sel->get_index(list.offset + i);
+                        if (child_format.validity.RowIsValid(idx))
+                        {
+                            EncodeEntry(child_data[idx], shared, entries);
+                        }
+                        offsets.push_back(entries.size());
+                    }
+
+                    auto offset_bits = MaxValue<idx_t>(BitWidth(entries.size()), 1);
+                    std::string packed;
+                    WriteRaw<uint32_t>(packed, PACK_MAGIC);
+                    packed.push_back(char(PACK_VERSION));
+                    packed.push_back(char(family));
+                    packed.push_back(char(offset_bits));
+                    packed.push_back('\0');
+                    WriteRaw<uint32_t>(packed, NumericCast<uint32_t>(list.length));
+                    packed.append(const_char_ptr_cast(shared), SHARED_PREAMBLE_SIZE);
+                    packed += validity;
+                    BitWriter writer(packed);
+                    for (auto offset : offsets)
+                    {
+                        writer.Write(offset, offset_bits);
+                    }
+                    writer.Flush();
+                    packed += entries;
+                    return StringVector::AddStringOrBlob(result, packed);
+                });
+        }
+
+        static void DSUnpack(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            UnaryExecutor::Execute<string_t, list_entry_t>(
+                args.data[0], result, args.size(),
+                [&](string_t block_data)
+                {
+                    PackedBlock block(block_data);
+                    auto current_size = ListVector::GetListSize(result);
+                    auto new_size = current_size + block.Count();
+                    if (ListVector::GetListCapacity(result) < new_size)
+                    {
+                        ListVector::Reserve(result, new_size);
+                    }
+                    auto &child_entry = ListVector::GetEntry(result);
+                    auto child_vals = FlatVector::GetData<string_t>(child_entry);
+                    auto &child_validity = FlatVector::Validity(child_entry);
+                    for (idx_t i = 0; i < block.Count(); i++)
+                    {
+                        if (block.IsValid(i))
+                        {
+                            child_vals[current_size + i] = StringVector::AddStringOrBlob(child_entry, block.Decode(i));
+                        }
+                        else
+                        {
+                            child_validity.SetInvalid(current_size + i);
+                        }
+                    }
+                    ListVector::SetListSize(result, new_size);
+                    return list_entry_t{current_size, block.Count()};
+                });
+        }
+
+        static void DSUnpackEntry(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            BinaryExecutor::ExecuteWithNulls<string_t, int64_t, string_t>(
+                args.data[0], args.data[1], result, args.size(),
+                [&](string_t block_data, int64_t index, ValidityMask &mask, idx_t idx)
+                {
+                    PackedBlock block(block_data);
+                    // 1-based like list_extract; out of range gives NULL.
+                    if (index < 1 || idx_t(index) > block.Count() || !block.IsValid(idx_t(index) - 1))
+                    {
+                        mask.SetInvalid(idx);
+                        return string_t();
+                    }
+                    return StringVector::AddStringOrBlob(result, block.Decode(idx_t(index) - 1));
+                });
+        }
+    }
+
+    // ============================================================
+    // 6. Main Loader
+    // ============================================================
+
+    void LoadSketchPack(ExtensionLoader &loader)
+    {
+        {
+            ScalarFunction fun("datasketch_pack", {LogicalType::LIST(LogicalType::BLOB)}, LogicalType::BLOB, DSPack);
+            CreateScalarFunctionInfo info(fun);
+            FunctionDescription desc;
+            desc.description = "Packs a list of serialized sketches of one family into a single compressed block that supports random access";
+            desc.examples.push_back("datasketch_pack(list(sketch))");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+
+        {
+            ScalarFunctionSet fs("datasketch_unpack");
+            fs.AddFunction(ScalarFunction({LogicalType::BLOB}, LogicalType::LIST(LogicalType::BLOB), DSUnpack));
+            fs.AddFunction(ScalarFunction({LogicalType::BLOB, LogicalType::BIGINT}, LogicalType::BLOB, DSUnpackEntry));
+            CreateScalarFunctionInfo info(std::move(fs));
+            FunctionDescription desc;
+            desc.description = "Restores the sketches of a packed block, or only the one at a 1-based index";
+            desc.examples.push_back("datasketch_unpack(block)");
+            desc.examples.push_back("datasketch_unpack(block, 3)::sketch_hll");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+    }
+
+} // namespace duckdb
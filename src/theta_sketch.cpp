@@ -9,38 +9,55 @@
 #include <DataSketches/theta_intersection.hpp>
 #include <DataSketches/theta_a_not_b.hpp>
 
+#include "sketch_memory.hpp"
+#include "deferred_k.hpp"
+#include "distinct_update.hpp"
+#include "distinct_hash.hpp"
+#include "set_sketch_combine.hpp"
+#include "sketch_statistics.hpp"
+
 namespace duckdb
 {
     namespace
     {
+        // Sketches held in aggregate states allocate through the tracking allocator.
+        using ThetaUpdateSketch = datasketches::update_theta_sketch_alloc<DSTrackingAllocator<uint64_t>>;
+        using ThetaUnion = datasketches::theta_union_alloc<DSTrackingAllocator<uint64_t>>;
         // ============================================================
         // 1. Helpers & Bind Data
         // ============================================================
 
-        struct DSThetaBindData : public FunctionData
+        struct DSThetaBindData : public DSSketchBindData
         {
             DSThetaBindData() : lg_k(12) {}
             explicit DSThetaBindData(uint8_t lg_k) : lg_k(lg_k) {}
 
             unique_ptr<FunctionData> Copy() const override
             {
-                return make_uniq<DSThetaBindData>(lg_k);
+                return make_uniq<DSThetaBindData>(*this);
             }
 
             bool Equals(const FunctionData &other_p) const override
             {
                 auto &other = other_p.Cast<DSThetaBindData>();
-                return lg_k == other.lg_k;
+                return lg_k == other.lg_k && decimal_scale == other.decimal_scale;
             }
 
+            // 0 when lg_k is a prepared statement parameter resolved per state.
             uint8_t lg_k;
+            // Scale of a DECIMAL input, see DSBindDecimalInput.
+            uint8_t decimal_scale = 0;
         };
 
+        template <class STATE, class INPUT_TYPE, class OP>
         unique_ptr<FunctionData> DSThetaBindWithK(ClientContext &context, AggregateFunction &function,
                                                   vector<unique_ptr<Expression>> &arguments)
         {
             if (arguments[0]->HasParameter())
-                throw ParameterNotResolvedException();
+            {
+                DSDeferK<STATE, INPUT_TYPE, OP>(function);
+                return make_uniq<DSThetaBindData>(0);
+            }
             if (!arguments[0]->IsFoldable())
                 throw BinderException("Theta Sketch lg_k must be constant");
 
@@ -65,8 +82,27 @@ namespace duckdb
 
         struct DSThetaState
         {
-            datasketches::update_theta_sketch *update_sketch = nullptr;
-            datasketches::theta_union *union_sketch = nullptr;
+            ThetaUpdateSketch *update_sketch = nullptr;
+            ThetaUnion *union_sketch = nullptr;
+            // lg_k given as a prepared statement parameter, 0 otherwise.
+            int32_t k = 0;
+
+            static void CheckK(int32_t lg_k)
+            {
+                if (lg_k < datasketches::theta_constants::MIN_LG_K || lg_k > datasketches::theta_constants::MAX_LG_K)
+                {
+                    throw InvalidInputException("Theta Sketch lg_k must be between %d and %d, got: %d",
+                                                (int)datasketches::theta_constants::MIN_LG_K,
+                                                (int)datasketches::theta_constants::MAX_LG_K, lg_k);
+                }
+            }
+
+            uint8_t ResolveLgK(const DSThetaBindData &bind_data) const
+            {
+                if (bind_data.lg_k)
+                    return bind_data.lg_k;
+                return k ? (uint8_t)k : 12;
+            }
 
             ~DSThetaState()
             {
@@ -80,9 +116,9 @@ namespace duckdb
             {
                 if (!update_sketch)
                 {
-                    datasketches::update_theta_sketch::builder b;
+                    ThetaUpdateSketch::builder b;
                     b.set_lg_k(lg_k);
-                    update_sketch = new datasketches::update_theta_sketch(b.build());
+                    update_sketch = new ThetaUpdateSketch(b.build());
                 }
             }
 
@@ -90,9 +126,9 @@ namespace duckdb
             {
                 if (!union_sketch)
                 {
-                    datasketches::theta_union::builder b;
+                    ThetaUnion::builder b;
                     b.set_lg_k(lg_k);
-                    union_sketch = new datasketches::theta_union(b.build());
+                    union_sketch = new ThetaUnion(b.build());
                 }
             }
         };
@@ -104,6 +140,7 @@ namespace duckdb
             {
                 state.update_sketch = nullptr;
                 state.union_sketch = nullptr;
+                state.k = 0;
             }
             template <class STATE>
             static void Destroy(STATE &state, AggregateInputData &)
@@ -120,22 +157,11 @@ namespace duckdb
             {
                 if (!source.update_sketch && !source.union_sketch)
                     return;
+                if (!target.k)
+                    target.k = source.k;
 
-                if (!target.union_sketch)
-                {
-                    auto &bind_data = aggr_input_data.bind_data->template Cast<DSThetaBindData>();
-                    target.CreateUnionSketch(bind_data.lg_k);
-                    if (target.update_sketch)
-                    {
-                        target.union_sketch->update(*target.update_sketch);
-                        delete target.update_sketch;
-                        target.update_sketch = nullptr;
-                    }
-                }
-                if (source.update_sketch)
-                    target.union_sketch->update(*source.update_sketch);
-                if (source.union_sketch)
-                    target.union_sketch->update(source.union_sketch->get_result());
+                auto &bind_data = aggr_input_data.bind_data->template Cast<DSThetaBindData>();
+                DSSetSketchCombine(source, target, target.ResolveLgK(bind_data));
             }
 
             template <class T, class STATE>
@@ -157,7 +183,7 @@ namespace duckdb
                 {
                     auto &bind_data = finalize_data.input.bind_data->template Cast<DSThetaBindData>();
                     datasketches::update_theta_sketch::builder b;
-                    b.set_lg_k(bind_data.lg_k);
+                    b.set_lg_k(state.ResolveLgK(bind_data));
                     auto empty_sketch = b.build();
                     auto compact = empty_sketch.compact();
                     auto serialized = compact.serialize();
@@ -168,19 +194,15 @@ namespace duckdb
 
         struct DSThetaCreateOperation : DSThetaOperationBase
         {
+            // Inserting a value twice leaves the sketch unchanged.
+            static constexpr bool IDEMPOTENT = true;
+
             template <class A_TYPE, class STATE, class OP>
             static void Operation(STATE &state, const A_TYPE &a_data, AggregateUnaryInput &idata)
             {
                 auto &bind_data = idata.input.bind_data->template Cast<DSThetaBindData>();
-                state.CreateUpdateSketch(bind_data.lg_k);
-                if constexpr (std::is_same_v<A_TYPE, duckdb::string_t>)
-                {
-                    state.update_sketch->update(a_data.GetData(), a_data.GetSize());
-                }
-                else
-                {
-                    state.update_sketch->update(a_data);
-                }
+                state.CreateUpdateSketch(state.ResolveLgK(bind_data));
+                DSDistinctUpdate(*state.update_sketch, a_data, bind_data.decimal_scale);
             }
 
             template <class INPUT_TYPE, class STATE, class OP>
@@ -199,8 +221,9 @@ namespace duckdb
             static void Operation(STATE &state, const A_TYPE &a_data, AggregateUnaryInput &idata)
             {
                 auto &bind_data = idata.input.bind_data->template Cast<DSThetaBindData>();
-                state.CreateUnionSketch(bind_data.lg_k);
-                auto sketch = datasketches::compact_theta_sketch::deserialize(a_data.GetDataUnsafe(), a_data.GetSize());
+                state.CreateUnionSketch(state.ResolveLgK(bind_data));
+                // Read the serialized sketch in place rather than copying its entries out first.
+                auto sketch = datasketches::wrapped_compact_theta_sketch::wrap(a_data.GetDataUnsafe(), a_data.GetSize());
                 state.union_sketch->update(sketch);
             }
 
@@ -227,8 +250,8 @@ namespace duckdb
                     datasketches::theta_union::builder b;
                     b.set_lg_k(12);
                     auto union_obj = b.build();
-                    auto sketch_a = datasketches::compact_theta_sketch::deserialize(a_blob.GetDataUnsafe(), a_blob.GetSize());
-                    auto sketch_b = datasketches::compact_theta_sketch::deserialize(b_blob.GetDataUnsafe(), b_blob.GetSize());
+                    auto sketch_a = datasketches::wrapped_compact_theta_sketch::wrap(a_blob.GetDataUnsafe(), a_blob.GetSize());
+                    auto sketch_b = datasketches::wrapped_compact_theta_sketch::wrap(b_blob.GetDataUnsafe(), b_blob.GetSize());
                     union_obj.update(sketch_a);
                     union_obj.update(sketch_b);
                     auto res = union_obj.get_result();
@@ -353,6 +376,41 @@ namespace duckdb
                                                       });
         }
 
+        static void DSThetaSummary(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat sketch_data;
+            args.data[0].ToUnifiedFormat(count, sketch_data);
+            auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_data);
+            auto &struct_entries = StructVector::GetEntries(result);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+
+                string_t sketch_blob = sketch_entries[sketch_idx];
+                auto sketch = datasketches::compact_theta_sketch::deserialize(sketch_blob.GetDataUnsafe(), sketch_blob.GetSize());
+                FlatVector::GetData<bool>(*struct_entries[0])[i] = sketch.is_empty();
+                FlatVector::GetData<bool>(*struct_entries[1])[i] = sketch.is_estimation_mode();
+                FlatVector::GetData<double>(*struct_entries[2])[i] = sketch.get_theta();
+                FlatVector::GetData<int64_t>(*struct_entries[3])[i] = (int64_t)sketch.get_num_retained();
+                FlatVector::GetData<int64_t>(*struct_entries[4])[i] = (int64_t)sketch.get_seed_hash();
+                FlatVector::GetData<double>(*struct_entries[5])[i] = sketch.get_estimate();
+                FlatVector::GetData<double>(*struct_entries[6])[i] = sketch.get_lower_bound(2);
+                FlatVector::GetData<double>(*struct_entries[7])[i] = sketch.get_upper_bound(2);
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
         // ============================================================
         // 4. Type Creation & Registration Helpers
         // ============================================================
@@ -377,20 +435,45 @@ namespace duckdb
         }
 
         template <typename T>
-        static void RegisterThetaAggregates(AggregateFunctionSet &set, const LogicalType &input_type, const LogicalType &result_type)
+        static AggregateFunction CreateThetaAggregate(const LogicalType &input_type, const LogicalType &result_type, bool with_k)
         {
-            auto fun_default = AggregateFunction::UnaryAggregateDestructor<DSThetaState, T, string_t, DSThetaCreateOperation, AggregateDestructorType::LEGACY>(
+            auto fun = AggregateFunction::UnaryAggregateDestructor<DSThetaState, T, string_t, DSThetaCreateOperation, AggregateDestructorType::LEGACY>(
                 input_type, result_type);
-            fun_default.bind = DSThetaBindDefault;
-            fun_default.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
-            set.AddFunction(fun_default);
+            DSUseDistinctUpdate<DSThetaState, T, DSThetaCreateOperation>(fun);
+            fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            if (with_k)
+            {
+                fun.bind = DSTrackedBind<DSThetaBindWithK<DSThetaState, T, DSThetaCreateOperation>>;
+                fun.arguments.insert(fun.arguments.begin(), LogicalType::INTEGER);
+            }
+            else
+            {
+                fun.bind = DSTrackedBind<DSThetaBindDefault>;
+            }
+            return fun;
+        }
 
-            auto fun_with_k = AggregateFunction::UnaryAggregateDestructor<DSThetaState, T, string_t, DSThetaCreateOperation, AggregateDestructorType::LEGACY>(
-                input_type, result_type);
-            fun_with_k.bind = DSThetaBindWithK;
-            fun_with_k.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
-            fun_with_k.arguments.insert(fun_with_k.arguments.begin(), LogicalType::INTEGER);
-            set.AddFunction(fun_with_k);
+        template <typename T>
+        static void RegisterThetaAggregates(AggregateFunctionSet &set, const LogicalType &input_type, const LogicalType &result_type)
+        {
+            set.AddFunction(CreateThetaAggregate<T>(input_type, result_type, false));
+            set.AddFunction(CreateThetaAggregate<T>(input_type, result_type, true));
+        }
+
+        unique_ptr<FunctionData> DSThetaBindDecimal(ClientContext &context, AggregateFunction &function,
+                                                    vector<unique_ptr<Expression>> &arguments)
+        {
+            return DSBindDecimalInput<DSThetaBindData>(context, function, arguments, 0,
+                                      [](auto tag, const LogicalType &type, const LogicalType &result_type)
+                                      { return CreateThetaAggregate<decltype(tag)>(type, result_type, false); });
+        }
+
+        unique_ptr<FunctionData> DSThetaBindDecimalWithK(ClientContext &context, AggregateFunction &function,
+                                                         vector<unique_ptr<Expression>> &arguments)
+        {
+            return DSBindDecimalInput<DSThetaBindData>(context, function, arguments, 1,
+                                      [](auto tag, const LogicalType &type, const LogicalType &result_type)
+                                      { return CreateThetaAggregate<decltype(tag)>(type, result_type, true); });
         }
     }
 
@@ -413,17 +496,38 @@ namespace duckdb
         RegisterThetaAggregates<float>(sketch_agg, LogicalType::FLOAT, sketch_type);
         RegisterThetaAggregates<double>(sketch_agg, LogicalType::DOUBLE, sketch_type);
         RegisterThetaAggregates<string_t>(sketch_agg, LogicalType::VARCHAR, sketch_type);
+        RegisterThetaAggregates<uint8_t>(sketch_agg, LogicalType::UTINYINT, sketch_type);
+        RegisterThetaAggregates<uint16_t>(sketch_agg, LogicalType::USMALLINT, sketch_type);
+        RegisterThetaAggregates<uint32_t>(sketch_agg, LogicalType::UINTEGER, sketch_type);
+        RegisterThetaAggregates<uint64_t>(sketch_agg, LogicalType::UBIGINT, sketch_type);
+        // Hashed by their canonical encoding, see distinct_hash.hpp.
+        RegisterThetaAggregates<int32_t>(sketch_agg, LogicalType::DATE, sketch_type);
+        RegisterThetaAggregates<int64_t>(sketch_agg, LogicalType::TIME, sketch_type);
+        RegisterThetaAggregates<int64_t>(sketch_agg, LogicalType::TIMESTAMP, sketch_type);
+        RegisterThetaAggregates<int64_t>(sketch_agg, LogicalType::TIMESTAMP_TZ, sketch_type);
+        RegisterThetaAggregates<hugeint_t>(sketch_agg, LogicalType::HUGEINT, sketch_type);
+        RegisterThetaAggregates<uhugeint_t>(sketch_agg, LogicalType::UHUGEINT, sketch_type);
+        RegisterThetaAggregates<DSUuid>(sketch_agg, LogicalType::UUID, sketch_type);
+        {
+            // DECIMAL of any width, see DSBindDecimalInput.
+            auto fun_default = CreateThetaAggregate<int64_t>(LogicalType(LogicalTypeId::DECIMAL), sketch_type, false);
+            fun_default.bind = DSTrackedBind<DSThetaBindDecimal>;
+            sketch_agg.AddFunction(fun_default);
+            auto fun_with_k = CreateThetaAggregate<int64_t>(LogicalType(LogicalTypeId::DECIMAL), sketch_type, true);
+            fun_with_k.bind = DSTrackedBind<DSThetaBindDecimalWithK>;
+            sketch_agg.AddFunction(fun_with_k);
+        }
 
         // 2. MERGE SKETCHES (sketch_theta / BLOB)
         auto fun_merge = AggregateFunction::UnaryAggregateDestructor<DSThetaState, string_t, string_t, DSThetaMergeOperation, AggregateDestructorType::LEGACY>(
             sketch_type, sketch_type);
-        fun_merge.bind = DSThetaBindDefault;
+        fun_merge.bind = DSTrackedBind<DSThetaBindDefault>;
         fun_merge.arguments = {sketch_type};
         sketch_agg.AddFunction(fun_merge);
 
         auto fun_merge_k = AggregateFunction::UnaryAggregateDestructor<DSThetaState, string_t, string_t, DSThetaMergeOperation, AggregateDestructorType::LEGACY>(
             sketch_type, sketch_type);
-        fun_merge_k.bind = DSThetaBindWithK;
+        fun_merge_k.bind = DSTrackedBind<DSThetaBindWithK<DSThetaState, string_t, DSThetaMergeOperation>>;
         fun_merge_k.arguments = {LogicalType::INTEGER, sketch_type};
         sketch_agg.AddFunction(fun_merge_k);
 
@@ -463,7 +567,7 @@ namespace duckdb
             loader.RegisterFunction(info);
         }
         {
-            CreateScalarFunctionInfo info(ScalarFunction("datasketch_theta_estimate", {sketch_type}, LogicalType::DOUBLE, DSThetaEstimate));
+            CreateScalarFunctionInfo info(DSWithStatistics(ScalarFunction("datasketch_theta_estimate", {sketch_type}, LogicalType::DOUBLE, DSThetaEstimate), DSNonNegativeStatistics));
             FunctionDescription desc;
             desc.description = "Returns the estimated number of distinct values in the Theta sketch";
             desc.examples.push_back("datasketch_theta_estimate(sketch)");
@@ -471,7 +575,7 @@ namespace duckdb
             loader.RegisterFunction(info);
         }
         {
-            CreateScalarFunctionInfo info(ScalarFunction("datasketch_theta_lower_bound", {sketch_type, LogicalType::INTEGER}, LogicalType::DOUBLE, DSThetaLowerBound));
+            CreateScalarFunctionInfo info(DSWithStatistics(ScalarFunction("datasketch_theta_lower_bound", {sketch_type, LogicalType::INTEGER}, LogicalType::DOUBLE, DSThetaLowerBound), DSNonNegativeStatistics));
             FunctionDescription desc;
             desc.description = "Returns the lower bound estimate at the given number of standard deviations (1, 2, or 3)";
             desc.examples.push_back("datasketch_theta_lower_bound(sketch, 2)");
@@ -479,7 +583,7 @@ namespace duckdb
             loader.RegisterFunction(info);
         }
         {
-            CreateScalarFunctionInfo info(ScalarFunction("datasketch_theta_upper_bound", {sketch_type, LogicalType::INTEGER}, LogicalType::DOUBLE, DSThetaUpperBound));
+            CreateScalarFunctionInfo info(DSWithStatistics(ScalarFunction("datasketch_theta_upper_bound", {sketch_type, LogicalType::INTEGER}, LogicalType::DOUBLE, DSThetaUpperBound), DSNonNegativeStatistics));
             FunctionDescription desc;
             desc.description = "Returns the upper bound estimate at the given number of standard deviations (1, 2, or 3)";
             desc.examples.push_back("datasketch_theta_upper_bound(sketch, 2)");
@@ -513,7 +617,7 @@ namespace duckdb
             loader.RegisterFunction(info);
         }
         {
-            CreateScalarFunctionInfo info(ScalarFunction("datasketch_theta_get_theta", {sketch_type}, LogicalType::DOUBLE, DSThetaGetTheta));
+            CreateScalarFunctionInfo info(DSWithStatistics(ScalarFunction("datasketch_theta_get_theta", {sketch_type}, LogicalType::DOUBLE, DSThetaGetTheta), DSUnitIntervalStatistics));
             FunctionDescription desc;
             desc.description = "Returns the theta value of the sketch (sampling probability)";
             desc.examples.push_back("datasketch_theta_get_theta(sketch)");
@@ -536,6 +640,24 @@ namespace duckdb
             info.descriptions.push_back(desc);
             loader.RegisterFunction(info);
         }
+        {
+            child_list_t<LogicalType> struct_fields;
+            struct_fields.push_back({"is_empty", LogicalType::BOOLEAN});
+            struct_fields.push_back({"is_estimation_mode", LogicalType::BOOLEAN});
+            struct_fields.push_back({"theta", LogicalType::DOUBLE});
+            struct_fields.push_back({"num_retained", LogicalType::BIGINT});
+            struct_fields.push_back({"seed_hash", LogicalType::BIGINT});
+            struct_fields.push_back({"estimate", LogicalType::DOUBLE});
+            struct_fields.push_back({"lower_bound", LogicalType::DOUBLE});
+            struct_fields.push_back({"upper_bound", LogicalType::DOUBLE});
+
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_theta_summary", {sketch_type}, LogicalType::STRUCT(struct_fields), DSThetaSummary));
+            FunctionDescription desc;
+            desc.description = "Returns a struct of the metadata and estimates (bounds at 2 standard deviations) of the Theta sketch from a single deserialization";
+            desc.examples.push_back("datasketch_theta_summary(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
     }
 
 }
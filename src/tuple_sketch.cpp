@@ -0,0 +1,1339 @@
+#include "datasketches_extension.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_aggregate_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_type_info.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/operator/add.hpp"
+
+// Apache DataSketches Headers
+#include <DataSketches/array_of_doubles_sketch.hpp>
+#include <DataSketches/array_of_doubles_union.hpp>
+#include <DataSketches/array_of_doubles_intersection.hpp>
+#include <DataSketches/array_of_doubles_a_not_b.hpp>
+#include <DataSketches/tuple_sketch.hpp>
+#include <DataSketches/tuple_union.hpp>
+#include <DataSketches/tuple_intersection.hpp>
+#include <DataSketches/tuple_a_not_b.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include "deferred_k.hpp"
+#include "sketch_memory.hpp"
+#include "sketch_statistics.hpp"
+#include "set_sketch_combine.hpp"
+
+namespace duckdb
+{
+    namespace
+    {
+        // Sketches held in aggregate states allocate through the tracking allocator.
+        using AoDUpdateSketch = datasketches::update_array_of_doubles_sketch_alloc<DSTrackingAllocator<double>>;
+        using AoDUnion = datasketches::array_of_doubles_union_alloc<DSTrackingAllocator<double>>;
+        using AoDStateCompactSketch = datasketches::compact_array_of_doubles_sketch_alloc<DSTrackingAllocator<double>>;
+        using AoDCompactSketch = datasketches::compact_array_of_doubles_sketch;
+
+        // Tuple sketches are Theta sketches whose retained keys carry a
+        // summary.  Two summaries are provided: an array of doubles that is
+        // summed per key (sketch_aod) and a single integer that is summed, or
+        // kept as the minimum or maximum, per key (sketch_tuple_int).  Set
+        // operations on them answer questions such as "revenue of the distinct
+        // users in both segments" from stored sketches alone.
+
+        // ============================================================
+        // 1. Helpers & Bind Data
+        // ============================================================
+
+        struct DSTupleBindData : public DSSketchBindData
+        {
+            DSTupleBindData() : lg_k(12) {}
+            explicit DSTupleBindData(uint8_t lg_k) : lg_k(lg_k) {}
+
+            unique_ptr<FunctionData> Copy() const override
+            {
+                return make_uniq<DSTupleBindData>(*this);
+            }
+
+            bool Equals(const FunctionData &other_p) const override
+            {
+                auto &other = other_p.Cast<DSTupleBindData>();
+                return lg_k == other.lg_k;
+            }
+
+            // 0 when lg_k is a prepared statement parameter resolved per state.
+            uint8_t lg_k;
+        };
+
+        static void DSTupleCheckLgK(int32_t lg_k)
+        {
+            if (lg_k < datasketches::theta_constants::MIN_LG_K || lg_k > datasketches::theta_constants::MAX_LG_K)
+            {
+                throw InvalidInputException("Tuple Sketch lg_k must be between %d and %d, got: %d",
+                                            (int)datasketches::theta_constants::MIN_LG_K,
+                                            (int)datasketches::theta_constants::MAX_LG_K, lg_k);
+            }
+        }
+
+        // Reads a constant lg_k argument and removes it.
+        uint8_t DSTupleBindLgK(ClientContext &context, AggregateFunction &function,
+                               vector<unique_ptr<Expression>> &arguments)
+        {
+            if (!arguments[0]->IsFoldable())
+                throw BinderException("Tuple Sketch lg_k must be constant");
+
+            Value k_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+            if (k_val.IsNull())
+                throw BinderException("Tuple Sketch lg_k cannot be NULL");
+
+            auto lg_k = k_val.GetValue<int32_t>();
+            DSTupleCheckLgK(lg_k);
+            Function::EraseArgument(function, arguments, 0);
+            return (uint8_t)lg_k;
+        }
+
+        // UPDATE and SIMPLE_UPDATE are the aggregate's update functions, which
+        // read the remaining columns when lg_k is a parameter.
+        template <class STATE, aggregate_update_t UPDATE, aggregate_simple_update_t SIMPLE_UPDATE>
+        unique_ptr<FunctionData> DSTupleBindWithK(ClientContext &context, AggregateFunction &function,
+                                                  vector<unique_ptr<Expression>> &arguments)
+        {
+            if (arguments[0]->HasParameter())
+            {
+                DSDeferKUpdates<STATE, UPDATE, SIMPLE_UPDATE>(function);
+                return make_uniq<DSTupleBindData>(0);
+            }
+            return make_uniq<DSTupleBindData>(DSTupleBindLgK(context, function, arguments));
+        }
+
+        unique_ptr<FunctionData> DSTupleBindDefault(ClientContext &context, AggregateFunction &function,
+                                                    vector<unique_ptr<Expression>> &arguments)
+        {
+            return make_uniq<DSTupleBindData>(12);
+        }
+
+        static AoDCompactSketch DSAoDDeserialize(const string_t &blob)
+        {
+            try
+            {
+                return AoDCompactSketch::deserialize(blob.GetDataUnsafe(), blob.GetSize());
+            }
+            catch (const std::exception &e)
+            {
+                throw InvalidInputException("Failed to deserialize AoD sketch: %s", e.what());
+            }
+        }
+
+        template <class SKETCH>
+        static string_t DSTupleSerialize(Vector &result, const SKETCH &sketch)
+        {
+            auto serialized = sketch.serialize();
+            return StringVector::AddStringOrBlob(result, std::string(serialized.begin(), serialized.end()));
+        }
+
+        // Intersections keep the values of the first sketch, so "revenue of
+        // the users of A that are also in B" is the intersection of A and B.
+        struct DSAoDKeepFirstPolicy
+        {
+            explicit DSAoDKeepFirstPolicy(uint8_t num_values = 1) : num_values(num_values) {}
+
+            template <class SUMMARY>
+            void operator()(SUMMARY &summary, const SUMMARY &other) const
+            {
+            }
+
+            uint8_t get_num_values() const
+            {
+                return num_values;
+            }
+
+            uint8_t num_values;
+        };
+
+        // How the integer summaries of a key are combined, on insert and in
+        // unions alike.
+        enum class DSTupleIntMode : uint8_t
+        {
+            SUM,
+            MIN,
+            MAX
+        };
+
+        static DSTupleIntMode DSTupleIntParseMode(const string &name)
+        {
+            auto lower = StringUtil::Lower(name);
+            if (lower == "sum")
+                return DSTupleIntMode::SUM;
+            if (lower == "min")
+                return DSTupleIntMode::MIN;
+            if (lower == "max")
+                return DSTupleIntMode::MAX;
+            throw InvalidInputException("Tuple Sketch policy must be one of 'sum', 'min' or 'max', got: '%s'", name);
+        }
+
+        struct DSTupleIntPolicy
+        {
+            explicit DSTupleIntPolicy(DSTupleIntMode mode = DSTupleIntMode::SUM) : mode(mode) {}
+
+            int64_t create() const
+            {
+                switch (mode)
+                {
+                case DSTupleIntMode::MIN:
+                    return NumericLimits<int64_t>::Maximum();
+                case DSTupleIntMode::MAX:
+                    return NumericLimits<int64_t>::Minimum();
+                default:
+                    return 0;
+                }
+            }
+
+            void update(int64_t &summary, int64_t value) const
+            {
+                switch (mode)
+                {
+                case DSTupleIntMode::MIN:
+                    summary = MinValue(summary, value);
+                    break;
+                case DSTupleIntMode::MAX:
+                    summary = MaxValue(summary, value);
+                    break;
+                default:
+                    summary = AddOperatorOverflowCheck::Operation<int64_t, int64_t, int64_t>(summary, value);
+                    break;
+                }
+            }
+
+            // Union and intersection policy.
+            void operator()(int64_t &summary, int64_t other) const
+            {
+                update(summary, other);
+            }
+
+            DSTupleIntMode mode;
+        };
+
+        using TupleIntUpdateSketch = datasketches::update_tuple_sketch<int64_t, int64_t, DSTupleIntPolicy, DSTrackingAllocator<int64_t>>;
+        using TupleIntUnion = datasketches::tuple_union<int64_t, DSTupleIntPolicy, DSTrackingAllocator<int64_t>>;
+        using TupleIntStateCompactSketch = datasketches::compact_tuple_sketch<int64_t, DSTrackingAllocator<int64_t>>;
+        using TupleIntCompactSketch = datasketches::compact_tuple_sketch<int64_t>;
+
+        struct DSTupleIntBindData : public DSSketchBindData
+        {
+            DSTupleIntBindData(uint8_t lg_k, DSTupleIntMode mode) : lg_k(lg_k), mode(mode) {}
+
+            unique_ptr<FunctionData> Copy() const override
+            {
+                return make_uniq<DSTupleIntBindData>(*this);
+            }
+
+            bool Equals(const FunctionData &other_p) const override
+            {
+                auto &other = other_p.Cast<DSTupleIntBindData>();
+                return lg_k == other.lg_k && mode == other.mode;
+            }
+
+            // 0 when lg_k is a prepared statement parameter resolved per state.
+            uint8_t lg_k;
+            DSTupleIntMode mode;
+        };
+
+        // datasketch_tuple_int(lg_k, ...[, policy]): the policy is a constant
+        // and lg_k a constant or a parameter, handled as in DSTupleBindWithK.
+        template <class STATE, bool HAS_POLICY, aggregate_update_t UPDATE, aggregate_simple_update_t SIMPLE_UPDATE>
+        unique_ptr<FunctionData> DSTupleIntBind(ClientContext &context, AggregateFunction &function,
+                                                vector<unique_ptr<Expression>> &arguments)
+        {
+            auto mode = DSTupleIntMode::SUM;
+            if (HAS_POLICY)
+            {
+                auto policy_idx = arguments.size() - 1;
+                if (arguments[policy_idx]->HasParameter())
+                    throw ParameterNotResolvedException();
+                if (!arguments[policy_idx]->IsFoldable())
+                    throw BinderException("Tuple Sketch policy must be constant");
+                Value policy_val = ExpressionExecutor::EvaluateScalar(context, *arguments[policy_idx]);
+                if (policy_val.IsNull())
+                    throw BinderException("Tuple Sketch policy cannot be NULL");
+                mode = DSTupleIntParseMode(policy_val.ToString());
+                Function::EraseArgument(function, arguments, policy_idx);
+            }
+            if (arguments[0]->HasParameter())
+            {
+                DSDeferKUpdates<STATE, UPDATE, SIMPLE_UPDATE>(function);
+                return make_uniq<DSTupleIntBindData>(0, mode);
+            }
+            return make_uniq<DSTupleIntBindData>(DSTupleBindLgK(context, function, arguments), mode);
+        }
+
+        static TupleIntCompactSketch DSTupleIntDeserialize(const string_t &blob)
+        {
+            try
+            {
+                return TupleIntCompactSketch::deserialize(blob.GetDataUnsafe(), blob.GetSize());
+            }
+            catch (const std::exception &e)
+            {
+                throw InvalidInputException("Failed to deserialize Tuple sketch: %s", e.what());
+            }
+        }
+
+        // ============================================================
+        // 2. State & Operations
+        // ============================================================
+
+        struct DSAoDState
+        {
+            AoDUpdateSketch *update_sketch = nullptr;
+            AoDUnion *union_sketch = nullptr;
+            // Length of the value arrays, fixed by the first row.
+            uint8_t num_values = 0;
+            // lg_k given as a prepared statement parameter, 0 otherwise.
+            int32_t k = 0;
+
+            static void CheckK(int32_t lg_k)
+            {
+                DSTupleCheckLgK(lg_k);
+            }
+
+            uint8_t ResolveLgK(const DSTupleBindData &bind_data) const
+            {
+                if (bind_data.lg_k)
+                    return bind_data.lg_k;
+                return k ? (uint8_t)k : 12;
+            }
+
+            ~DSAoDState()
+            {
+                if (update_sketch)
+                    delete update_sketch;
+                if (union_sketch)
+                    delete union_sketch;
+            }
+
+            void SetNumValues(idx_t length)
+            {
+                if (length == 0 || length > 255)
+                {
+                    throw InvalidInputException("AoD sketch values must have between 1 and 255 entries, got: %d", (int64_t)length);
+                }
+                if (num_values && num_values != length)
+                {
+                    throw InvalidInputException("AoD sketch values must all have the same length, got %d and %d",
+                                                (int64_t)num_values, (int64_t)length);
+                }
+                num_values = (uint8_t)length;
+            }
+
+            void CreateUpdateSketch(uint8_t lg_k)
+            {
+                if (!update_sketch)
+                {
+                    AoDUpdateSketch::builder b(datasketches::default_array_of_doubles_update_policy<DSTrackingAllocator<double>>(num_values));
+                    b.set_lg_k(lg_k);
+                    update_sketch = new AoDUpdateSketch(b.build());
+                }
+            }
+
+            void CreateUnionSketch(uint8_t lg_k)
+            {
+                if (!union_sketch)
+                {
+                    AoDUnion::builder b(datasketches::default_array_of_doubles_union_policy_alloc<DSTrackingAllocator<double>>(num_values));
+                    b.set_lg_k(lg_k);
+                    union_sketch = new AoDUnion(b.build());
+                }
+            }
+        };
+
+        struct DSAoDOperationBase
+        {
+            template <class STATE>
+            static void Initialize(STATE &state)
+            {
+                state.update_sketch = nullptr;
+                state.union_sketch = nullptr;
+                state.num_values = 0;
+                state.k = 0;
+            }
+            template <class STATE>
+            static void Destroy(STATE &state, AggregateInputData &)
+            {
+                if (state.update_sketch)
+                    delete state.update_sketch;
+                if (state.union_sketch)
+                    delete state.union_sketch;
+            }
+            static bool IgnoreNull() { return true; }
+
+            template <class STATE, class OP>
+            static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data)
+            {
+                if (!source.update_sketch && !source.union_sketch)
+                    return;
+                target.SetNumValues(source.num_values);
+                if (!target.k)
+                    target.k = source.k;
+
+                auto &bind_data = aggr_input_data.bind_data->template Cast<DSTupleBindData>();
+                DSSetSketchCombine(source, target, target.ResolveLgK(bind_data));
+            }
+
+            template <class T, class STATE>
+            static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data)
+            {
+                if (state.union_sketch)
+                {
+                    target = DSTupleSerialize(finalize_data.result, state.union_sketch->get_result());
+                }
+                else if (state.update_sketch)
+                {
+                    target = DSTupleSerialize(finalize_data.result, state.update_sketch->compact());
+                }
+                else
+                {
+                    // The length of the value arrays is unknown without input.
+                    finalize_data.ReturnNull();
+                }
+            }
+        };
+
+        // Builds the sketch from (key, values) rows.  The values are a list,
+        // so the update functions are written out rather than generated by
+        // AggregateFunction::BinaryAggregate.
+        struct DSAoDCreateOperation : DSAoDOperationBase
+        {
+            template <class KEY_TYPE>
+            static void Update(DSAoDState &state, const KEY_TYPE &key, const list_entry_t &entry,
+                               const UnifiedVectorFormat &child_format, uint8_t lg_k, vector<double> &values)
+            {
+                state.SetNumValues(entry.length);
+                auto child_data = UnifiedVectorFormat::GetData<double>(child_format);
+                values.resize(entry.length);
+                for (idx_t i = 0; i < entry.length; i++)
+                {
+                    auto child_idx = child_format.sel->get_index(entry.offset + i);
+                    if (!child_format.validity.RowIsValid(child_idx))
+                    {
+                        throw InvalidInputException("AoD sketch values cannot contain NULL");
+                    }
+                    values[i] = child_data[child_idx];
+                }
+
+                state.CreateUpdateSketch(lg_k);
+                const double *update = values.data();
+                if constexpr (std::is_same_v<KEY_TYPE, duckdb::string_t>)
+                {
+                    state.update_sketch->update(key.GetData(), key.GetSize(), update);
+                }
+                else
+                {
+                    state.update_sketch->update(key, update);
+                }
+            }
+
+            template <class KEY_TYPE>
+            static void ScatterUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                      Vector &states, idx_t count)
+            {
+                D_ASSERT(input_count == 2);
+                auto &bind_data = aggr_input_data.bind_data->Cast<DSTupleBindData>();
+                UnifiedVectorFormat key_format;
+                inputs[0].ToUnifiedFormat(count, key_format);
+                UnifiedVectorFormat list_format;
+                inputs[1].ToUnifiedFormat(count, list_format);
+                UnifiedVectorFormat child_format;
+                ListVector::GetEntry(inputs[1]).ToUnifiedFormat(ListVector::GetListSize(inputs[1]), child_format);
+                UnifiedVectorFormat state_format;
+                states.ToUnifiedFormat(count, state_format);
+
+                auto keys = UnifiedVectorFormat::GetData<KEY_TYPE>(key_format);
+                auto lists = UnifiedVectorFormat::GetData<list_entry_t>(list_format);
+                auto state_data = UnifiedVectorFormat::GetData<DSAoDState *>(state_format);
+                vector<double> values;
+                for (idx_t i = 0; i < count; i++)
+                {
+                    auto key_idx = key_format.sel->get_index(i);
+                    auto list_idx = list_format.sel->get_index(i);
+                    if (!key_format.validity.RowIsValid(key_idx) || !list_format.validity.RowIsValid(list_idx))
+                        continue;
+                    auto &state = *state_data[state_format.sel->get_index(i)];
+                    Update(state, keys[key_idx], lists[list_idx], child_format, state.ResolveLgK(bind_data), values);
+                }
+            }
+
+            template <class KEY_TYPE>
+            static void SimpleUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                     data_ptr_t state_p, idx_t count)
+            {
+                D_ASSERT(input_count == 2);
+                auto &bind_data = aggr_input_data.bind_data->Cast<DSTupleBindData>();
+                UnifiedVectorFormat key_format;
+                inputs[0].ToUnifiedFormat(count, key_format);
+                UnifiedVectorFormat list_format;
+                inputs[1].ToUnifiedFormat(count, list_format);
+                UnifiedVectorFormat child_format;
+                ListVector::GetEntry(inputs[1]).ToUnifiedFormat(ListVector::GetListSize(inputs[1]), child_format);
+
+                auto keys = UnifiedVectorFormat::GetData<KEY_TYPE>(key_format);
+                auto lists = UnifiedVectorFormat::GetData<list_entry_t>(list_format);
+                auto &state = *reinterpret_cast<DSAoDState *>(state_p);
+                vector<double> values;
+                for (idx_t i = 0; i < count; i++)
+                {
+                    auto key_idx = key_format.sel->get_index(i);
+                    auto list_idx = list_format.sel->get_index(i);
+                    if (!key_format.validity.RowIsValid(key_idx) || !list_format.validity.RowIsValid(list_idx))
+                        continue;
+                    Update(state, keys[key_idx], lists[list_idx], child_format, state.ResolveLgK(bind_data), values);
+                }
+            }
+        };
+
+        struct DSAoDMergeOperation : DSAoDOperationBase
+        {
+            template <class A_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &a_data, AggregateUnaryInput &idata)
+            {
+                auto &bind_data = idata.input.bind_data->template Cast<DSTupleBindData>();
+                AoDStateCompactSketch sketch = [&]()
+                {
+                    try
+                    {
+                        return AoDStateCompactSketch::deserialize(a_data.GetDataUnsafe(), a_data.GetSize());
+                    }
+                    catch (const std::exception &e)
+                    {
+                        throw InvalidInputException("Failed to deserialize AoD sketch: %s", e.what());
+                    }
+                }();
+                state.SetNumValues(sketch.get_num_values());
+                state.CreateUnionSketch(state.ResolveLgK(bind_data));
+                state.union_sketch->update(sketch);
+            }
+
+            template <class INPUT_TYPE, class STATE, class OP>
+            static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t count)
+            {
+                for (idx_t i = 0; i < count; i++)
+                {
+                    Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+                }
+            }
+        };
+
+        struct DSTupleIntState
+        {
+            TupleIntUpdateSketch *update_sketch = nullptr;
+            TupleIntUnion *union_sketch = nullptr;
+            DSTupleIntMode mode = DSTupleIntMode::SUM;
+            // lg_k given as a prepared statement parameter, 0 otherwise.
+            int32_t k = 0;
+
+            static void CheckK(int32_t lg_k)
+            {
+                DSTupleCheckLgK(lg_k);
+            }
+
+            uint8_t ResolveLgK(const DSTupleIntBindData &bind_data) const
+            {
+                if (bind_data.lg_k)
+                    return bind_data.lg_k;
+                return k ? (uint8_t)k : 12;
+            }
+
+            ~DSTupleIntState()
+            {
+                if (update_sketch)
+                    delete update_sketch;
+                if (union_sketch)
+                    delete union_sketch;
+            }
+
+            void CreateUpdateSketch(uint8_t lg_k)
+            {
+                if (!update_sketch)
+                {
+                    TupleIntUpdateSketch::builder b(DSTupleIntPolicy(mode));
+                    b.set_lg_k(lg_k);
+                    update_sketch = new TupleIntUpdateSketch(b.build());
+                }
+            }
+
+            void CreateUnionSketch(uint8_t lg_k)
+            {
+                if (!union_sketch)
+                {
+                    TupleIntUnion::builder b(DSTupleIntPolicy(mode));
+                    b.set_lg_k(lg_k);
+                    union_sketch = new TupleIntUnion(b.build());
+                }
+            }
+        };
+
+        struct DSTupleIntOperationBase
+        {
+            template <class STATE>
+            static void Initialize(STATE &state)
+            {
+                state.update_sketch = nullptr;
+                state.union_sketch = nullptr;
+                state.mode = DSTupleIntMode::SUM;
+                state.k = 0;
+            }
+            template <class STATE>
+            static void Destroy(STATE &state, AggregateInputData &)
+            {
+                if (state.update_sketch)
+                    delete state.update_sketch;
+                if (state.union_sketch)
+                    delete state.union_sketch;
+            }
+            static bool IgnoreNull() { return true; }
+
+            template <class STATE, class OP>
+            static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data)
+            {
+                auto &bind_data = aggr_input_data.bind_data->template Cast<DSTupleIntBindData>();
+                target.mode = bind_data.mode;
+                if (!target.k)
+                    target.k = source.k;
+                DSSetSketchCombine(source, target, target.ResolveLgK(bind_data));
+            }
+
+            template <class T, class STATE>
+            static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data)
+            {
+                if (state.union_sketch)
+                {
+                    target = DSTupleSerialize(finalize_data.result, state.union_sketch->get_result());
+                }
+                else if (state.update_sketch)
+                {
+                    target = DSTupleSerialize(finalize_data.result, state.update_sketch->compact());
+                }
+                else
+                {
+                    // NULL without input, like the AoD sketches.
+                    finalize_data.ReturnNull();
+                }
+            }
+        };
+
+        // Builds the sketch from (key, value) rows, written out like the AoD
+        // updates above.
+        struct DSTupleIntCreateOperation : DSTupleIntOperationBase
+        {
+            template <class KEY_TYPE>
+            static void Update(DSTupleIntState &state, const KEY_TYPE &key, int64_t value, const DSTupleIntBindData &bind_data)
+            {
+                state.mode = bind_data.mode;
+                state.CreateUpdateSketch(state.ResolveLgK(bind_data));
+                if constexpr (std::is_same_v<KEY_TYPE, duckdb::string_t>)
+                {
+                    state.update_sketch->update(key.GetData(), key.GetSize(), value);
+                }
+                else
+                {
+                    state.update_sketch->update(key, value);
+                }
+            }
+
+            template <class KEY_TYPE>
+            static void ScatterUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                      Vector &states, idx_t count)
+            {
+                D_ASSERT(input_count == 2);
+                auto &bind_data = aggr_input_data.bind_data->Cast<DSTupleIntBindData>();
+                UnifiedVectorFormat key_format;
+                inputs[0].ToUnifiedFormat(count, key_format);
+                UnifiedVectorFormat value_format;
+                inputs[1].ToUnifiedFormat(count, value_format);
+                UnifiedVectorFormat state_format;
+                states.ToUnifiedFormat(count, state_format);
+
+                auto keys = UnifiedVectorFormat::GetData<KEY_TYPE>(key_format);
+                auto values = UnifiedVectorFormat::GetData<int64_t>(value_format);
+                auto state_data = UnifiedVectorFormat::GetData<DSTupleIntState *>(state_format);
+                for (idx_t i = 0; i < count; i++)
+                {
+                    auto key_idx = key_format.sel->get_index(i);
+                    auto value_idx = value_format.sel->get_index(i);
+                    if (!key_format.validity.RowIsValid(key_idx) || !value_format.validity.RowIsValid(value_idx))
+                        continue;
+                    auto &state = *state_data[state_format.sel->get_index(i)];
+                    Update(state, keys[key_idx], values[value_idx], bind_data);
+                }
+            }
+
+            template <class KEY_TYPE>
+            static void SimpleUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                     data_ptr_t state_p, idx_t count)
+            {
+                D_ASSERT(input_count == 2);
+                auto &bind_data = aggr_input_data.bind_data->Cast<DSTupleIntBindData>();
+                UnifiedVectorFormat key_format;
+                inputs[0].ToUnifiedFormat(count, key_format);
+                UnifiedVectorFormat value_format;
+                inputs[1].ToUnifiedFormat(count, value_format);
+
+                auto keys = UnifiedVectorFormat::GetData<KEY_TYPE>(key_format);
+                auto values = UnifiedVectorFormat::GetData<int64_t>(value_format);
+                auto &state = *reinterpret_cast<DSTupleIntState *>(state_p);
+                for (idx_t i = 0; i < count; i++)
+                {
+                    auto key_idx = key_format.sel->get_index(i);
+                    auto value_idx = value_format.sel->get_index(i);
+                    if (!key_format.validity.RowIsValid(key_idx) || !value_format.validity.RowIsValid(value_idx))
+                        continue;
+                    Update(state, keys[key_idx], values[value_idx], bind_data);
+                }
+            }
+        };
+
+        struct DSTupleIntMergeOperation : DSTupleIntOperationBase
+        {
+            template <class A_TYPE, class STATE, class OP>
+            static void Operation(STATE &state, const A_TYPE &a_data, AggregateUnaryInput &idata)
+            {
+                auto &bind_data = idata.input.bind_data->template Cast<DSTupleIntBindData>();
+                TupleIntStateCompactSketch sketch = [&]()
+                {
+                    try
+                    {
+                        return TupleIntStateCompactSketch::deserialize(a_data.GetDataUnsafe(), a_data.GetSize());
+                    }
+                    catch (const std::exception &e)
+                    {
+                        throw InvalidInputException("Failed to deserialize Tuple sketch: %s", e.what());
+                    }
+                }();
+                state.mode = bind_data.mode;
+                state.CreateUnionSketch(state.ResolveLgK(bind_data));
+                state.union_sketch->update(sketch);
+            }
+
+            template <class INPUT_TYPE, class STATE, class OP>
+            static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t count)
+            {
+                for (idx_t i = 0; i < count; i++)
+                {
+                    Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+                }
+            }
+        };
+
+        // ============================================================
+        // 3. Scalar Functions
+        // ============================================================
+
+        static void DSAoDUnion(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            BinaryExecutor::Execute<string_t, string_t, string_t>(
+                args.data[0], args.data[1], result, args.size(),
+                [&](string_t a_blob, string_t b_blob)
+                {
+                    auto sketch_a = DSAoDDeserialize(a_blob);
+                    auto sketch_b = DSAoDDeserialize(b_blob);
+                    if (sketch_a.get_num_values() != sketch_b.get_num_values())
+                    {
+                        throw InvalidInputException("AoD sketches must have the same number of values, got %d and %d",
+                                                    (int)sketch_a.get_num_values(), (int)sketch_b.get_num_values());
+                    }
+                    datasketches::array_of_doubles_union::builder b(
+                        datasketches::default_array_of_doubles_union_policy(sketch_a.get_num_values()));
+                    auto union_obj = b.build();
+                    union_obj.update(sketch_a);
+                    union_obj.update(sketch_b);
+                    return DSTupleSerialize(result, union_obj.get_result());
+                });
+        }
+
+        static void DSAoDIntersect(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            BinaryExecutor::Execute<string_t, string_t, string_t>(
+                args.data[0], args.data[1], result, args.size(),
+                [&](string_t a_blob, string_t b_blob)
+                {
+                    auto sketch_a = DSAoDDeserialize(a_blob);
+                    auto sketch_b = DSAoDDeserialize(b_blob);
+                    datasketches::array_of_doubles_intersection<DSAoDKeepFirstPolicy> intersection(
+                        datasketches::DEFAULT_SEED, DSAoDKeepFirstPolicy(sketch_a.get_num_values()));
+                    intersection.update(sketch_a);
+                    intersection.update(sketch_b);
+                    return DSTupleSerialize(result, intersection.get_result());
+                });
+        }
+
+        static void DSAoDANotB(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            BinaryExecutor::Execute<string_t, string_t, string_t>(
+                args.data[0], args.data[1], result, args.size(),
+                [&](string_t a_blob, string_t b_blob)
+                {
+                    auto sketch_a = DSAoDDeserialize(a_blob);
+                    auto sketch_b = DSAoDDeserialize(b_blob);
+                    datasketches::array_of_doubles_a_not_b a_not_b;
+                    return DSTupleSerialize(result, a_not_b.compute(sketch_a, sketch_b));
+                });
+        }
+
+        static void DSAoDEstimate(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            UnaryExecutor::Execute<string_t, double>(args.data[0], result, args.size(),
+                                                     [&](string_t sketch_blob)
+                                                     {
+                                                         return DSAoDDeserialize(sketch_blob).get_estimate();
+                                                     });
+        }
+
+        static void DSAoDLowerBound(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            BinaryExecutor::Execute<string_t, int32_t, double>(args.data[0], args.data[1], result, args.size(),
+                                                               [&](string_t sketch_blob, int32_t num_std_devs)
+                                                               {
+                                                                   return DSAoDDeserialize(sketch_blob).get_lower_bound(static_cast<uint8_t>(num_std_devs));
+                                                               });
+        }
+
+        static void DSAoDUpperBound(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            BinaryExecutor::Execute<string_t, int32_t, double>(args.data[0], args.data[1], result, args.size(),
+                                                               [&](string_t sketch_blob, int32_t num_std_devs)
+                                                               {
+                                                                   return DSAoDDeserialize(sketch_blob).get_upper_bound(static_cast<uint8_t>(num_std_devs));
+                                                               });
+        }
+
+        // Estimated totals of each value column over all distinct keys: the
+        // sums of the retained summaries scaled by 1 / theta.
+        static void DSAoDAppendSums(Vector &list_vector, idx_t row, const AoDCompactSketch &sketch)
+        {
+            auto num_values = sketch.get_num_values();
+            auto offset = ListVector::GetListSize(list_vector);
+            ListVector::Reserve(list_vector, offset + num_values);
+            auto &child = ListVector::GetEntry(list_vector);
+            auto sums = FlatVector::GetData<double>(child);
+            for (idx_t i = 0; i < num_values; i++)
+            {
+                sums[offset + i] = 0;
+            }
+            for (const auto &entry : sketch)
+            {
+                for (idx_t i = 0; i < num_values; i++)
+                {
+                    sums[offset + i] += entry.second[i];
+                }
+            }
+            auto theta = sketch.get_theta();
+            for (idx_t i = 0; i < num_values; i++)
+            {
+                sums[offset + i] /= theta;
+            }
+            auto entries = FlatVector::GetData<list_entry_t>(list_vector);
+            entries[row].offset = offset;
+            entries[row].length = num_values;
+            ListVector::SetListSize(list_vector, offset + num_values);
+        }
+
+        static void DSAoDSums(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat sketch_data;
+            args.data[0].ToUnifiedFormat(count, sketch_data);
+            auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_data);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+                DSAoDAppendSums(result, i, DSAoDDeserialize(sketch_entries[sketch_idx]));
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
+        static void DSAoDSummary(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            idx_t count = args.size();
+            UnifiedVectorFormat sketch_data;
+            args.data[0].ToUnifiedFormat(count, sketch_data);
+            auto sketch_entries = UnifiedVectorFormat::GetData<string_t>(sketch_data);
+            auto &struct_entries = StructVector::GetEntries(result);
+
+            for (idx_t i = 0; i < count; i++)
+            {
+                idx_t sketch_idx = sketch_data.sel->get_index(i);
+                if (!sketch_data.validity.RowIsValid(sketch_idx))
+                {
+                    FlatVector::SetNull(result, i, true);
+                    continue;
+                }
+
+                auto sketch = DSAoDDeserialize(sketch_entries[sketch_idx]);
+                FlatVector::GetData<bool>(*struct_entries[0])[i] = sketch.is_empty();
+                FlatVector::GetData<bool>(*struct_entries[1])[i] = sketch.is_estimation_mode();
+                FlatVector::GetData<double>(*struct_entries[2])[i] = sketch.get_theta();
+                FlatVector::GetData<int64_t>(*struct_entries[3])[i] = (int64_t)sketch.get_num_retained();
+                FlatVector::GetData<int32_t>(*struct_entries[4])[i] = (int32_t)sketch.get_num_values();
+                FlatVector::GetData<double>(*struct_entries[5])[i] = sketch.get_estimate();
+                FlatVector::GetData<double>(*struct_entries[6])[i] = sketch.get_lower_bound(2);
+                FlatVector::GetData<double>(*struct_entries[7])[i] = sketch.get_upper_bound(2);
+                DSAoDAppendSums(*struct_entries[8], i, sketch);
+            }
+
+            if (args.AllConstant())
+            {
+                result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            }
+        }
+
+        static string_t DSTupleIntUnionOf(Vector &result, const string_t &a_blob, const string_t &b_blob, DSTupleIntMode mode)
+        {
+            auto union_obj = datasketches::tuple_union<int64_t, DSTupleIntPolicy>::builder(DSTupleIntPolicy(mode)).build();
+            union_obj.update(DSTupleIntDeserialize(a_blob));
+            union_obj.update(DSTupleIntDeserialize(b_blob));
+            return DSTupleSerialize(result, union_obj.get_result());
+        }
+
+        static string_t DSTupleIntIntersectionOf(Vector &result, const string_t &a_blob, const string_t &b_blob, DSTupleIntMode mode)
+        {
+            datasketches::tuple_intersection<int64_t, DSTupleIntPolicy> intersection(datasketches::DEFAULT_SEED,
+                                                                                     DSTupleIntPolicy(mode));
+            intersection.update(DSTupleIntDeserialize(a_blob));
+            intersection.update(DSTupleIntDeserialize(b_blob));
+            return DSTupleSerialize(result, intersection.get_result());
+        }
+
+        static void DSTupleIntUnion(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            if (args.ColumnCount() == 3)
+            {
+                TernaryExecutor::Execute<string_t, string_t, string_t, string_t>(
+                    args.data[0], args.data[1], args.data[2], result, args.size(),
+                    [&](string_t a_blob, string_t b_blob, string_t policy)
+                    {
+                        return DSTupleIntUnionOf(result, a_blob, b_blob, DSTupleIntParseMode(policy.GetString()));
+                    });
+                return;
+            }
+            BinaryExecutor::Execute<string_t, string_t, string_t>(
+                args.data[0], args.data[1], result, args.size(),
+                [&](string_t a_blob, string_t b_blob)
+                {
+                    return DSTupleIntUnionOf(result, a_blob, b_blob, DSTupleIntMode::SUM);
+                });
+        }
+
+        static void DSTupleIntIntersect(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            if (args.ColumnCount() == 3)
+            {
+                TernaryExecutor::Execute<string_t, string_t, string_t, string_t>(
+                    args.data[0], args.data[1], args.data[2], result, args.size(),
+                    [&](string_t a_blob, string_t b_blob, string_t policy)
+                    {
+                        return DSTupleIntIntersectionOf(result, a_blob, b_blob, DSTupleIntParseMode(policy.GetString()));
+                    });
+                return;
+            }
+            BinaryExecutor::Execute<string_t, string_t, string_t>(
+                args.data[0], args.data[1], result, args.size(),
+                [&](string_t a_blob, string_t b_blob)
+                {
+                    return DSTupleIntIntersectionOf(result, a_blob, b_blob, DSTupleIntMode::SUM);
+                });
+        }
+
+        static void DSTupleIntANotB(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            BinaryExecutor::Execute<string_t, string_t, string_t>(
+                args.data[0], args.data[1], result, args.size(),
+                [&](string_t a_blob, string_t b_blob)
+                {
+                    datasketches::tuple_a_not_b<int64_t> a_not_b;
+                    return DSTupleSerialize(result, a_not_b.compute(DSTupleIntDeserialize(a_blob), DSTupleIntDeserialize(b_blob)));
+                });
+        }
+
+        static void DSTupleIntEstimate(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            UnaryExecutor::Execute<string_t, double>(args.data[0], result, args.size(),
+                                                     [&](string_t sketch_blob)
+                                                     {
+                                                         return DSTupleIntDeserialize(sketch_blob).get_estimate();
+                                                     });
+        }
+
+        static void DSTupleIntLowerBound(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            BinaryExecutor::Execute<string_t, int32_t, double>(args.data[0], args.data[1], result, args.size(),
+                                                               [&](string_t sketch_blob, int32_t num_std_devs)
+                                                               {
+                                                                   return DSTupleIntDeserialize(sketch_blob).get_lower_bound(static_cast<uint8_t>(num_std_devs));
+                                                               });
+        }
+
+        static void DSTupleIntUpperBound(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            BinaryExecutor::Execute<string_t, int32_t, double>(args.data[0], args.data[1], result, args.size(),
+                                                               [&](string_t sketch_blob, int32_t num_std_devs)
+                                                               {
+                                                                   return DSTupleIntDeserialize(sketch_blob).get_upper_bound(static_cast<uint8_t>(num_std_devs));
+                                                               });
+        }
+
+        // Estimated total of the summaries over all distinct keys: the sum of
+        // the retained summaries scaled by 1 / theta.
+        static void DSTupleIntSum(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            UnaryExecutor::Execute<string_t, double>(args.data[0], result, args.size(),
+                                                     [&](string_t sketch_blob)
+                                                     {
+                                                         auto sketch = DSTupleIntDeserialize(sketch_blob);
+                                                         double sum = 0;
+                                                         for (const auto &entry : sketch)
+                                                         {
+                                                             sum += (double)entry.second;
+                                                         }
+                                                         return sum / sketch.get_theta();
+                                                     });
+        }
+
+        // The summary at the given normalized rank among the retained keys,
+        // which are a uniform sample of the distinct keys (nearest rank).
+        static void DSTupleIntSummaryQuantile(DataChunk &args, ExpressionState &state, Vector &result)
+        {
+            BinaryExecutor::ExecuteWithNulls<string_t, double, int64_t>(
+                args.data[0], args.data[1], result, args.size(),
+                [&](string_t sketch_blob, double rank, ValidityMask &mask, idx_t idx)
+                {
+                    if (!(rank >= 0.0 && rank <= 1.0))
+                    {
+                        throw InvalidInputException("Tuple Sketch rank must be between 0 and 1, got: %f", rank);
+                    }
+                    auto sketch = DSTupleIntDeserialize(sketch_blob);
+                    if (sketch.get_num_retained() == 0)
+                    {
+                        mask.SetInvalid(idx);
+                        return int64_t(0);
+                    }
+                    vector<int64_t> summaries;
+                    summaries.reserve(sketch.get_num_retained());
+                    for (const auto &entry : sketch)
+                    {
+                        summaries.push_back(entry.second);
+                    }
+                    auto position = rank == 0.0 ? 0 : (idx_t)std::ceil(rank * summaries.size()) - 1;
+                    std::nth_element(summaries.begin(), summaries.begin() + position, summaries.end());
+                    return summaries[position];
+                });
+        }
+
+        // ============================================================
+        // 4. Type Creation & Registration Helpers
+        // ============================================================
+
+        static LogicalType CreateTupleSketchType(ExtensionLoader &loader, const string &new_type_name, const string &comment)
+        {
+            auto new_type = LogicalType(LogicalTypeId::BLOB);
+            auto type_info = CreateTypeInfo(new_type_name, LogicalType::BLOB);
+            type_info.temporary = false;
+            type_info.internal = true;
+            type_info.comment = comment;
+            new_type.SetAlias(new_type_name);
+
+            auto &system_catalog = Catalog::GetSystemCatalog(loader.GetDatabaseInstance());
+            auto data = CatalogTransaction::GetSystemTransaction(loader.GetDatabaseInstance());
+            system_catalog.CreateType(data, type_info);
+
+            loader.RegisterCastFunction(LogicalType::BLOB, new_type, DefaultCasts::ReinterpretCast, 1);
+            loader.RegisterCastFunction(new_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast, 1);
+            return new_type;
+        }
+
+        template <typename T>
+        static void RegisterAoDAggregates(AggregateFunctionSet &set, const LogicalType &key_type, const LogicalType &result_type)
+        {
+            using STATE = DSAoDState;
+            using OP = DSAoDCreateOperation;
+            AggregateFunction fun_default({key_type, LogicalType::LIST(LogicalType::DOUBLE)}, result_type,
+                                          AggregateFunction::StateSize<STATE>,
+                                          AggregateFunction::StateInitialize<STATE, OP, AggregateDestructorType::LEGACY>,
+                                          OP::ScatterUpdate<T>, AggregateFunction::StateCombine<STATE, OP>,
+                                          AggregateFunction::StateFinalize<STATE, string_t, OP>, OP::SimpleUpdate<T>);
+            fun_default.destructor = AggregateFunction::StateDestroy<STATE, OP>;
+            fun_default.bind = DSTrackedBind<DSTupleBindDefault>;
+            fun_default.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            set.AddFunction(fun_default);
+
+            auto fun_with_k = fun_default;
+            fun_with_k.bind = DSTrackedBind<DSTupleBindWithK<STATE, OP::ScatterUpdate<T>, OP::SimpleUpdate<T>>>;
+            fun_with_k.arguments.insert(fun_with_k.arguments.begin(), LogicalType::INTEGER);
+            set.AddFunction(fun_with_k);
+        }
+
+        template <typename T>
+        static void RegisterTupleIntAggregates(AggregateFunctionSet &set, const LogicalType &key_type, const LogicalType &result_type)
+        {
+            using STATE = DSTupleIntState;
+            using OP = DSTupleIntCreateOperation;
+            AggregateFunction fun({LogicalType::INTEGER, key_type, LogicalType::BIGINT}, result_type,
+                                  AggregateFunction::StateSize<STATE>,
+                                  AggregateFunction::StateInitialize<STATE, OP, AggregateDestructorType::LEGACY>,
+                                  OP::ScatterUpdate<T>, AggregateFunction::StateCombine<STATE, OP>,
+                                  AggregateFunction::StateFinalize<STATE, string_t, OP>, OP::SimpleUpdate<T>);
+            fun.destructor = AggregateFunction::StateDestroy<STATE, OP>;
+            fun.bind = DSTrackedBind<DSTupleIntBind<STATE, false, OP::ScatterUpdate<T>, OP::SimpleUpdate<T>>>;
+            fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+            set.AddFunction(fun);
+
+            auto fun_with_policy = fun;
+            fun_with_policy.bind = DSTrackedBind<DSTupleIntBind<STATE, true, OP::ScatterUpdate<T>, OP::SimpleUpdate<T>>>;
+            fun_with_policy.arguments.push_back(LogicalType::VARCHAR);
+            set.AddFunction(fun_with_policy);
+        }
+    }
+
+    // ============================================================
+    // 5. Main Loader
+    // ============================================================
+
+    static void LoadTupleIntSketch(ExtensionLoader &loader)
+    {
+        auto sketch_type = CreateTupleSketchType(loader, "sketch_tuple_int", "Sketch type for Integer Summary Tuple Sketch");
+        AggregateFunctionSet sketch_agg("datasketch_tuple_int");
+
+        // 1. KEYS AND VALUES
+        RegisterTupleIntAggregates<int8_t>(sketch_agg, LogicalType::TINYINT, sketch_type);
+        RegisterTupleIntAggregates<int16_t>(sketch_agg, LogicalType::SMALLINT, sketch_type);
+        RegisterTupleIntAggregates<int32_t>(sketch_agg, LogicalType::INTEGER, sketch_type);
+        RegisterTupleIntAggregates<int64_t>(sketch_agg, LogicalType::BIGINT, sketch_type);
+        RegisterTupleIntAggregates<float>(sketch_agg, LogicalType::FLOAT, sketch_type);
+        RegisterTupleIntAggregates<double>(sketch_agg, LogicalType::DOUBLE, sketch_type);
+        RegisterTupleIntAggregates<string_t>(sketch_agg, LogicalType::VARCHAR, sketch_type);
+
+        // 2. MERGE SKETCHES (sketch_tuple_int)
+        auto fun_merge = AggregateFunction::UnaryAggregateDestructor<DSTupleIntState, string_t, string_t, DSTupleIntMergeOperation, AggregateDestructorType::LEGACY>(
+            sketch_type, sketch_type);
+        fun_merge.bind = DSTrackedBind<DSTupleIntBind<DSTupleIntState, false, DSUnaryScatterUpdate<DSTupleIntState, string_t, DSTupleIntMergeOperation>,
+                                                      DSUnaryUpdate<DSTupleIntState, string_t, DSTupleIntMergeOperation>>>;
+        fun_merge.arguments = {LogicalType::INTEGER, sketch_type};
+        sketch_agg.AddFunction(fun_merge);
+
+        auto fun_merge_policy = fun_merge;
+        fun_merge_policy.bind = DSTrackedBind<DSTupleIntBind<DSTupleIntState, true, DSUnaryScatterUpdate<DSTupleIntState, string_t, DSTupleIntMergeOperation>,
+                                                             DSUnaryUpdate<DSTupleIntState, string_t, DSTupleIntMergeOperation>>>;
+        fun_merge_policy.arguments.push_back(LogicalType::VARCHAR);
+        sketch_agg.AddFunction(fun_merge_policy);
+
+        {
+            CreateAggregateFunctionInfo info(sketch_agg);
+            FunctionDescription desc;
+            desc.description = "Creates a tuple sketch that keeps an integer per distinct key, combined by the 'sum' (default), 'min' or 'max' policy, or merges such sketches";
+            desc.examples.push_back("datasketch_tuple_int(12, user_id, clicks)");
+            desc.examples.push_back("datasketch_tuple_int(12, user_id, last_seen_day, 'max')");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+
+        // --- SCALAR FUNCTIONS ---
+        {
+            ScalarFunctionSet set("datasketch_tuple_int_union");
+            set.AddFunction(ScalarFunction({sketch_type, sketch_type}, sketch_type, DSTupleIntUnion));
+            set.AddFunction(ScalarFunction({sketch_type, sketch_type, LogicalType::VARCHAR}, sketch_type, DSTupleIntUnion));
+            CreateScalarFunctionInfo info(set);
+            FunctionDescription desc;
+            desc.description = "Returns the union of two integer tuple sketches; the summaries of keys in both are combined by the policy (default 'sum')";
+            desc.examples.push_back("datasketch_tuple_int_union(sketch1, sketch2)");
+            desc.examples.push_back("datasketch_tuple_int_union(sketch1, sketch2, 'max')");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            ScalarFunctionSet set("datasketch_tuple_int_intersect");
+            set.AddFunction(ScalarFunction({sketch_type, sketch_type}, sketch_type, DSTupleIntIntersect));
+            set.AddFunction(ScalarFunction({sketch_type, sketch_type, LogicalType::VARCHAR}, sketch_type, DSTupleIntIntersect));
+            CreateScalarFunctionInfo info(set);
+            FunctionDescription desc;
+            desc.description = "Returns the keys in both integer tuple sketches, with their summaries combined by the policy (default 'sum')";
+            desc.examples.push_back("datasketch_tuple_int_intersect(sketch1, sketch2)");
+            desc.examples.push_back("datasketch_tuple_int_intersect(sketch1, sketch2, 'min')");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_tuple_int_a_not_b", {sketch_type, sketch_type}, sketch_type, DSTupleIntANotB));
+            FunctionDescription desc;
+            desc.description = "Returns the keys of sketch A that are not in sketch B, with their summaries (set difference)";
+            desc.examples.push_back("datasketch_tuple_int_a_not_b(sketch_a, sketch_b)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(DSWithStatistics(ScalarFunction("datasketch_tuple_int_estimate", {sketch_type}, LogicalType::DOUBLE, DSTupleIntEstimate), DSNonNegativeStatistics));
+            FunctionDescription desc;
+            desc.description = "Returns the estimated number of distinct keys in the integer tuple sketch";
+            desc.examples.push_back("datasketch_tuple_int_estimate(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(DSWithStatistics(ScalarFunction("datasketch_tuple_int_lower_bound", {sketch_type, LogicalType::INTEGER}, LogicalType::DOUBLE, DSTupleIntLowerBound), DSNonNegativeStatistics));
+            FunctionDescription desc;
+            desc.description = "Returns the lower bound of the distinct key count at the given number of standard deviations (1, 2, or 3)";
+            desc.examples.push_back("datasketch_tuple_int_lower_bound(sketch, 2)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(DSWithStatistics(ScalarFunction("datasketch_tuple_int_upper_bound", {sketch_type, LogicalType::INTEGER}, LogicalType::DOUBLE, DSTupleIntUpperBound), DSNonNegativeStatistics));
+            FunctionDescription desc;
+            desc.description = "Returns the upper bound of the distinct key count at the given number of standard deviations (1, 2, or 3)";
+            desc.examples.push_back("datasketch_tuple_int_upper_bound(sketch, 2)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_tuple_int_sum", {sketch_type}, LogicalType::DOUBLE, DSTupleIntSum));
+            FunctionDescription desc;
+            desc.description = "Returns the estimated total of the summaries over all distinct keys";
+            desc.examples.push_back("datasketch_tuple_int_sum(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_tuple_int_summary_quantile", {sketch_type, LogicalType::DOUBLE}, LogicalType::BIGINT, DSTupleIntSummaryQuantile));
+            FunctionDescription desc;
+            desc.description = "Returns the summary at the given normalized rank (0 to 1) over the distinct keys, estimated from the retained keys";
+            desc.examples.push_back("datasketch_tuple_int_summary_quantile(sketch, 0.5)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+    }
+
+    void LoadTupleSketch(ExtensionLoader &loader)
+    {
+        auto sketch_type = CreateTupleSketchType(loader, "sketch_aod", "Sketch type for Array of Doubles Tuple Sketch");
+        AggregateFunctionSet sketch_agg("datasketch_aod");
+
+        // 1. KEYS AND VALUES
+        RegisterAoDAggregates<int8_t>(sketch_agg, LogicalType::TINYINT, sketch_type);
+        RegisterAoDAggregates<int16_t>(sketch_agg, LogicalType::SMALLINT, sketch_type);
+        RegisterAoDAggregates<int32_t>(sketch_agg, LogicalType::INTEGER, sketch_type);
+        RegisterAoDAggregates<int64_t>(sketch_agg, LogicalType::BIGINT, sketch_type);
+        RegisterAoDAggregates<float>(sketch_agg, LogicalType::FLOAT, sketch_type);
+        RegisterAoDAggregates<double>(sketch_agg, LogicalType::DOUBLE, sketch_type);
+        RegisterAoDAggregates<string_t>(sketch_agg, LogicalType::VARCHAR, sketch_type);
+
+        // 2. MERGE SKETCHES (sketch_aod)
+        auto fun_merge = AggregateFunction::UnaryAggregateDestructor<DSAoDState, string_t, string_t, DSAoDMergeOperation, AggregateDestructorType::LEGACY>(
+            sketch_type, sketch_type);
+        fun_merge.bind = DSTrackedBind<DSTupleBindDefault>;
+        sketch_agg.AddFunction(fun_merge);
+
+        auto fun_merge_k = fun_merge;
+        fun_merge_k.bind = DSTrackedBind<DSTupleBindWithK<DSAoDState, DSUnaryScatterUpdate<DSAoDState, string_t, DSAoDMergeOperation>,
+                                                          DSUnaryUpdate<DSAoDState, string_t, DSAoDMergeOperation>>>;
+        fun_merge_k.arguments = {LogicalType::INTEGER, sketch_type};
+        sketch_agg.AddFunction(fun_merge_k);
+
+        {
+            CreateAggregateFunctionInfo info(sketch_agg);
+            FunctionDescription desc;
+            desc.description = "Creates an Array of Doubles tuple sketch that sums an array of values per distinct key, or merges such sketches";
+            desc.examples.push_back("datasketch_aod(user_id, [revenue])");
+            desc.examples.push_back("datasketch_aod(12, user_id, [revenue, 1])");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+
+        // --- SCALAR FUNCTIONS ---
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_aod_union", {sketch_type, sketch_type}, sketch_type, DSAoDUnion));
+            FunctionDescription desc;
+            desc.description = "Returns the union of two AoD sketches; the values of keys in both are summed";
+            desc.examples.push_back("datasketch_aod_union(sketch1, sketch2)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_aod_intersect", {sketch_type, sketch_type}, sketch_type, DSAoDIntersect));
+            FunctionDescription desc;
+            desc.description = "Returns the keys of the first AoD sketch that are also in the second, with the values of the first";
+            desc.examples.push_back("datasketch_aod_intersect(sketch1, sketch2)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_aod_a_not_b", {sketch_type, sketch_type}, sketch_type, DSAoDANotB));
+            FunctionDescription desc;
+            desc.description = "Returns the keys of sketch A that are not in sketch B, with their values (set difference)";
+            desc.examples.push_back("datasketch_aod_a_not_b(sketch_a, sketch_b)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(DSWithStatistics(ScalarFunction("datasketch_aod_estimate", {sketch_type}, LogicalType::DOUBLE, DSAoDEstimate), DSNonNegativeStatistics));
+            FunctionDescription desc;
+            desc.description = "Returns the estimated number of distinct keys in the AoD sketch";
+            desc.examples.push_back("datasketch_aod_estimate(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(DSWithStatistics(ScalarFunction("datasketch_aod_lower_bound", {sketch_type, LogicalType::INTEGER}, LogicalType::DOUBLE, DSAoDLowerBound), DSNonNegativeStatistics));
+            FunctionDescription desc;
+            desc.description = "Returns the lower bound of the distinct key count at the given number of standard deviations (1, 2, or 3)";
+            desc.examples.push_back("datasketch_aod_lower_bound(sketch, 2)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(DSWithStatistics(ScalarFunction("datasketch_aod_upper_bound", {sketch_type, LogicalType::INTEGER}, LogicalType::DOUBLE, DSAoDUpperBound), DSNonNegativeStatistics));
+            FunctionDescription desc;
+            desc.description = "Returns the upper bound of the distinct key count at the given number of standard deviations (1, 2, or 3)";
+            desc.examples.push_back("datasketch_aod_upper_bound(sketch, 2)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_aod_sums", {sketch_type}, LogicalType::LIST(LogicalType::DOUBLE), DSAoDSums));
+            FunctionDescription desc;
+            desc.description = "Returns the estimated total of each value column over all distinct keys";
+            desc.examples.push_back("datasketch_aod_sums(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+        {
+            child_list_t<LogicalType> struct_fields;
+            struct_fields.push_back({"is_empty", LogicalType::BOOLEAN});
+            struct_fields.push_back({"is_estimation_mode", LogicalType::BOOLEAN});
+            struct_fields.push_back({"theta", LogicalType::DOUBLE});
+            struct_fields.push_back({"num_retained", LogicalType::BIGINT});
+            struct_fields.push_back({"num_values", LogicalType::INTEGER});
+            struct_fields.push_back({"estimate", LogicalType::DOUBLE});
+            struct_fields.push_back({"lower_bound", LogicalType::DOUBLE});
+            struct_fields.push_back({"upper_bound", LogicalType::DOUBLE});
+            struct_fields.push_back({"sums", LogicalType::LIST(LogicalType::DOUBLE)});
+
+            CreateScalarFunctionInfo info(ScalarFunction("datasketch_aod_summary", {sketch_type}, LogicalType::STRUCT(struct_fields), DSAoDSummary));
+            FunctionDescription desc;
+            desc.description = "Returns a struct of the metadata, distinct key estimates (bounds at 2 standard deviations) and estimated value totals of the AoD sketch";
+            desc.examples.push_back("datasketch_aod_summary(sketch)");
+            info.descriptions.push_back(desc);
+            loader.RegisterFunction(info);
+        }
+
+        LoadTupleIntSketch(loader);
+    }
+
+}